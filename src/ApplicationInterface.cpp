@@ -12,6 +12,8 @@
 #include "ParamResponsePair.hpp"
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
+#include <mutex>
+#include <shared_mutex>
 #include <thread>
 
 //#define DEBUG
@@ -21,6 +23,7 @@
 namespace Dakota {
 
 extern PRPCache data_pairs;
+extern std::shared_timed_mutex data_pairs_mutex;
 
 ApplicationInterface::
 ApplicationInterface(const ProblemDescDB& problem_db):
@@ -66,6 +69,7 @@ ApplicationInterface(const ProblemDescDB& problem_db):
     problem_db.get_bool("interface.nearby_evaluation_cache")),
   nearbyTolerance(
     problem_db.get_real("interface.nearby_evaluation_cache_tolerance")),
+  interfaceIdIndex(interface_id_index(interfaceId)),
   restartFileFlag(problem_db.get_bool("interface.restart_file")),
   sharedRespData(SharedResponseData(problem_db)),
   gradientType(problem_db.get_string("responses.gradient_type")),
@@ -449,8 +453,9 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
     asv_mapping(set, algebraic_set, core_set);
     algebraic_resp = Response(sharedRespData, algebraic_set);
     if (asynch_flag) {
-      ParamResponsePair prp(vars, interfaceId, algebraic_resp, evalIdCntr);
-      beforeSynchAlgPRPQueue.insert(prp);
+      ParamResponsePair prp(vars, interfaceId, interfaceIdIndex,
+			    algebraic_resp, evalIdCntr);
+      beforeSynchAlgPRPQueue.insert(std::move(prp));
     }
     else
       algebraic_mappings(vars, algebraic_set, algebraic_resp);
@@ -495,8 +500,9 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
 
       if (asynch_flag) { // multiple simultaneous evals. (local or parallel)
 	// use this constructor since deep copies of vars/response are needed
-	ParamResponsePair prp(vars, interfaceId, core_resp, evalIdCntr);
-	beforeSynchCorePRPQueue.insert(prp);
+	ParamResponsePair prp(vars, interfaceId, interfaceIdIndex, core_resp,
+			      evalIdCntr);
+	beforeSynchCorePRPQueue.insert(std::move(prp));
 	// jobs are not queued until call to synchronize() to allow dynamic
 	// scheduling. Response data headers and data_pair list insertion
 	// appear in synchronize().
@@ -522,10 +528,9 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
 
 	if (evalCacheFlag || restartFileFlag) {
 	  // manage shallow/deep copy of vars/response with evalCacheFlag
-	  ParamResponsePair prp(vars, interfaceId, core_resp, currEvalId,
-				evalCacheFlag);
-	  if (evalCacheFlag)   data_pairs.insert(prp);
-	  if (restartFileFlag) parallelLib.write_restart(prp);
+	  ParamResponsePair prp(vars, interfaceId, interfaceIdIndex, core_resp,
+				currEvalId, evalCacheFlag);
+	  store_evaluation(prp);
 	}
       }
     }
@@ -611,7 +616,15 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
   //   requiring an additional test to prefer positive id's in some use cases).
   PRPCacheOIter ord_it; PRPCacheHIter hash_it;
   ParamResponsePair cache_pr; int cache_eval_id; bool cache_hit = false;
+  // data_pairs may be shared among threaded sub-iterators: exact lookups
+  // share the lock and only a restart/import record promotion (below)
+  // requires exclusive access
+  std::unique_lock<std::shared_timed_mutex> cache_lock(data_pairs_mutex,
+						       std::defer_lock);
+  // fingerprint formed once for cache and queue lookups
+  PRPSearchKey search_key(interfaceId, interfaceIdIndex, vars);
   if (nearbyDuplicateDetect) { // slow but allows tolerance on equality
+    cache_lock.lock();
     ord_it = lookup_by_nearby_val(data_pairs, interfaceId, vars,
 				  response.active_set(), nearbyTolerance);
     cache_hit = (ord_it != data_pairs.end());
@@ -623,18 +636,33 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
     }
   }
   else { // fast but requires exact binary match
-    hash_it = lookup_by_val(data_pairs, interfaceId, vars,
-			    response.active_set());
-    cache_hit = (hash_it != data_pairs.get<hashed>().end());
-    if (cache_hit) { // hashed-specific updates (shared updates below)
-      response.update(hash_it->response(), true); // update metadata
-      cache_eval_id = hash_it->eval_id();
-      if (cache_eval_id <= 0)
-	{ cache_pr = *hash_it; data_pairs.get<hashed>().erase(hash_it); }
+    {
+      std::shared_lock<std::shared_timed_mutex> read_lock(data_pairs_mutex);
+      hash_it = lookup_by_val(data_pairs, search_key, response.active_set());
+      cache_hit = (hash_it != data_pairs.get<hashed>().end());
+      if (cache_hit) { // hashed-specific updates (shared updates below)
+	cache_eval_id = hash_it->eval_id();
+	if (cache_eval_id > 0) // else updated under exclusive access below
+	  response.update(hash_it->response(), true); // update metadata
+      }
+    }
+    if (cache_hit && cache_eval_id <= 0) {
+      // repeat the lookup under exclusive access, since another thread
+      // may have promoted this record in the interim; if the record is
+      // no longer found, this is not a duplicate and it is evaluated
+      cache_lock.lock();
+      hash_it = lookup_by_val(data_pairs, search_key, response.active_set());
+      cache_hit = (hash_it != data_pairs.get<hashed>().end());
+      if (cache_hit) {
+	response.update(hash_it->response(), true); // update metadata
+	cache_eval_id = hash_it->eval_id();
+	if (cache_eval_id <= 0)
+	  { cache_pr = *hash_it; data_pairs.get<hashed>().erase(hash_it); }
+      }
     }
   }
   if (cache_hit) { // updates shared among ordered/hashed lookups
-    if (cache_eval_id <= 0) {
+    if (cache_eval_id <= 0 && cache_lock.owns_lock()) {
       // ordered key is const; must remove (above) & change/add (below)
       cache_pr.eval_id(evalIdCntr); // promote
       data_pairs.insert(cache_pr);  // shallow copy of previous vars/resp
@@ -645,12 +673,13 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
 
     return true; // Duplication detected
   }
+  if (cache_lock.owns_lock()) cache_lock.unlock();
 
   // check beforeSynchCorePRPQueue as well (if asynchronous and no cache hit)
   if (asynch_flag) {
     // queue lookups only support one flavor for simplicity: exact lookup
-    PRPQueueHIter queue_it = lookup_by_val(beforeSynchCorePRPQueue, interfaceId,
-					   vars, response.active_set());
+    PRPQueueHIter queue_it = lookup_by_val(beforeSynchCorePRPQueue, search_key,
+					   response.active_set());
     if (queue_it != beforeSynchCorePRPQueue.get<hashed>().end()) {
       // Duplication detected: bookkeep
       beforeSynchDuplicateMap[evalIdCntr]
@@ -2973,8 +3002,7 @@ receive_evaluation(PRPQueueIter& prp_it, size_t buff_index, int server_id,
   raw_response.update(remote_response, true); // update metadata
 
   // insert into restart and eval cache ASAP
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
-  if (restartFileFlag) parallelLib.write_restart(*prp_it);
+  store_evaluation(*prp_it);
 }
 
 
@@ -2997,8 +3025,7 @@ void ApplicationInterface::process_asynch_local(int fn_eval_id)
   }
 
   rawResponseMap[fn_eval_id] = prp_it->response();
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
-  if (restartFileFlag) parallelLib.write_restart(*prp_it);
+  store_evaluation(*prp_it);
 
   asynchLocalActivePRPQueue.erase(prp_it);
   if (asynchLocalEvalStatic && asynchLocalEvalConcurrency > 1) {// free "server"
@@ -3009,6 +3036,19 @@ void ApplicationInterface::process_asynch_local(int fn_eval_id)
 }
 
 
+/** Inserts a completed evaluation into the evaluation cache and the
+    restart file.  Cache insertions are serialized since data_pairs may
+    be shared among threaded sub-iterators (see IteratorScheduler). */
+void ApplicationInterface::store_evaluation(const ParamResponsePair& prp)
+{
+  if (evalCacheFlag) {
+    std::lock_guard<std::shared_timed_mutex> cache_lock(data_pairs_mutex);
+    data_pairs.insert(prp);
+  }
+  if (restartFileFlag) parallelLib.write_restart(prp);
+}
+
+
 void ApplicationInterface::process_synch_local(PRPQueueIter& prp_it)
 {
   int fn_eval_id = prp_it->eval_id();
@@ -3018,8 +3058,7 @@ void ApplicationInterface::process_synch_local(PRPQueueIter& prp_it)
     Cout << "evaluation " << fn_eval_id << std::endl;
   }
   rawResponseMap[fn_eval_id] = prp_it->response();
-  if (evalCacheFlag)   data_pairs.insert(*prp_it);
-  if (restartFileFlag) parallelLib.write_restart(*prp_it);
+  store_evaluation(*prp_it);
 }
 
 
@@ -326,6 +326,8 @@ private:
   void process_asynch_local(int fn_eval_id);
   /// process a completed synchronous local evaluation
   void process_synch_local(PRPQueueIter& prp_it);
+  /// insert a completed evaluation into the evaluation cache and restart
+  void store_evaluation(const ParamResponsePair& prp);
 
   /// helper function for creating an initial active local queue by launching
   /// asynch local jobs from local_prp_queue, as limited by server capacity
@@ -478,6 +480,9 @@ private:
   bool nearbyDuplicateDetect;
   /// tolerance value for tolerance-based duplication detection
   Real nearbyTolerance;
+  /// interned index of interfaceId (see interface_id_index()), cached
+  /// for evaluation cache and queue insertions and lookups
+  int interfaceIdIndex;
 
   /// used to manage a user request to deactivate the restart file (i.e., 
   /// insertions into write_restart).
@@ -732,7 +737,8 @@ launch_asynch_local(MPIUnpackBuffer& recv_buffer, int fn_eval_id)
   recv_buffer.reset();
   Response local_response(sharedRespData, set); // special ctor
   ParamResponsePair
-    prp(vars, interfaceId, local_response, fn_eval_id, false); // shallow copy
+    prp(vars, interfaceId, interfaceIdIndex, local_response, fn_eval_id,
+	false); // shallow copy
   asynchLocalActivePRPQueue.insert(prp);
   // execute
   derived_map_asynch(prp);
@@ -292,6 +292,9 @@ void CONMINOptimizer::initialize_run()
 
 void CONMINOptimizer::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   size_t i, j, fn_eval_cntr;
   int num_cv = numContinuousVars;
 
@@ -11,6 +11,7 @@
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
 #include "ParamResponsePair.hpp"
+#include "DakotaMinimizer.hpp"
 #include "NonDLHSSampling.hpp"
 #include "EvaluationStore.hpp"
 
@@ -22,7 +23,8 @@ namespace Dakota {
 ConcurrentMetaIterator::ConcurrentMetaIterator(ProblemDescDB& problem_db):
   MetaIterator(problem_db),
   numRandomJobs(probDescDB.get_int("method.concurrent.random_jobs")),
-  randomSeed(probDescDB.get_int("method.random_seed"))
+  randomSeed(probDescDB.get_int("method.random_seed")),
+  iteratorThreads(probDescDB.get_int("method.iterator_threads"))
 {
   // ***************************************************************************
   // TO DO: support concurrent meta-iteration for both Minimizer & Analyzer:
@@ -104,7 +106,8 @@ ConcurrentMetaIterator::
 ConcurrentMetaIterator(ProblemDescDB& problem_db, Model& model):
   MetaIterator(problem_db, model),
   numRandomJobs(probDescDB.get_int("method.concurrent.random_jobs")),
-  randomSeed(probDescDB.get_int("method.random_seed"))
+  randomSeed(probDescDB.get_int("method.random_seed")),
+  iteratorThreads(probDescDB.get_int("method.iterator_threads"))
 {
   const RealVector& raw_param_sets
     = problem_db.get_rv("method.concurrent.parameter_sets");
@@ -213,6 +216,7 @@ void ConcurrentMetaIterator::derived_init_communicators(ParLevLIter pl_iter)
 	     << method_enum_to_string(probDescDB.get_ushort("method.algorithm"))
 	     << std::endl;
     }
+    initialize_thread_replicas(lightwt_ctor, sub_meth_name);
   }
 
   // restore list nodes
@@ -221,6 +225,59 @@ void ConcurrentMetaIterator::derived_init_communicators(ParLevLIter pl_iter)
 }
 
 
+/** Thread replicas are only used within a single-processor iterator
+    server, since each replica requires its own Model (and Interface)
+    instance and the message passing schedulers assume a single
+    sub-iterator per server.  Each replica is constructed from the
+    active (sub-)method/model DB nodes with object reuse disabled.
+    Non-reentrant sub-methods (see Minimizer::reentrant()) are executed
+    serially. */
+void ConcurrentMetaIterator::
+initialize_thread_replicas(bool lightwt_ctor, const String& sub_meth_name)
+{
+  int num_threads = std::min(iteratorThreads, iterSched.numIteratorJobs);
+  if (num_threads <= 1 || !threadIterators.empty())
+    return;
+  if (iterSched.messagePass || iterSched.iteratorCommSize > 1) {
+    if (summaryOutputFlag)
+      Cerr << "Warning: iterator_threads is not supported in combination "
+	   << "with multiple iterator servers\n         or processors per "
+	   << "iterator.  Ignoring iterator_threads." << std::endl;
+    return;
+  }
+  if (resultsDB.active() || evaluationsDB.active()) {
+    if (summaryOutputFlag)
+      Cerr << "Warning: iterator_threads is not supported in combination "
+	   << "with HDF5 results or evaluations\n         output.  Ignoring "
+	   << "iterator_threads." << std::endl;
+    return;
+  }
+  unsigned short sub_method = selectedIterator.method_name();
+  if (!Minimizer::reentrant(sub_method)) {
+    if (summaryOutputFlag)
+      Cerr << "Warning: iterator_threads is not supported for non-reentrant "
+	   << "sub-method " << method_enum_to_string(sub_method)
+	   << ".\n         Ignoring iterator_threads." << std::endl;
+    return;
+  }
+
+  threadIterators.resize(num_threads); threadModels.resize(num_threads);
+  threadIterators[0] = selectedIterator; threadModels[0] = iteratedModel;
+  probDescDB.unique_instances(true);
+  for (int i=1; i<num_threads; ++i) {
+    threadModels[i] = probDescDB.get_model();
+    initialize_weights(threadModels[i]);
+    if (lightwt_ctor)
+      iterSched.init_iterator(probDescDB, sub_meth_name, threadIterators[i],
+			      threadModels[i]);
+    else
+      iterSched.init_iterator(probDescDB, threadIterators[i], threadModels[i]);
+  }
+  probDescDB.unique_instances(false);
+  iterSched.numIteratorThreads = num_threads;
+}
+
+
 void ConcurrentMetaIterator::derived_set_communicators(ParLevLIter pl_iter)
 {
   size_t mi_pl_index = methodPCIter->mi_parallel_level_index(pl_iter) + 1;
@@ -229,6 +286,8 @@ void ConcurrentMetaIterator::derived_set_communicators(ParLevLIter pl_iter)
     ParLevLIter si_pl_iter
       = methodPCIter->mi_parallel_level_iterator(mi_pl_index);
     iterSched.set_iterator(selectedIterator, si_pl_iter);
+    for (size_t i=1; i<threadIterators.size(); ++i)
+      iterSched.set_iterator(threadIterators[i], si_pl_iter);
   }
 }
 
@@ -241,6 +300,8 @@ void ConcurrentMetaIterator::derived_free_communicators(ParLevLIter pl_iter)
     ParLevLIter si_pl_iter
       = methodPCIter->mi_parallel_level_iterator(mi_pl_index);
     iterSched.free_iterator(selectedIterator, si_pl_iter);
+    for (size_t i=1; i<threadIterators.size(); ++i)
+      iterSched.free_iterator(threadIterators[i], si_pl_iter);
   }
 
   // deallocate the mi_pl parallelism level
@@ -366,6 +427,13 @@ void ConcurrentMetaIterator::pre_run()
 
 void ConcurrentMetaIterator::core_run()
 {
+  // Threaded jobs within a single iterator server: graphics and tabular
+  // data are not segregated among threads and are therefore omitted
+  if (iterSched.numIteratorThreads > 1) {
+    iterSched.thread_schedule_iterators(*this, threadIterators);
+    return;
+  }
+
   // For graphics data, limit to iterator server comm leaders; this is further
   // segregated within initialize_graphics(): all iterator masters stream
   // tabular data, but only iterator server 1 generates a graphics window.
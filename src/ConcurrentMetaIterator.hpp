@@ -69,12 +69,14 @@ protected:
   IntIntPair estimate_partition_bounds();
 
   void initialize_iterator(int job_index);
+  void initialize_iterator(int job_index, int thread_index);
   void pack_parameters_buffer(MPIPackBuffer& send_buffer, int job_index);
   void unpack_parameters_initialize(MPIUnpackBuffer& recv_buffer,
 				    int job_index);
   void pack_results_buffer(MPIPackBuffer& send_buffer, int job_index);
   void unpack_results_buffer(MPIUnpackBuffer& recv_buffer, int job_index);
   void update_local_results(int job_index);
+  void update_local_results(int job_index, int thread_index);
 
   const Model& algorithm_space_model() const;
 
@@ -89,10 +91,20 @@ private:
   /// called by unpack_parameters_initialize(MPIUnpackBuffer) and
   /// initialize_iterator(int) to update iteratedModel and selectedIterator
   void initialize_iterator(const RealVector& param_set);
+  /// update the provided model (iteratedModel or a thread replica) with
+  /// the param_set for the next iterator job
+  void initialize_iterator(const RealVector& param_set, Model& model);
 
   /// initialize the iterated Model prior to Iterator instantiation
   /// and define param_set_len
   void initialize_model();
+  /// define initial weights to trigger model recasting (PARETO_SET)
+  void initialize_weights(Model& model);
+
+  /// instantiate Iterator/Model replicas for threaded execution of
+  /// iterator jobs within a single iterator server
+  void initialize_thread_replicas(bool lightwt_ctor,
+				  const String& sub_meth_name);
 
   //
   //- Heading: Data members
@@ -116,8 +128,20 @@ private:
   int numRandomJobs;
   /// seed for random number generator for random samples
   int randomSeed;
+  /// number of threads requested for executing iterator jobs within a
+  /// single iterator server (from the \c iterator_threads specification)
+  int iteratorThreads;
   /// 1-d array of ParamResponsePair results corresponding to numIteratorJobs
   PRPArray prpResults;
+
+  /// independent iterator instances, one per thread, for threaded
+  /// scheduling (first entry shares its representation with
+  /// selectedIterator)
+  IteratorArray threadIterators;
+  /// independent model instances, one per thread, iterated by
+  /// threadIterators (first entry shares its representation with
+  /// iteratedModel)
+  ModelArray threadModels;
 };
 
 
@@ -156,35 +180,51 @@ inline void ConcurrentMetaIterator::initialize_model()
 {
   if (methodName == PARETO_SET) {
     paramSetLen = probDescDB.get_sizet("responses.num_objective_functions");
-    // define dummy weights to trigger model recasting in iterator construction
-    // (replaced at run-time with weight sets from specification)
-    if (iteratedModel.primary_response_fn_weights().empty()) {
-      RealVector initial_wts(paramSetLen, false);
-      initial_wts = 1./(Real)paramSetLen;
-      iteratedModel.primary_response_fn_weights(initial_wts); // trigger recast
-    }
+    initialize_weights(iteratedModel);
   }
   else
     paramSetLen = iteratedModel.cv();
 }
 
 
+inline void ConcurrentMetaIterator::initialize_weights(Model& model)
+{
+  // define dummy weights to trigger model recasting in iterator construction
+  // (replaced at run-time with weight sets from specification)
+  if (methodName == PARETO_SET && model.primary_response_fn_weights().empty()) {
+    RealVector initial_wts(paramSetLen, false);
+    initial_wts = 1./(Real)paramSetLen;
+    model.primary_response_fn_weights(initial_wts); // trigger recast
+  }
+}
+
+
 inline void ConcurrentMetaIterator::
-initialize_iterator(const RealVector& param_set)
+initialize_iterator(const RealVector& param_set, Model& model)
 {
   if (methodName == MULTI_START)
-    iteratedModel.continuous_variables(param_set);
+    model.continuous_variables(param_set);
   else {
-    iteratedModel.continuous_variables(initialPt); // reset
-    iteratedModel.primary_response_fn_weights(param_set);
+    model.continuous_variables(initialPt); // reset
+    model.primary_response_fn_weights(param_set);
   }
 }
 
 
+inline void ConcurrentMetaIterator::
+initialize_iterator(const RealVector& param_set)
+{ initialize_iterator(param_set, iteratedModel); }
+
+
 inline void ConcurrentMetaIterator::initialize_iterator(int job_index)
 { initialize_iterator(parameterSets[job_index]); }
 
 
+inline void ConcurrentMetaIterator::
+initialize_iterator(int job_index, int thread_index)
+{ initialize_iterator(parameterSets[job_index], threadModels[thread_index]); }
+
+
 inline void ConcurrentMetaIterator::
 pack_parameters_buffer(MPIPackBuffer& send_buffer, int job_index)
 { send_buffer << parameterSets[job_index]; }
@@ -218,6 +258,18 @@ inline void ConcurrentMetaIterator::update_local_results(int job_index)
 			job_index+1); // deep copy
 }
 
+
+inline void ConcurrentMetaIterator::
+update_local_results(int job_index, int thread_index)
+{
+  // each job updates a distinct (pre-sized) prpResults entry
+  prpResults[job_index]
+    = ParamResponsePair(threadIterators[thread_index].variables_results(),
+			threadModels[thread_index].interface_id(),
+			threadIterators[thread_index].response_results(),
+			job_index+1); // deep copy
+}
+
 } // namespace Dakota
 
 #endif
@@ -114,8 +114,10 @@ void DDACEDesignCompExp::pre_run()
 
   // If VBD has been selected, generate a series of replicate parameter sets
   // (each of the size specified by the user) in order to compute VBD metrics.
+  // Unless all data is retained, the A_B^i replicates are streamed within
+  // core_run().
   if (vbdFlag && vbdViaSamplingMethod==VBD_PICK_AND_FREEZE)
-    get_vbd_parameter_sets(iteratedModel, numSamples);
+    get_vbd_parameter_sets(iteratedModel, numSamples, !allDataFlag);
   else
     get_parameter_sets(iteratedModel);
 }
@@ -126,7 +128,11 @@ void DDACEDesignCompExp::core_run()
   bool log_best_flag  = (numObjFns || numLSqTerms), // opt or NLS data set
     compute_corr_flag = (!subIteratorFlag),
     log_resp_flag     = (mainEffectsFlag || allDataFlag || compute_corr_flag);
-  evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
+  if (vbdStreamFlag) // VBD indices are accumulated block by block
+    evaluate_vbd_parameter_sets(iteratedModel, numSamples,
+				pStudyDACESensGlobal, log_best_flag);
+  else
+    evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
 }
 
 
@@ -161,13 +167,14 @@ void DDACEDesignCompExp::post_run(std::ostream& s)
   // BMA TODO: always compute all stats, even in VBD mode (stats on
   // first two replicates)
   if (vbdFlag) {
-    pStudyDACESensGlobal.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
-                                                        vbdViaSamplingNumBins,
-                                                        numFunctions,
-                                                        numContinuousVars + numDiscreteIntVars + numDiscreteRealVars,
-                                                        numSamples,
-                                                        allSamples,
-                                                        allResponses);
+    if (!vbdStreamFlag) // else computed within core_run()
+      pStudyDACESensGlobal.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
+                                                          vbdViaSamplingNumBins,
+                                                          numFunctions,
+                                                          numContinuousVars + numDiscreteIntVars + numDiscreteRealVars,
+                                                          numSamples,
+                                                          allSamples,
+                                                          allResponses);
   }
   else {
     if (mainEffectsFlag) // need allResponses
@@ -299,6 +299,9 @@ void DOTOptimizer::initialize_run()
 
 void DOTOptimizer::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   size_t i, j, fn_eval_cntr;
   int num_cv = numContinuousVars;
 
@@ -17,6 +17,7 @@
 #include "ParallelLibrary.hpp"
 #include "IteratorScheduler.hpp"
 #include "PRPMultiIndex.hpp"
+#include "SensAnalysisGlobal.hpp"
 
 static const char rcsId[]="@(#) $Id: DakotaAnalyzer.cpp 7035 2010-10-22 21:45:39Z mseldre $";
 
@@ -32,6 +33,8 @@ Analyzer(ProblemDescDB& problem_db, Model& model):
   Iterator(BaseConstructor(), problem_db), compactMode(true),
   numObjFns(0), numLSqTerms(0), // default: no best data tracking
   vbdFlag(problem_db.get_bool("method.variance_based_decomp")),
+  vbdStreamFlag(false),
+  evalWindow(problem_db.get_sizet("method.evaluation_window")),
   writePrecision(problem_db.get_int("environment.output_precision"))
 {
   // set_db_list_nodes() is set by a higher context
@@ -64,7 +67,7 @@ Analyzer::
 Analyzer(unsigned short method_name, Model& model):
   Iterator(NoDBBaseConstructor(), method_name, model), compactMode(true),
   numObjFns(0), numLSqTerms(0), // default: no best data tracking
-  vbdFlag(false), vbdDropTol(-1.),
+  vbdFlag(false), vbdDropTol(-1.), vbdStreamFlag(false), evalWindow(0),
   writePrecision(0)
 {
   update_from_model(iteratedModel); // variable/response counts & checks
@@ -76,7 +79,7 @@ Analyzer(unsigned short method_name, Model& model,
 	 const ShortShortPair& view_override):
   Iterator(NoDBBaseConstructor(), method_name, model), compactMode(true),
   numObjFns(0), numLSqTerms(0), // default: no best data tracking
-  writePrecision(0)
+  vbdStreamFlag(false), evalWindow(0), writePrecision(0)
 {
   if (view_override != iteratedModel.current_variables().view())
     recast_model_view(view_override);
@@ -87,7 +90,7 @@ Analyzer(unsigned short method_name, Model& model,
 Analyzer::Analyzer(unsigned short method_name):
   Iterator(NoDBBaseConstructor(), method_name), compactMode(true),
   numObjFns(0), numLSqTerms(0), // default: no best data tracking
-  writePrecision(0)
+  vbdStreamFlag(false), evalWindow(0), writePrecision(0)
 { }
 
 
@@ -239,6 +242,14 @@ evaluate_parameter_sets(Model& model, bool log_resp_flag, bool log_best_flag)
   bool header_flag = (allHeaders.size() == num_evals),
        asynch_flag = model.asynch_flag();
 
+  // a bounded window of in-flight evaluations, drained as they complete
+  // (nonblocking synchronization does not support finite differencing)
+  if (asynch_flag && evalWindow && evalWindow < num_evals &&
+      !model.derivative_estimation()) {
+    evaluate_parameter_sets_windowed(model, log_resp_flag, log_best_flag);
+    return;
+  }
+
   if (!asynch_flag && log_resp_flag) allResponses.clear();
 
   // Loop over parameter sets and compute responses.  Collect data
@@ -256,6 +267,11 @@ evaluate_parameter_sets(Model& model, bool log_resp_flag, bool log_best_flag)
     else {
       model.evaluate(activeSet);
       log_response(model, allResponses, i, log_resp_flag, log_best_flag);
+      if (evalWindow) { // consumers see each synchronous evaluation
+	IntResponseMap resp_map;
+	resp_map[model.evaluation_id()] = model.current_response();
+	process_response_batch(resp_map);
+      }
     }
     archive_model_variables(model, i);
   }
@@ -267,12 +283,75 @@ evaluate_parameter_sets(Model& model, bool log_resp_flag, bool log_best_flag)
     const IntResponseMap& resp_map = model.synchronize();
     if (log_resp_flag) // log response data
       allResponses = resp_map;
+    if (evalWindow)
+      process_response_batch(resp_map);
     if (compactMode) log_response_map(allSamples,   resp_map, log_best_flag);
     else             log_response_map(allVariables, resp_map, log_best_flag);
   }
 }
 
 
+/** Streaming counterpart to the asynchronous evaluate_parameter_sets():
+    at most evalWindow evaluations are in flight, and each set of
+    completions returned by synchronize_nowait() is logged and passed to
+    process_response_batch() before further parameter sets are queued.
+    Responses are retained in allResponses only if log_resp_flag, such
+    that memory for completed evaluations scales with the window rather
+    than the number of parameter sets. */
+void Analyzer::
+evaluate_parameter_sets_windowed(Model& model, bool log_resp_flag,
+				 bool log_best_flag)
+{
+  size_t num_evals
+    = (compactMode) ? allSamples.numCols() : allVariables.size(),
+    num_queued = 0, num_completed = 0;
+  bool header_flag = (allHeaders.size() == num_evals),
+       db_act      = resultsDB.active();
+  std::map<int, size_t> eval_index; // in-flight eval id -> parameter set
+
+  if (log_resp_flag) allResponses.clear();
+
+  while (num_completed < num_evals) {
+    // top off the window
+    for ( ; num_queued < num_evals &&
+	    num_queued - num_completed < evalWindow; ++num_queued) {
+      if (header_flag) Cout << allHeaders[num_queued];
+      if (compactMode) update_model_from_sample(model, allSamples[num_queued]);
+      else      update_model_from_variables(model, allVariables[num_queued]);
+      model.evaluate_nowait(activeSet);
+      eval_index[model.evaluation_id()] = num_queued;
+      archive_model_variables(model, num_queued);
+    }
+
+    // drain any completions (blocking once the last set has been queued,
+    // since there is no further work to overlap)
+    const IntResponseMap& resp_map = (num_queued == num_evals) ?
+      model.synchronize() : model.synchronize_nowait();
+    for (IntRespMCIter r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit){
+      std::map<int, size_t>::iterator idx_it = eval_index.find(r_cit->first);
+      if (idx_it == eval_index.end()) {
+	Cerr << "\nError: evaluation " << r_cit->first << " returned by "
+	     << "synchronize_nowait() was not queued by Analyzer::\n       "
+	     << "evaluate_parameter_sets_windowed()." << std::endl;
+	abort_handler(METHOD_ERROR);
+      }
+      size_t i = idx_it->second;
+      eval_index.erase(idx_it);
+      if (log_best_flag) {
+	if (compactMode) update_best(allSamples[i],   r_cit->first,
+				     r_cit->second);
+	else             update_best(allVariables[i], r_cit->first,
+				     r_cit->second);
+      }
+      if (db_act)        archive_model_response(r_cit->second, i);
+      if (log_resp_flag) allResponses[r_cit->first] = r_cit->second;
+    }
+    process_response_batch(resp_map);
+    num_completed += resp_map.size();
+  }
+}
+
+
 void Analyzer::
 evaluate_batch(Model& model, int batch_id, bool log_best_flag)
 {
@@ -361,6 +440,7 @@ synchronize_batches(Model& model, bool log_best_flag)
       int                   batch_id = s_it->first;
       IntRealVectorMap&       rv_map = s_it->second;
       IntResponseMap& batch_resp_map = batchResponsesMap[batch_id];
+      if (rv_map.empty()) continue; // nothing was scheduled for this batch
       // Copy one by one:
       //for (rv_it=rv_map.begin(); rv_it!=rv_map.end(); ++rv_it) {
       //  eval_id = rv_it->first;
@@ -386,6 +466,7 @@ synchronize_batches(Model& model, bool log_best_flag)
       int                   batch_id = v_it->first;
       IntVariablesMap&      vars_map = v_it->second;
       IntResponseMap& batch_resp_map = batchResponsesMap[batch_id];
+      if (vars_map.empty()) continue; // nothing was scheduled for this batch
       //if (initial) {
 	first_id = vars_map.begin()->first;
 	first_it = full_resp_map.find(first_id);
@@ -486,8 +567,13 @@ variables_array_to_samples(const VariablesArray& vars_array,
 
 
 /** Generate (numvars + 2)*num_samples replicate sets for VBD,
-    populating allSamples( numvars, (numvars + 2)*num_samples ) */
-void Analyzer::get_vbd_parameter_sets(Model& model, size_t num_samples)
+    populating allSamples( numvars, (numvars + 2)*num_samples ): A and
+    B followed by one A_B^i per variable (B with row i taken from A).
+    When streaming, only A and B are stored in allSamples; streaming is
+    disabled for pre-run output and post-run input, which operate on
+    the full design. */
+void Analyzer::
+get_vbd_parameter_sets(Model& model, size_t num_samples, bool stream_flag)
 {
   if (!compactMode) {
     Cerr << "\nError: get_vbd_parameter_sets requires compactMode.\n";
@@ -498,9 +584,10 @@ void Analyzer::get_vbd_parameter_sets(Model& model, size_t num_samples)
   // sampling modes, but is equivalent to previous code.
   size_t num_vars = numContinuousVars + numDiscreteIntVars + 
     numDiscreteStringVars + numDiscreteRealVars;
-  size_t num_replicates = num_vars + 2;
+  vbdStreamFlag = stream_flag && !parallelLib.command_line_user_modes();
+  size_t num_replicates = (vbdStreamFlag) ? 2 : num_vars + 2;
 
-  allSamples.shape(num_vars, (num_vars+2)*num_samples);
+  allSamples.shape(num_vars, num_replicates*num_samples);
 
   // run derived sampling routine generate two initial matrices
   vary_pattern(true);
@@ -525,6 +612,8 @@ void Analyzer::get_vbd_parameter_sets(Model& model, size_t num_samples)
 	 << sample_2.numCols() << std::endl;
     abort_handler(METHOD_ERROR);
   }
+  if (vbdStreamFlag)
+    return;
 
   // one additional replicate per variable
   for (int i=0; i<num_vars; ++i) {
@@ -539,6 +628,116 @@ void Analyzer::get_vbd_parameter_sets(Model& model, size_t num_samples)
   }
 }
 
+
+/** Each A_B^i is formed in a single reused buffer by restoring row i-1
+    from B and swapping in row i from A, evaluated as a block, and its
+    responses are reduced into vbd_stats before the next block is
+    formed.  Evaluation ids and archive indices follow the order of the
+    full design.  As for evaluate_parameter_sets(), an evaluation window
+    bounds the asynchronous evaluations in flight within each block. */
+void Analyzer::
+evaluate_vbd_parameter_sets(Model& model, size_t num_samples,
+			    SensAnalysisGlobal& vbd_stats, bool log_best_flag)
+{
+  size_t i, j, r, offset, num_vars = allSamples.numRows(),
+    num_replicates = num_vars + 2;
+  bool asynch_flag = model.asynch_flag(), db_act = resultsDB.active(),
+    windowed = (asynch_flag && evalWindow && evalWindow < num_samples &&
+		!model.derivative_estimation());
+  RealMatrix sample_1(Teuchos::View, allSamples, num_vars, num_samples, 0, 0),
+    sample_2(Teuchos::View, allSamples, num_vars, num_samples, 0, num_samples),
+    sample_r(sample_2); // deep copy, updated in place for each A_B^i
+  IntResponseMap block_resp;
+
+  vbd_stats.initialize_pick_and_freeze(numFunctions, num_vars, num_samples);
+  for (r=0, offset=0; r<num_replicates; ++r, offset+=num_samples) {
+    if (r >= 2) {
+      i = r - 2;
+      for (j=0; j<num_samples; ++j) {
+	if (i) sample_r(i-1, j) = sample_2(i-1, j);
+	sample_r(i, j) = sample_1(i, j);
+      }
+    }
+    const RealMatrix& block
+      = (r == 0) ? sample_1 : ( (r == 1) ? sample_2 : sample_r );
+
+    block_resp.clear();
+    if (windowed) {
+      evaluate_vbd_block_windowed(model, block, offset, block_resp,
+				  log_best_flag);
+      vbd_stats.accumulate_pick_and_freeze(r, block_resp);
+      continue;
+    }
+
+    for (j=0; j<num_samples; ++j) {
+      update_model_from_sample(model, block[j]);
+      archive_model_variables(model, offset + j);
+      if (asynch_flag)
+	model.evaluate_nowait(activeSet);
+      else {
+	model.evaluate(activeSet);
+	log_response(model, block_resp, offset + j, true, log_best_flag);
+      }
+    }
+
+    if (asynch_flag) {
+      const IntResponseMap& resp_map = model.synchronize();
+      IntRespMCIter r_cit;
+      for (j=0, r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++j, ++r_cit) {
+	if (log_best_flag) update_best(block[j], r_cit->first, r_cit->second);
+	if (db_act)        archive_model_response(r_cit->second, offset + j);
+      }
+      vbd_stats.accumulate_pick_and_freeze(r, resp_map);
+    }
+    else
+      vbd_stats.accumulate_pick_and_freeze(r, block_resp);
+  }
+  vbd_stats.finalize_pick_and_freeze();
+}
+
+
+/** Windowed evaluation of one block of the VBD design, as in
+    evaluate_parameter_sets_windowed(); the block's responses are
+    returned in block_resp, ordered by evaluation id and therefore by
+    sample. */
+void Analyzer::
+evaluate_vbd_block_windowed(Model& model, const RealMatrix& block,
+			    size_t offset, IntResponseMap& block_resp,
+			    bool log_best_flag)
+{
+  size_t num_samples = block.numCols(), num_queued = 0, num_completed = 0;
+  bool db_act = resultsDB.active();
+  std::map<int, size_t> eval_index; // in-flight eval id -> sample
+
+  while (num_completed < num_samples) {
+    for ( ; num_queued < num_samples &&
+	    num_queued - num_completed < evalWindow; ++num_queued) {
+      update_model_from_sample(model, block[num_queued]);
+      archive_model_variables(model, offset + num_queued);
+      model.evaluate_nowait(activeSet);
+      eval_index[model.evaluation_id()] = num_queued;
+    }
+
+    const IntResponseMap& resp_map = (num_queued == num_samples) ?
+      model.synchronize() : model.synchronize_nowait();
+    for (IntRespMCIter r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit){
+      std::map<int, size_t>::iterator idx_it = eval_index.find(r_cit->first);
+      if (idx_it == eval_index.end()) {
+	Cerr << "\nError: evaluation " << r_cit->first << " returned by "
+	     << "synchronize_nowait() was not queued by Analyzer::\n       "
+	     << "evaluate_vbd_block_windowed()." << std::endl;
+	abort_handler(METHOD_ERROR);
+      }
+      size_t j = idx_it->second;
+      eval_index.erase(idx_it);
+      if (log_best_flag) update_best(block[j], r_cit->first, r_cit->second);
+      if (db_act)        archive_model_response(r_cit->second, offset + j);
+      block_resp[r_cit->first] = r_cit->second;
+    }
+    num_completed += resp_map.size();
+  }
+}
+
 /** Generate tabular output with active variables (compactMode) or all
     variables with their labels and response labels, with no data.
     Variables are sequenced {cv, div, drv} */
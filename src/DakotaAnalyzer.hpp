@@ -18,6 +18,8 @@
 
 namespace Dakota {
 
+class SensAnalysisGlobal;
+
 /// Base class for NonD, DACE, and ParamStudy branches of the iterator
 /// hierarchy.
 
@@ -129,6 +131,12 @@ protected:
   void evaluate_parameter_sets(Model& model, bool log_resp_flag = true,
 			       bool log_best_flag = false);
 
+  /// consume a set of completed evaluations (keyed by evaluation id) as
+  /// they are returned within evaluate_parameter_sets(), when an
+  /// evaluation window is active; default is a no-op
+  virtual void process_response_batch(const IntResponseMap& resp_map)
+    { /* no-op */ }
+
   /// perform function evaluations to map a keyed batch of parameter sets
   /// (allVariablesMap[key]) into a corresponding batch of response sets
   /// (allResponsesMap[key])
@@ -143,8 +151,17 @@ protected:
   /// complete and bookkeeping can be cleared
   void clear_batches();
 
-  /// generate replicate parameter sets for use in variance-based decomposition
-  void get_vbd_parameter_sets(Model& model, size_t num_samples);
+  /// generate replicate parameter sets for use in variance-based
+  /// decomposition; if stream_flag, only the A and B replicates are
+  /// generated and the A_B^i are formed in evaluate_vbd_parameter_sets()
+  void get_vbd_parameter_sets(Model& model, size_t num_samples,
+			      bool stream_flag = false);
+  /// evaluate the pick-and-freeze design one replicate block at a time,
+  /// accumulating the VBD indices in vbd_stats rather than retaining
+  /// the full design or its responses
+  void evaluate_vbd_parameter_sets(Model& model, size_t num_samples,
+				   SensAnalysisGlobal& vbd_stats,
+				   bool log_best_flag = false);
 
   /// archive model evaluation points
   virtual void archive_model_variables(const Model&, size_t idx) const
@@ -219,6 +236,14 @@ protected:
   /// tolerance for omitting output of small VBD indices computed via
   /// either PCE or sampling
   Real vbdDropTol;
+  /// whether get_vbd_parameter_sets() generated only the A and B
+  /// replicates, for block-wise evaluation in evaluate_vbd_parameter_sets()
+  bool vbdStreamFlag;
+
+  /// maximum number of in-flight evaluations in evaluate_parameter_sets()
+  /// and evaluate_vbd_parameter_sets() (from the evaluation_window
+  /// specification); 0 for no bound
+  size_t evalWindow;
 
 private:
 
@@ -229,6 +254,16 @@ private:
   /// layer a RecastModel on top of iteratedModel to enact a view override
   void recast_model_view(const ShortShortPair& view_override);
 
+  /// evaluate_parameter_sets() with at most evalWindow evaluations in
+  /// flight, processing completions incrementally
+  void evaluate_parameter_sets_windowed(Model& model, bool log_resp_flag,
+					bool log_best_flag);
+  /// evaluate one replicate block of the VBD design with at most
+  /// evalWindow evaluations in flight, returning its responses
+  void evaluate_vbd_block_windowed(Model& model, const RealMatrix& block,
+				   size_t offset, IntResponseMap& block_resp,
+				   bool log_best_flag);
+
   /// compares current evaluation to best evaluation and updates best
   void compute_best_metrics(const Response& response,
 			    std::pair<Real,Real>& metrics);
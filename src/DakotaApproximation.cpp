@@ -48,7 +48,7 @@ Approximation::Approximation(BaseConstructor, const ProblemDescDB& problem_db,
 			     const SharedApproxData& shared_data,
                              const String& approx_label):
   approxData(true), approxLabel(approx_label),
-  sharedDataRep(shared_data.data_rep())
+  sharedDataRep(shared_data.data_rep()), dataRemovalCount(0)
 { /* empty ctor */ }
 
 
@@ -60,14 +60,15 @@ Approximation::Approximation(BaseConstructor, const ProblemDescDB& problem_db,
     letter IS the representation, its rep pointer is set to NULL. */
 Approximation::
 Approximation(NoDBBaseConstructor, const SharedApproxData& shared_data):
-  approxData(true), sharedDataRep(shared_data.data_rep())
+  approxData(true), sharedDataRep(shared_data.data_rep()),
+  dataRemovalCount(0)
 { /* empty ctor */ }
 
 
 /** The default constructor is used in Array<Approximation> instantiations
     and by the alternate envelope constructor.  approxRep is NULL in this
     case (problem_db is needed to build a meaningful Approximation object). */
-Approximation::Approximation()
+Approximation::Approximation(): dataRemovalCount(0)
 { /* empty ctor */ }
 
 
@@ -287,6 +288,7 @@ void Approximation::replace(const IntResponsePair& response_pr, size_t fn_index)
       = response_to_sdr(response_pr.second, fn_index);// *** Note: SHALLOW_COPY *** the referenced responses will be cleared from the Model queue but *may* persist in the eval cache; this is what ApproximationInterface::cache_lookup() manages ... Only matters for gradient/Hessian views ...
     approxData.replace(/*sharedDataRep->approxDataKeys,*/
 		       sdr, response_pr.first);
+    ++dataRemovalCount;
   }
 }
 
@@ -294,7 +296,10 @@ void Approximation::replace(const IntResponsePair& response_pr, size_t fn_index)
 void Approximation::pop_data(bool save_data)
 {
   if (approxRep) approxRep->pop_data(save_data);
-  else approxData.pop(sharedDataRep->activeKey, save_data);
+  else {
+    approxData.pop(sharedDataRep->activeKey, save_data);
+    ++dataRemovalCount;
+  }
 }
 
 
@@ -409,6 +409,11 @@ protected:
   /// contains the approximation data that is shared among the response set
   std::shared_ptr<SharedApproxData> sharedDataRep;
 
+  /// number of pop_data(), replace(), and clear operations on approxData,
+  /// allowing incremental rebuilds to detect that previously built data
+  /// were removed or changed
+  size_t dataRemovalCount;
+
 private:
 
   //
@@ -596,14 +601,17 @@ inline void Approximation::clear_current_active_data()
 inline void Approximation::clear_data()
 {
   if (approxRep) approxRep->clear_data();
-  else approxData.clear_data(); // re-initializes by default
+  else { approxData.clear_data(); ++dataRemovalCount; } // re-initializes
 }
 
 
 inline void Approximation::clear_active_data()
 {
   if (approxRep) approxRep->clear_active_data();
-  else approxData.clear_active_data(sharedDataRep->activeKey);
+  else {
+    approxData.clear_active_data(sharedDataRep->activeKey);
+    ++dataRemovalCount;
+  }
 }
 
 
@@ -405,6 +405,27 @@ void Interface::init_evaluation_counters(size_t num_fns)
 }
 
 
+/** Used when rerunning a study within a persistent environment, such
+    that evaluation ids and summaries restart from zero. */
+void Interface::reset_evaluation_counters()
+{
+  if (interfaceRep) // envelope fwd to letter
+    interfaceRep->reset_evaluation_counters();
+  else { // letter (not virtual)
+    evalIdCntr = newEvalIdCntr = evalIdRefPt = newEvalIdRefPt = 0;
+    if (fineGrainEvalCounters) {
+      size_t num_fns = fnValCounter.size();
+      fnValCounter.assign(num_fns, 0);     fnGradCounter.assign(num_fns, 0);
+      fnHessCounter.assign(num_fns, 0);    newFnValCounter.assign(num_fns, 0);
+      newFnGradCounter.assign(num_fns, 0); newFnHessCounter.assign(num_fns, 0);
+      fnValRefPt.assign(num_fns, 0);       fnGradRefPt.assign(num_fns, 0);
+      fnHessRefPt.assign(num_fns, 0);      newFnValRefPt.assign(num_fns, 0);
+      newFnGradRefPt.assign(num_fns, 0);   newFnHessRefPt.assign(num_fns, 0);
+    }
+  }
+}
+
+
 void Interface::set_evaluation_reference()
 {
   if (interfaceRep) // envelope fwd to letter
@@ -286,6 +286,8 @@ public:
   void init_evaluation_counters(size_t num_fns);
   /// set evaluation count reference points for the interface
   void set_evaluation_reference();
+  /// zero the evaluation counters and reference points for the interface
+  void reset_evaluation_counters();
 
   /// print an evaluation summary for the interface
   void print_evaluation_summary(std::ostream& s, bool minimal_header,
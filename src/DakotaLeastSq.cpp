@@ -29,7 +29,7 @@ using namespace std;
 namespace Dakota {
 
 // initialization of static needed by RecastModel
-LeastSq* LeastSq::leastSqInstance(NULL);
+thread_local LeastSq* LeastSq::leastSqInstance(NULL);
 
 /** This constructor extracts the inherited data for the least squares
     branch and performs sanity checking on gradient and constraint
@@ -63,7 +63,7 @@ protected:
   size_t numLeastSqTerms; ///< number of least squares terms
 
   /// pointer to LeastSq instance used in static member functions
-  static LeastSq* leastSqInstance;
+  static thread_local LeastSq* leastSqInstance;
   /// pointer containing previous value of leastSqInstance
   LeastSq* prevLSqInstance;
 
@@ -34,7 +34,8 @@ namespace Dakota {
 extern PRPCache data_pairs; // global container
 
 // initialization of static needed by RecastModel
-Minimizer* Minimizer::minimizerInstance(NULL);
+thread_local Minimizer* Minimizer::minimizerInstance(NULL);
+std::recursive_mutex Minimizer::nonReentrantMutex;
 
 
 /** This constructor extracts inherited data for the optimizer and least
@@ -1106,6 +1107,23 @@ sum_squared_residuals(size_t num_pri_fns, const RealVector& residuals,
 }
 
 
+/** Sub-iterators for which this returns false are executed serially
+    rather than on concurrent threads (see IteratorScheduler); when
+    nested within another (reentrant) minimizer, their core_run() is
+    serialized by nonReentrantMutex. */
+bool Minimizer::reentrant(unsigned short method_name)
+{
+  switch (method_name) {
+  case NPSOL_SQP: case NLSSOL_SQP: case NL2SOL: case NCSU_DIRECT:
+  case DOT_BFGS:  case DOT_FRCG:   case DOT_MMFD: case DOT_SLP: case DOT_SQP:
+  case CONMIN_FRCG: case CONMIN_MFD:
+    return false; break;
+  default:
+    return true;  break;
+  }
+}
+
+
 void Minimizer::print_model_resp(size_t num_pri_fns, const RealVector& best_fns,
 				 size_t num_best, size_t best_index,
 				 std::ostream& s)
@@ -14,6 +14,7 @@
 #include "DakotaResponse.hpp"
 #include "DakotaTPLDataTransfer.hpp"
 #include "ExperimentData.hpp"
+#include <mutex>
 
 namespace Dakota {
 
@@ -70,6 +71,11 @@ public:
 				  const ActiveSet& active_set,
 				  std::ostream& s);
 
+  /// return false for solvers whose (Fortran or f2c) implementations
+  /// retain state in COMMON blocks or static locals and therefore may
+  /// not execute concurrently within one process
+  static bool reentrant(unsigned short method_name);
+
   // Accessor for data transfer helper/adapters
   std::shared_ptr<TPLDataTransfer> get_data_transfer_helper() const
     { return dataTransferHandler; }
@@ -303,10 +309,14 @@ protected:
   Model scalingModel;
 
   /// pointer to Minimizer used in static member functions
-  static Minimizer* minimizerInstance;
+  static thread_local Minimizer* minimizerInstance;
   /// pointer containing previous value of minimizerInstance
   Minimizer* prevMinInstance;
 
+  /// serializes core_run() among the non-reentrant solvers (see
+  /// reentrant()) when minimizers execute on concurrent threads
+  static std::recursive_mutex nonReentrantMutex;
+
   /// convenience flag for gradient_type == numerical && method_source == vendor
   bool vendorNumericalGradFlag;
 
@@ -5241,6 +5241,32 @@ trans_U_to_X(const RealVector& u_c_vars, RealVector& x_c_vars)
 }
 
 
+void Model::
+trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples)
+{
+  if (modelRep)
+    modelRep->trans_X_to_U(x_samples, u_samples);
+  else {
+    Cerr << "Error: Letter lacking redefinition of virtual trans_X_to_U() "
+         << "function.\n       No default defined at base class." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+}
+
+
+void Model::
+trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples)
+{
+  if (modelRep)
+    modelRep->trans_U_to_X(u_samples, x_samples);
+  else {
+    Cerr << "Error: Letter lacking redefinition of virtual trans_U_to_X() "
+         << "function.\n       No default defined at base class." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+}
+
+
 void Model::
 trans_grad_X_to_U(const RealVector& fn_grad_x, RealVector& fn_grad_u,
 		  const RealVector& x_vars)
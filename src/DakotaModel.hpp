@@ -248,6 +248,10 @@ public:
   virtual void trans_U_to_X(const RealVector& u_c_vars, RealVector& x_c_vars);
   /// transform x-space variable values to u-space
   virtual void trans_X_to_U(const RealVector& x_c_vars, RealVector& u_c_vars);
+  /// transform a matrix of u-space samples (one per column) to x-space
+  virtual void trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples);
+  /// transform a matrix of x-space samples (one per column) to u-space
+  virtual void trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples);
 
   /// transform x-space gradient vector to u-space
   virtual void trans_grad_X_to_U(const RealVector& fn_grad_x,
@@ -1383,6 +1387,19 @@ protected:
   template <typename MetaType>
   void rekey_synch(MetaType& meta_object, bool block, IntIntMap& id_map,
 		   IntResponseMap& resp_map_rekey, bool deep_copy = false);
+  /// synchronize via meta_object and pass each returned job matched in
+  /// id_map to resp_op(rekeyed_id, response) within the same traversal,
+  /// such that no intermediate rekeyed map is formed; unmatched jobs are
+  /// cached within the meta_object
+  template <typename MetaType, typename RespOp>
+  void rekey_transform_synch(MetaType& meta_object, bool block,
+			     IntIntMap& id_map, RespOp resp_op);
+  /// pass each job in the meta_object response map that is matched in
+  /// id_map to resp_op(rekeyed_id, response), removing it from both maps;
+  /// unmatched jobs are cached within the meta_object
+  template <typename MetaType, typename RespOp>
+  void rekey_response_apply(MetaType& meta_object, IntIntMap& id_map,
+			    RespOp resp_op);
 
   //
   //- Heading: Data
@@ -3921,16 +3938,14 @@ rekey_synch(MetaType& meta_object, bool block, IntIntMapArray& id_maps,
 }
 
 
-template <typename MetaType> void Model::
-rekey_response_map(MetaType& meta_object, IntIntMap& id_map,
-		   IntResponseMap& resp_map_rekey, bool deep_copy)
+template <typename MetaType, typename RespOp> void Model::
+rekey_response_apply(MetaType& meta_object, IntIntMap& id_map, RespOp resp_op)
 {
-  // rekey the IntResponseMap evals matched in id_map, else move to cache
+  // process the IntResponseMap evals matched in id_map, else move to cache
   IntResponseMap& orig_resp_map = meta_object.response_map();
   IntRespMIter r_it = orig_resp_map.begin();
   IntIntMIter id_it =        id_map.begin();
-  size_t i, orig_eval_id, resp_eval_id;
-  resp_map_rekey.clear();
+  int orig_eval_id, resp_eval_id;
 
   // Single traversal of orig_resp_map and id_map
   while (id_it != id_map.end() && r_it != orig_resp_map.end()) {
@@ -3940,9 +3955,9 @@ rekey_response_map(MetaType& meta_object, IntIntMap& id_map,
     else if (orig_eval_id > resp_eval_id)  ++r_it;
     else { // equal: process match and increment both iterators
       Response& resp = r_it->second;
-      resp_map_rekey[id_it->second] = (deep_copy) ? resp.copy() : resp;
       if (evaluations_db_state(meta_object) == EvaluationsDBState::ACTIVE)
 	asynch_eval_store(meta_object, orig_eval_id, resp);
+      resp_op(id_it->second, resp);
       id_map.erase(id_it++);      // postfix increment avoids iter invalidation
       orig_resp_map.erase(r_it++);// postfix increment avoids iter invalidation
     }
@@ -3956,6 +3971,17 @@ rekey_response_map(MetaType& meta_object, IntIntMap& id_map,
 }
 
 
+template <typename MetaType> void Model::
+rekey_response_map(MetaType& meta_object, IntIntMap& id_map,
+		   IntResponseMap& resp_map_rekey, bool deep_copy)
+{
+  resp_map_rekey.clear();
+  rekey_response_apply(meta_object, id_map,
+    [&resp_map_rekey, deep_copy](int rekey_id, Response& resp)
+    { resp_map_rekey[rekey_id] = (deep_copy) ? resp.copy() : resp; });
+}
+
+
 template <typename MetaType> void Model::
 rekey_synch(MetaType& meta_object, bool block, IntIntMap& id_map,
 	    IntResponseMap& resp_map_rekey, bool deep_copy)
@@ -3966,6 +3992,16 @@ rekey_synch(MetaType& meta_object, bool block, IntIntMap& id_map,
 }
 
 
+template <typename MetaType, typename RespOp> void Model::
+rekey_transform_synch(MetaType& meta_object, bool block, IntIntMap& id_map,
+		      RespOp resp_op)
+{
+  if (block) meta_object.synchronize();
+  else       meta_object.synchronize_nowait();
+  rekey_response_apply(meta_object, id_map, resp_op);
+}
+
+
 /// global comparison function for Model
 inline bool model_id_compare(const Model& model, const void* id)
 { return ( *(const String*)id == model.model_id() ); }
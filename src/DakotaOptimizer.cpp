@@ -24,7 +24,7 @@ static const char rcsId[]="@(#) $Id: DakotaOptimizer.cpp 7031 2010-10-22 16:23:5
 namespace Dakota {
 
 // initialization of static needed by RecastModel
-Optimizer* Optimizer::optimizerInstance(NULL);
+thread_local Optimizer* Optimizer::optimizerInstance(NULL);
 
 
 Optimizer::
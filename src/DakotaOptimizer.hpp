@@ -528,7 +528,7 @@ protected:
   bool localObjectiveRecast;
 
   /// pointer to Optimizer instance used in static member functions
-  static Optimizer* optimizerInstance;
+  static thread_local Optimizer* optimizerInstance;
   /// pointer containing previous value of optimizerInstance
   Optimizer* prevOptInstance;
 
@@ -197,6 +197,11 @@ Response::Response(const Response& resp):
 { /* empty ctor */ }
 
 
+Response::Response(Response&& resp) noexcept:
+  responseRep(std::move(resp.responseRep))
+{ /* empty ctor */ }
+
+
 Response Response::operator=(const Response& resp)
 {
   responseRep = resp.responseRep;
@@ -204,6 +209,13 @@ Response Response::operator=(const Response& resp)
 }
 
 
+Response& Response::operator=(Response&& resp) noexcept
+{
+  responseRep = std::move(resp.responseRep);
+  return *this;
+}
+
+
 Response::~Response()
 { /* empty dtor */ }
 
@@ -73,6 +73,8 @@ public:
   explicit Response(const SharedResponseData& srd);
   /// copy constructor
   Response(const Response& response);
+  /// move constructor (transfers the letter without reference counting)
+  Response(Response&& response) noexcept;
   /// destructor
   virtual ~Response();
 
@@ -82,6 +84,8 @@ public:
 
   /// assignment operator
   Response operator=(const Response& response);
+  /// move assignment operator
+  Response& operator=(Response&& response) noexcept;
   
   //
   //- Heading: Member functions
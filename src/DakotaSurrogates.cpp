@@ -54,7 +54,7 @@ Real SurrogatesBaseApprox::diagnostic(const String& metric_type)
   convert_surrogate_data(vars,resp);
 
   StringArray diag_set(1, metric_type);
-  auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+  auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, modelQoI);
 
   Cout << std::setw(20) << diag_set[0] << "  " << metric_vals[0] << '\n';
 
@@ -96,7 +96,7 @@ void SurrogatesBaseApprox::primary_diagnostics(size_t fn_index)
     MatrixXd vars, resp;
     convert_surrogate_data(vars,resp);
 
-    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, modelQoI);
 
     Cout << "\nSurrogate quality metrics at build (training) points for "
 	 << func_description << ":\n";
@@ -146,7 +146,7 @@ challenge_diagnostics(size_t fn_index, const RealMatrix& challenge_points,
     Eigen::Map<Eigen::MatrixXd> resp(challenge_responses.values(),
 				     challenge_responses.length(), 1);
 
-    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, modelQoI);
 
     Cout << "\nSurrogate quality metrics at challenge (test) points for "
 	 << func_description << ":\n";
@@ -229,7 +229,7 @@ SurrogatesBaseApprox::value(const RealVector& c_vars)
   }
 
   Eigen::Map<Eigen::RowVectorXd> eval_point(c_vars.values(), c_vars.length());
-  return model->value(eval_point)(0);
+  return model->value(eval_point, modelQoI)(0);
 }
     
 const RealVector& SurrogatesBaseApprox::gradient(const RealVector& c_vars)
@@ -240,7 +240,7 @@ const RealVector& SurrogatesBaseApprox::gradient(const RealVector& c_vars)
   Eigen::Map<Eigen::MatrixXd> eval_pts(c_vars.values(), num_evals, num_vars);
 
   // not sending Eigen view of approxGradient as model->gradient calls resize()
-  MatrixXd pred_grad = model->gradient(eval_pts);
+  MatrixXd pred_grad = model->gradient(eval_pts, modelQoI);
 
   approxGradient.sizeUninitialized(c_vars.length());
   for (size_t j = 0; j < num_vars; j++)
@@ -264,14 +264,28 @@ import_model(const ProblemDescDB& problem_db)
     (is_binary ? ".bin" : ".txt");
 
   model = dakota::surrogates::Surrogate::load(filename, is_binary);
+  modelQoI = 0;
 
   if (sharedDataRep->outputLevel >= NORMAL_OUTPUT)
     Cout << "Imported surrogate for response '" << approxLabel
 	 << "' from file '" << filename << "'." << std::endl;
 
-  if (sharedDataRep->outputLevel >= SILENT_OUTPUT &&
-      !model->response_labels().empty()) {
-    auto imported_label = model->response_labels()[0];
+  // a model built jointly for several responses is labeled with all of them
+  const auto& imported_labels = model->response_labels();
+  if (imported_labels.size() > 1) {
+    auto label_it = std::find(imported_labels.begin(), imported_labels.end(),
+			      approxLabel);
+    if (label_it == imported_labels.end()) {
+      Cerr << "Error: Surrogate imported from file " << filename
+	   << "\ndoes not predict response '" << approxLabel << "'."
+	   << std::endl;
+      abort_handler(-1);
+    }
+    modelQoI = std::distance(imported_labels.begin(), label_it);
+  }
+  else if (sharedDataRep->outputLevel >= SILENT_OUTPUT &&
+	   !imported_labels.empty()) {
+    auto imported_label = imported_labels[0];
     if (imported_label != approxLabel)
       Cout << "\nWarning: Surrogate imported from file " << filename
 	   << "\nhas response label '" << imported_label << "'; expected '"
@@ -319,16 +333,22 @@ export_model(const StringArray& var_labels, const String& fn_label,
 
   model->variable_labels(var_labels);
 
+  // A model shared by several responses keeps their labels, which
+  // import uses to select the response
+  bool label_model = model->response_labels().size() <= 1;
+
   // This block uses prefix, label, maybe formats
   String without_extension;
   unsigned short formats;
   if(export_format) {
-    model->response_labels(StringArray(1, fn_label));
+    if (label_model)
+      model->response_labels(StringArray(1, fn_label));
     without_extension = export_prefix + "." + fn_label;
     formats = export_format;
   }
   else {
-    model->response_labels(StringArray(1, approxLabel));
+    if (label_model)
+      model->response_labels(StringArray(1, approxLabel));
     without_extension = sharedDataRep->modelExportPrefix + "." + approxLabel;
     formats = sharedDataRep->modelExportFormat;
   }
@@ -106,6 +106,10 @@ protected:
   /// The native surrogate model
   std::shared_ptr<dakota::surrogates::Surrogate> model;
 
+  /// Index of this approximation's QoI in model, which may be shared
+  /// with other approximations
+  int modelQoI = 0;
+
   /// Advanced configurations options filename
   String advanced_options_file;
 
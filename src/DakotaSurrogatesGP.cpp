@@ -15,6 +15,8 @@
 
 // Headers from Surrogates module
 #include "SurrogatesGaussianProcess.hpp"
+
+#include <algorithm>
  
 using dakota::VectorXd;
 using dakota::MatrixXd;
@@ -76,6 +78,16 @@ SurrogatesGPApprox(const ProblemDescDB& problem_db,
     std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep);
   shared_surf_data_rep->validate_metrics(allowed_metrics);
 
+  shared_surf_data_rep->gpApproximations.push_back(this);
+
+  // the options file is fixed for the life of the approximation, so
+  // read its joint build setting once rather than at every build
+  if (!advanced_options_file.empty()) {
+    auto options = Teuchos::getParametersFromYamlFile(advanced_options_file);
+    jointBuildFileOpt = options->isParameter("joint QoI build") &&
+      options->get<bool>("joint QoI build");
+  }
+
   if (problem_db.get_bool("model.surrogate.import_surrogate"))
     import_model(problem_db);
 }
@@ -114,6 +126,20 @@ SurrogatesGPApprox(const SharedApproxData& shared_data):
   //  .set("lower bound", nugget_bounds(0));
   //surrogateOpts.sublist("Nugget").sublist("Bounds")
   //  .set("upper bound", nugget_bounds(1));
+
+  std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep)->
+    gpApproximations.push_back(this);
+}
+
+
+SurrogatesGPApprox::~SurrogatesGPApprox()
+{
+  if (!sharedDataRep)
+    return;
+  auto& gp_approxs = std::static_pointer_cast<SharedSurfpackApproxData>
+    (sharedDataRep)->gpApproximations;
+  gp_approxs.erase(std::remove(gp_approxs.begin(), gp_approxs.end(), this),
+		   gp_approxs.end());
 }
 
 int
@@ -137,6 +163,26 @@ SurrogatesGPApprox::build()
   MatrixXd vars, resp;
   convert_surrogate_data(vars, resp);
 
+  gpPredictor.reset();
+  predictorModel.reset();
+
+  // adopt the model built jointly by another approximation, unless
+  // this approximation's data have changed since
+  if (jointModel) {
+    std::shared_ptr<dakota::surrogates::Surrogate> joint_model;
+    joint_model.swap(jointModel);
+    if (jointBuildVars.rows() == vars.rows() &&
+	jointBuildVars.cols() == vars.cols() && jointBuildVars == vars &&
+	jointBuildResp.size() == resp.rows() && jointBuildResp == resp.col(0)) {
+      model = joint_model;
+      modelQoI = jointModelQoI;
+      return;
+    }
+  }
+  modelQoI = 0;
+  if (joint_qoi_build() && build_joint(vars, resp))
+    return;
+
   /* DTS: Should also consider the case when we want config options to change
    * over the course of EG*-type algorithms */
 
@@ -173,20 +219,152 @@ Real SurrogatesGPApprox::prediction_variance(const Variables& vars)
   return prediction_variance(map_eval_vars(vars));
 }
 
-Real SurrogatesGPApprox::prediction_variance(const RealVector& c_vars)
+Real SurrogatesGPApprox::value(const RealVector& c_vars)
 {
   if (!model) {
-    Cerr << "Error: surface is null in SurrogatesBaseApprox::value()"
+    Cerr << "Error: surface is null in SurrogatesGPApprox::value()"
 	 << std::endl;
     abort_handler(-1);
   }
 
+  update_predictor();
   Eigen::Map<Eigen::RowVectorXd> eval_point(c_vars.values(), c_vars.length());
+  return gpPredictor->value(eval_point, *predictorWorkspace, modelQoI);
+}
 
-  auto gp_model =
-      std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model);
 
-  return gp_model->variance(eval_point)(0);
+const RealVector& SurrogatesGPApprox::gradient(const RealVector& c_vars)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesGPApprox::gradient()"
+	 << std::endl;
+    abort_handler(-1);
+  }
+
+  update_predictor();
+  const size_t num_vars = c_vars.length();
+  Eigen::Map<Eigen::RowVectorXd> eval_point(c_vars.values(), num_vars);
+  if (approxGradient.length() != num_vars)
+    approxGradient.sizeUninitialized(num_vars);
+  Eigen::Map<Eigen::RowVectorXd> pred_grad(approxGradient.values(), num_vars);
+  gpPredictor->value_and_gradient(eval_point, pred_grad, *predictorWorkspace,
+				  modelQoI);
+
+  return approxGradient;
+}
+
+
+Real SurrogatesGPApprox::prediction_variance(const RealVector& c_vars)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesGPApprox::"
+	 << "prediction_variance()" << std::endl;
+    abort_handler(-1);
+  }
+
+  update_predictor();
+  Eigen::Map<Eigen::RowVectorXd> eval_point(c_vars.values(), c_vars.length());
+  return gpPredictor->variance(eval_point, *predictorWorkspace, modelQoI);
+}
+
+
+bool SurrogatesGPApprox::joint_qoi_build() const
+{
+  if (!advanced_options_file.empty())
+    return jointBuildFileOpt;
+  return surrogateOpts.isParameter("joint QoI build") &&
+    surrogateOpts.get<bool>("joint QoI build");
+}
+
+
+/** The first GP approximation built in a round builds the GP for all
+    of them, with one column per approximation in construction order,
+    and hands each of the others its QoI; they share the hyperparameters
+    and one factorization of the Gram matrix.  The model is labeled with
+    all of the responses so that an exported copy can be imported by
+    each. */
+bool SurrogatesGPApprox::
+build_joint(const MatrixXd& vars, const MatrixXd& resp)
+{
+  const auto& gp_approxs = std::static_pointer_cast<SharedSurfpackApproxData>
+    (sharedDataRep)->gpApproximations;
+  const int num_qoi = gp_approxs.size();
+  if (num_qoi < 2)
+    return false;
+
+  MatrixXd joint_resp(vars.rows(), num_qoi);
+  StringArray labels(num_qoi);
+  MatrixXd approx_vars, approx_resp;
+  for (int q = 0; q < num_qoi; ++q) {
+    SurrogatesGPApprox* approx = gp_approxs[q];
+    if (approx == this)
+      joint_resp.col(q) = resp.col(0);
+    else {
+      approx->convert_surrogate_data(approx_vars, approx_resp);
+      if (approx_vars.rows() != vars.rows() ||
+	  approx_vars.cols() != vars.cols() || approx_vars != vars) {
+	if (sharedDataRep->outputLevel >= NORMAL_OUTPUT)
+	  Cout << "Info: GP build points differ between responses; building "
+	       << "GPs separately." << std::endl;
+	return false;
+      }
+      joint_resp.col(q) = approx_resp.col(0);
+    }
+    labels[q] = approx->approxLabel;
+  }
+
+  std::shared_ptr<dakota::surrogates::Surrogate> joint_model;
+  if (!advanced_options_file.empty())
+    joint_model.reset(new dakota::surrogates::GaussianProcess
+		      (vars, joint_resp, advanced_options_file));
+  else
+    joint_model.reset(new dakota::surrogates::GaussianProcess
+		      (vars, joint_resp, surrogateOpts));
+  joint_model->response_labels(labels);
+
+  for (int q = 0; q < num_qoi; ++q) {
+    SurrogatesGPApprox* approx = gp_approxs[q];
+    if (approx == this) {
+      model = joint_model;
+      modelQoI = q;
+    }
+    else {
+      approx->jointModel = joint_model;
+      approx->jointModelQoI = q;
+      approx->jointBuildVars = vars;
+      approx->jointBuildResp = joint_resp.col(q);
+    }
+  }
+  return true;
+}
+
+
+/** The predictor depends only on the built or imported model, so it
+    is constructed on the first evaluation after each build or import
+    and then shared by all evaluations until the next one; approximations
+    sharing a jointly built model also share its predictor. */
+void SurrogatesGPApprox::update_predictor()
+{
+  if (gpPredictor && predictorModel == model)
+    return;
+
+  gpPredictor.reset();
+  for (SurrogatesGPApprox* approx :
+	 std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep)->
+	 gpApproximations)
+    if (approx != this && approx->gpPredictor &&
+	approx->predictorModel == model) {
+      gpPredictor = approx->gpPredictor;
+      break;
+    }
+  if (!gpPredictor) {
+    auto gp_model =
+      std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model);
+    gpPredictor.reset(new dakota::surrogates::GPPredictor(*gp_model));
+  }
+  predictorWorkspace.reset
+    (new dakota::surrogates::GPPredictor::Workspace(*gpPredictor));
+  predictorModel = model;
 }
 
 void set_model_gp_options(Model& model, const String& options_file) {
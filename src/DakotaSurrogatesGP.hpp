@@ -13,13 +13,18 @@
 #include "DakotaModel.hpp"
 #include "DakotaSurrogates.hpp"
 
+// Headers from Surrogates module
+#include "SurrogatesGPPredictor.hpp"
+
 
 namespace Dakota {
 
 /// Derived approximation class for Surrogates approximation classes.
 
 /** This class interfaces Dakota to the Dakota Surrogates Gaussian
-    Process Module.  */
+    Process Module.  With the advanced option "joint QoI build", the
+    GPs of all responses sharing the approximation data are built as one
+    multi-QoI GP with shared hyperparameters.  */
 class SurrogatesGPApprox: public SurrogatesBaseApprox
 {
 public:
@@ -37,7 +42,7 @@ public:
   /// alternate constructor
   SurrogatesGPApprox(const SharedApproxData& shared_data);
   /// destructor
-  ~SurrogatesGPApprox() { }
+  ~SurrogatesGPApprox();
 
 protected:
 
@@ -47,10 +52,48 @@ protected:
   ///  Do the build
   void build() override;
 
+  Real value(const RealVector& c_vars) override;
+
+  const RealVector& gradient(const RealVector& c_vars) override;
+
   Real prediction_variance(const Variables& vars) override;
 
   Real prediction_variance(const RealVector& c_vars) override;
 
+private:
+
+  /// precompute the fast predictor for the current (built or imported)
+  /// model if not already done
+  void update_predictor();
+
+  /// whether the options request a joint build for all QoIs
+  bool joint_qoi_build() const;
+
+  /// build one GP for the QoIs of all GP approximations sharing the
+  /// approximation data; returns false if their build points differ
+  bool build_joint(const dakota::MatrixXd& vars, const dakota::MatrixXd& resp);
+
+  /// single-point predictor with precomputed weights and factors,
+  /// shared by the approximations of a jointly built model
+  std::shared_ptr<dakota::surrogates::GPPredictor> gpPredictor;
+  /// scratch storage reused by all gpPredictor evaluations
+  std::unique_ptr<dakota::surrogates::GPPredictor::Workspace>
+    predictorWorkspace;
+  /// model from which gpPredictor was constructed
+  std::shared_ptr<dakota::surrogates::Surrogate> predictorModel;
+
+  /// "joint QoI build" setting of advanced_options_file
+  bool jointBuildFileOpt = false;
+
+  /// model built jointly by another approximation, adopted by the next
+  /// build() if this approximation's data are unchanged
+  std::shared_ptr<dakota::surrogates::Surrogate> jointModel;
+  /// index of this approximation's QoI in jointModel
+  int jointModelQoI = 0;
+  /// build points of jointModel
+  dakota::MatrixXd jointBuildVars;
+  /// this approximation's build responses in jointModel
+  dakota::VectorXd jointBuildResp;
 };
 
 // free function for setting up experimental GPs with an
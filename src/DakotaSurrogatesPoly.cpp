@@ -82,6 +82,33 @@ SurrogatesPolyApprox::build()
     model.reset(new dakota::surrogates::PolynomialRegression
 	        (vars, resp, surrogateOpts));
   }
+  numBuildPoints = vars.rows();
+  buildRemovalCount = dataRemovalCount;
+}
+
+
+/** Surrogate data appended since the last (re)build are folded into the
+    polynomial's least-squares factorization, which requires the QR or
+    Cholesky solver and no data scaling.  Any other change to the data,
+    including the removal of a point (e.g., by pop_data()) since the last
+    (re)build, triggers a full build(). */
+void
+SurrogatesPolyApprox::rebuild()
+{
+  auto poly_model =
+    std::dynamic_pointer_cast<dakota::surrogates::PolynomialRegression>(model);
+  if (modelIsImported || !poly_model || !poly_model->can_append() ||
+      dataRemovalCount != buildRemovalCount)
+    { build(); return; }
+
+  MatrixXd vars, resp;
+  convert_surrogate_data(vars, resp);
+  Eigen::Index num_new = vars.rows() - (Eigen::Index)numBuildPoints;
+  if (num_new <= 0)
+    { build(); return; }
+
+  poly_model->append(vars.bottomRows(num_new), resp.bottomRows(num_new));
+  numBuildPoints = vars.rows();
 }
 
 
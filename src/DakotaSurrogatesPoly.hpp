@@ -45,6 +45,19 @@ protected:
   ///  Do the build
   void build() override;
 
+  /// append new surrogate data to the existing least-squares
+  /// factorization when supported, else build()
+  void rebuild() override;
+
+  //
+  //- Heading: Data
+  //
+
+  /// number of data points in the polynomial's least-squares problem
+  size_t numBuildPoints = 0;
+  /// Approximation::dataRemovalCount as of the last (re)build
+  size_t buildRemovalCount = 0;
+
 };
 
 } // namespace Dakota
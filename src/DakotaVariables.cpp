@@ -198,6 +198,11 @@ Variables::Variables(const Variables& vars):
 { /* empty ctor */ }
 
 
+Variables::Variables(Variables&& vars) noexcept:
+  variablesRep(std::move(vars.variablesRep))
+{ /* empty ctor */ }
+
+
 Variables Variables::operator=(const Variables& vars)
 {
   variablesRep = vars.variablesRep;
@@ -205,6 +210,13 @@ Variables Variables::operator=(const Variables& vars)
 }
 
 
+Variables& Variables::operator=(Variables&& vars) noexcept
+{
+  variablesRep = std::move(vars.variablesRep);
+  return *this;
+}
+
+
 Variables::~Variables()
 { /* empty dtor */ }
 
@@ -1018,10 +1030,15 @@ bool operator==(const Variables& vars1, const Variables& vars2)
 
 /// hash_value for Variables - required by the new BMI hash_set of PRPairs
 std::size_t hash_value(const Variables& vars)
+{ return hash_value(vars, 0); }
+
+
+/** A nonzero seed yields a hash that is (practically) independent of
+    the unseeded one, as used for ParamResponsePair fingerprints. */
+std::size_t hash_value(const Variables& vars, std::size_t seed)
 {
   // this function is a friend of Variables
 
-  std::size_t seed = 0;
   // require identical views and variables data
   std::shared_ptr<Variables> v_rep = vars.variablesRep;
   boost::hash_combine(seed, v_rep->sharedVarsData.view());
@@ -138,6 +138,9 @@ class Variables
 
   /// hash_value
   friend std::size_t hash_value(const Variables& vars);
+  /// hash_value continuing from an initial seed, for forming
+  /// independent hashes of the same variables
+  friend std::size_t hash_value(const Variables& vars, std::size_t seed);
 
 public:
 
@@ -155,12 +158,16 @@ public:
   explicit Variables(const SharedVariablesData& svd);
   /// copy constructor
   Variables(const Variables& vars);
+  /// move constructor (transfers the letter without reference counting)
+  Variables(Variables&& vars) noexcept;
 
   /// destructor
   virtual ~Variables();
 
   /// assignment operator
   Variables operator=(const Variables& vars);
+  /// move assignment operator
+  Variables& operator=(Variables&& vars) noexcept;
 
   //
   //- Heading: Virtual functions
@@ -29,7 +29,9 @@ DataInterfaceRep::DataInterfaceRep():
   evalCacheFlag(true), nearbyEvalCacheFlag(false),
   nearbyEvalCacheTol(DBL_EPSILON), // default relative tolerance is tight
   restartFileFlag(true), useWorkdir(false), dirTag(false),
-  dirSave(false), templateReplace(false), numpyFlag(false)
+  dirSave(false), templateReplace(false), workdirPrestage(false),
+  numpyFlag(false),
+  numpyBatchArrays(false)
   // asynchLocal{Eval,Analysis}Concurrency, procsPer{Eval,Analysis} and
   // {eval,analysis}Servers default to zero in order to allow detection of
   // user overrides > 0
@@ -50,7 +52,8 @@ void DataInterfaceRep::write(MPIPackBuffer& s) const
     << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
     << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateReplace << workdirPrestage << pluginLibraryPath
+    << numpyFlag << numpyBatchArrays;
 }
 
 
@@ -68,7 +71,8 @@ void DataInterfaceRep::read(MPIUnpackBuffer& s)
     >> recoveryFnVals >> activeSetVectorFlag >> evalCacheFlag
     >> nearbyEvalCacheFlag >> nearbyEvalCacheTol >> restartFileFlag
     >> useWorkdir >> workDir >> dirTag >> dirSave >> linkFiles
-    >> copyFiles >> templateReplace >> pluginLibraryPath >> numpyFlag;
+    >> copyFiles >> templateReplace >> workdirPrestage >> pluginLibraryPath
+    >> numpyFlag >> numpyBatchArrays;
 }
 
 
@@ -86,7 +90,8 @@ void DataInterfaceRep::write(std::ostream& s) const
     << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
     << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateReplace << workdirPrestage << pluginLibraryPath
+    << numpyFlag << numpyBatchArrays;
 }
 
 
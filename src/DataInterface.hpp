@@ -226,10 +226,15 @@ public:
   StringArray copyFiles;
   /// whether to replace / overwrite existing files
   bool templateReplace;
+  /// whether to populate per-evaluation work directories in the
+  /// background ahead of need (see WorkdirPool)
+  bool workdirPrestage;
   /// path to plugin to runtime load
   String pluginLibraryPath;
   /// Python interface: use NumPy data structures (default is list data)
   bool numpyFlag;
+  /// Python interface: pass a batch as whole-batch NumPy arrays
+  bool numpyBatchArrays;
 
 private:
 
@@ -22,12 +22,14 @@ DataMethodRep::DataMethodRep():
   maxRefineIterations(SZ_MAX), maxSolverIterations(SZ_MAX),
   maxFunctionEvals(SZ_MAX), speculativeFlag(false), methodUseDerivsFlag(false),
   constraintTolerance(0.), methodScaling(false), numFinalSolutions(0),
+  evaluationWindow(0),
   convergenceTolerance(-std::numeric_limits<double>::max()),
   relativeConvMetric(true), statsMetricMode(Pecos::DEFAULT_EXPANSION_STATS),
   methodName(DEFAULT_METHOD), subMethod(SUBMETHOD_DEFAULT),
   // Meta-iterators
   iteratorServers(0), procsPerIterator(0), // 0 defaults to detect user spec
-  iteratorScheduling(DEFAULT_SCHEDULING), hybridLSProb(0.1),
+  iteratorScheduling(DEFAULT_SCHEDULING), iteratorThreads(0),
+  hybridLSProb(0.1),
   //hybridProgThresh(0.5),
   concurrentRandomJobs(0),
   // Local surrogate-based opt/NLS
@@ -141,7 +143,8 @@ DataMethodRep::DataMethodRep():
   expansionSamples(SZ_MAX),  ensemblePilotSolnMode(ONLINE_PILOT),
   pilotGroupSampling(SHARED_PILOT), groupThrottleType(NO_GROUP_THROTTLE),
   groupSizeThrottle(USHRT_MAX), rCondBestThrottle(SZ_MAX),
-  rCondTolThrottle(DBL_MAX), truthPilotConstraint(false),
+  rCondTolThrottle(DBL_MAX), pseudoInvThreads(0),
+  truthPilotConstraint(false),
   dagRecursionType(NO_GRAPH_RECURSION), dagDepthLimit(USHRT_MAX),
   modelSelectType(NO_MODEL_SELECTION), relaxFixedFactor(0.),
   relaxRecursiveFactor(0.), allocationTarget(TARGET_MEAN),
@@ -215,6 +218,7 @@ DataMethodRep::DataMethodRep():
   diliSesExpRank(2),
   diliSesOversFactor(2),
   diliSesBlockSize(2),
+  muqNumChains(1),
   // Parameter Study
   numSteps(0), pstudyFileFormat(TABULAR_ANNOTATED), pstudyFileActive(false),
   // Verification
@@ -235,12 +239,14 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << maxIterations << maxRefineIterations << maxSolverIterations
     << maxFunctionEvals << speculativeFlag << methodUseDerivsFlag
     << constraintTolerance << methodScaling << numFinalSolutions
+    << evaluationWindow
     << convergenceTolerance << relativeConvMetric << statsMetricMode
     << methodName << subMethod << subMethodName << subModelPointer
     << subMethodPointer;
 
   // Meta-iterators
   s << iteratorServers << procsPerIterator << iteratorScheduling
+    << iteratorThreads
     << hybridMethodNames << hybridModelPointers << hybridMethodPointers
   //<< hybridProgThresh
     << hybridGlobalMethodName << hybridGlobalModelPointer
@@ -358,7 +364,8 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << optSubProbSolver << numericalSolveMode << pilotSamples
     << ensemblePilotSolnMode << pilotGroupSampling << groupThrottleType
     << groupSizeThrottle << rCondBestThrottle << rCondTolThrottle
-    << truthPilotConstraint << dagRecursionType << dagDepthLimit
+    << pseudoInvThreads << truthPilotConstraint << dagRecursionType
+    << dagDepthLimit
     << modelSelectType << relaxFactorSequence << relaxFixedFactor
     << relaxRecursiveFactor << allocationTarget
     << useTargetVarianceOptimizationFlag
@@ -409,6 +416,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << diliSesExpRank
     << diliSesOversFactor
     << diliSesBlockSize
+    << muqNumChains
     << dataDistType << dataDistCovInputType << dataDistMeans
     << dataDistCovariance << dataDistFile << posteriorDensityExportFilename
     << posteriorSamplesExportFilename << posteriorSamplesImportFilename
@@ -436,12 +444,14 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> maxIterations >> maxRefineIterations >> maxSolverIterations
     >> maxFunctionEvals >> speculativeFlag >> methodUseDerivsFlag
     >> constraintTolerance >> methodScaling >> numFinalSolutions
+    >> evaluationWindow
     >> convergenceTolerance >> relativeConvMetric >> statsMetricMode
     >> methodName >> subMethod >> subMethodName >> subModelPointer
     >> subMethodPointer;
 
   // Meta-iterators
   s >> iteratorServers >> procsPerIterator >> iteratorScheduling
+    >> iteratorThreads
     >> hybridMethodNames >> hybridModelPointers >> hybridMethodPointers
   //>> hybridProgThresh
     >> hybridGlobalMethodName >> hybridGlobalModelPointer
@@ -559,7 +569,8 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> optSubProbSolver >> numericalSolveMode >> pilotSamples
     >> ensemblePilotSolnMode >> pilotGroupSampling >> groupThrottleType
     >> groupSizeThrottle >> rCondBestThrottle >> rCondTolThrottle
-    >> truthPilotConstraint >> dagRecursionType >> dagDepthLimit
+    >> pseudoInvThreads >> truthPilotConstraint >> dagRecursionType
+    >> dagDepthLimit
     >> modelSelectType >> relaxFactorSequence >> relaxFixedFactor
     >> relaxRecursiveFactor >> allocationTarget
     >> useTargetVarianceOptimizationFlag
@@ -610,6 +621,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> diliSesExpRank
     >> diliSesOversFactor
     >> diliSesBlockSize
+    >> muqNumChains
     >> dataDistType >> dataDistCovInputType >> dataDistMeans
     >> dataDistCovariance >> dataDistFile >> posteriorDensityExportFilename
     >> posteriorSamplesExportFilename >> posteriorSamplesImportFilename
@@ -637,12 +649,14 @@ void DataMethodRep::write(std::ostream& s) const
     << maxIterations << maxRefineIterations << maxSolverIterations
     << maxFunctionEvals << speculativeFlag << methodUseDerivsFlag
     << constraintTolerance << methodScaling << numFinalSolutions
+    << evaluationWindow
     << convergenceTolerance << relativeConvMetric << statsMetricMode
     << methodName << subMethod << subMethodName << subModelPointer
     << subMethodPointer;
 
   // Meta-iterators
   s << iteratorServers << procsPerIterator << iteratorScheduling
+    << iteratorThreads
     << hybridMethodNames << hybridModelPointers << hybridMethodPointers
   //<< hybridProgThresh
     << hybridGlobalMethodName << hybridGlobalModelPointer
@@ -760,7 +774,8 @@ void DataMethodRep::write(std::ostream& s) const
     << optSubProbSolver << numericalSolveMode << pilotSamples
     << ensemblePilotSolnMode << pilotGroupSampling << groupThrottleType
     << groupSizeThrottle << rCondBestThrottle << rCondTolThrottle
-    << truthPilotConstraint << dagRecursionType << dagDepthLimit
+    << pseudoInvThreads << truthPilotConstraint << dagRecursionType
+    << dagDepthLimit
     << modelSelectType << relaxFactorSequence << relaxFixedFactor
     << relaxRecursiveFactor << allocationTarget
     << useTargetVarianceOptimizationFlag
@@ -811,6 +826,7 @@ void DataMethodRep::write(std::ostream& s) const
     << diliSesExpRank
     << diliSesOversFactor
     << diliSesBlockSize
+    << muqNumChains
     << dataDistType << dataDistCovInputType << dataDistMeans
     << dataDistCovariance << dataDistFile << posteriorDensityExportFilename
     << posteriorSamplesExportFilename << posteriorSamplesImportFilename
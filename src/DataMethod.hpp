@@ -352,6 +352,10 @@ public:
   bool methodScaling;
   /// number of final solutions returned from the iterator
   size_t numFinalSolutions;
+  /// bound on the number of in-flight evaluations when an Analyzer
+  /// streams its parameter sets (from the \c evaluation_window
+  /// specification); 0 for no bound
+  size_t evaluationWindow;
 
   /// iteration convergence tolerance for the method (from the \c
   /// convergence_tolerance specification in \ref MethodIndControl)
@@ -385,6 +389,10 @@ public:
   /// type of scheduling ({DEFAULT,MASTER,PEER}_SCHEDULING) used in concurrent
   /// iterator parallelism (from the \c iterator_scheduling specification)
   short iteratorScheduling;
+  /// number of shared-memory threads for concurrent iterator execution
+  /// within a single iterator server (from the \c iterator_threads
+  /// specification)
+  int iteratorThreads;
 
   /// array of methods for the sequential and collaborative hybrid
   /// meta-iterators (from the \c method_name_list specification)
@@ -1117,6 +1125,11 @@ public:
   /// lower bound on group covariance conditioning (rcond is inverse of
   /// condition number)
   Real rCondTolThrottle;
+  /// number of threads for the independent group covariance
+  /// (pseudo-)inverses in ML BLUE (from the \c pseudo_inverse_threads
+  /// specification; 0 defaults to the hardware threads available to
+  /// each process on its node)
+  int pseudoInvThreads;
   /// the \c truth_fixed_by_pilot flag for ACV methods
   bool truthPilotConstraint;
   /// option specified for extent of DAG enumeration within
@@ -1422,6 +1435,9 @@ public:
   /// DILI stochastic eigensolver block size
   int diliSesBlockSize;
 
+  /// number of independent MUQ chains run in lockstep
+  int muqNumChains;
+
   // Parameter Study
 
   /// the \c final_point specification in \ref MethodPSVPS
@@ -20,7 +20,7 @@ namespace Dakota {
 extern PRPCache data_pairs; // global container
 
 /// initialization of static needed by RecastModel
-DataTransformModel* DataTransformModel::dtModelInstance(NULL);
+thread_local DataTransformModel* DataTransformModel::dtModelInstance(NULL);
 
 // BMA TODO:
 // * Construct with the Iterator's verbosity or the Model's?  Models
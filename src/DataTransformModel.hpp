@@ -236,7 +236,7 @@ protected:
   ExperimentData& expData;
 
   /// static pointer to this class for use in static callbacks
-  static DataTransformModel* dtModelInstance;
+  static thread_local DataTransformModel* dtModelInstance;
 
   /// Number of calibrated variance multipliers
   size_t numHyperparams;
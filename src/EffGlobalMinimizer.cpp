@@ -30,7 +30,7 @@
 
 namespace Dakota {
 
-EffGlobalMinimizer* EffGlobalMinimizer::effGlobalInstance(NULL);
+thread_local EffGlobalMinimizer* EffGlobalMinimizer::effGlobalInstance(NULL);
 
 
 EffGlobalMinimizer::
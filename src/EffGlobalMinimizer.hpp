@@ -252,7 +252,7 @@ private:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static EffGlobalMinimizer* effGlobalInstance;
+  static thread_local EffGlobalMinimizer* effGlobalInstance;
 
   // controls iteration mode: "model" (normal usage) or "user_functions"
   // (user-supplied functions mode for "on the fly" instantiations).
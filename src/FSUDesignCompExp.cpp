@@ -193,8 +193,10 @@ void FSUDesignCompExp::pre_run()
 
   // If VBD has been selected, generate a series of replicate parameter sets
   // (each of the size specified by the user) in order to compute VBD metrics.
+  // Unless all data is retained, the A_B^i replicates are streamed within
+  // core_run().
   if (vbdFlag && vbdViaSamplingMethod==VBD_PICK_AND_FREEZE)
-    get_vbd_parameter_sets(iteratedModel, numSamples);
+    get_vbd_parameter_sets(iteratedModel, numSamples, !allDataFlag);
   else
     get_parameter_sets(iteratedModel);
 }
@@ -205,7 +207,11 @@ void FSUDesignCompExp::core_run()
   bool compute_corr_flag = (!subIteratorFlag),
     log_resp_flag = (allDataFlag || compute_corr_flag),
     log_best_flag = (numObjFns || numLSqTerms); // opt or NLS data set
-  evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
+  if (vbdStreamFlag) // VBD indices are accumulated block by block
+    evaluate_vbd_parameter_sets(iteratedModel, numSamples,
+				pStudyDACESensGlobal, log_best_flag);
+  else
+    evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
 }
 
 
@@ -226,14 +232,16 @@ void FSUDesignCompExp::post_run(std::ostream& s)
 
   // BMA TODO: always compute all stats, even in VBD mode (stats on
   // first two replicates)
-  if (vbdFlag)
-    pStudyDACESensGlobal.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
-                                                        vbdViaSamplingNumBins,
-                                                        numFunctions,
-                                                        numContinuousVars + numDiscreteIntVars + numDiscreteRealVars,
-                                                        numSamples,
-                                                        allSamples,
-                                                        allResponses);
+  if (vbdFlag) {
+    if (!vbdStreamFlag) // else computed within core_run()
+      pStudyDACESensGlobal.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
+                                                          vbdViaSamplingNumBins,
+                                                          numFunctions,
+                                                          numContinuousVars + numDiscreteIntVars + numDiscreteRealVars,
+                                                          numSamples,
+                                                          allSamples,
+                                                          allResponses);
+  }
   else {
     // compute correlation statistics if (compute_corr_flag)
     bool compute_corr_flag = (!subIteratorFlag);
@@ -147,8 +147,15 @@ create_analysis_process(bool block_flag, bool new_group)
 
   // Default to vfork unless a user override to fork; fall-through to fork 
   // if needed
+  // A vfork child shares the parent address space, which the prestaging
+  // thread of a WorkdirPool may modify concurrently; use fork in that case.
 #if !defined(DAKOTA_PREFER_FORK) && defined(HAVE_WORKING_VFORK)
-  pid = vfork();  // replicate this process
+#ifdef HAVE_WORKING_FORK
+  if (workdirPool)
+    pid = fork();
+  else
+#endif
+    pid = vfork();  // replicate this process
 #elif defined(HAVE_WORKING_FORK)
   pid = fork();   // replicate this process
 #else
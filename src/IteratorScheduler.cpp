@@ -25,7 +25,8 @@ IteratorScheduler(ParallelLibrary& parallel_lib, bool peer_assign_jobs,
   parallelLib(parallel_lib), numIteratorJobs(1),
   numIteratorServers(num_servers), procsPerIterator(procs_per_iterator),
   iteratorCommRank(0), iteratorCommSize(1), iteratorServerId(0),
-  messagePass(false), iteratorScheduling(scheduling),//maxIteratorConcurrency(1)
+  numIteratorThreads(1), messagePass(false),
+  iteratorScheduling(scheduling),//maxIteratorConcurrency(1)
   peerAssignJobs(peer_assign_jobs), paramsMsgLen(0), resultsMsgLen(0)
 {
   // Supported examples of a single level of concurrent iterators:
@@ -449,6 +450,30 @@ run_iterator(Iterator& sub_iterator, ParLevLIter pl_iter)
 }
 
 
+/** Threaded counterpart to the iterator rank 0 portion of
+    run_iterator() for single-processor iterator servers: there are no
+    servers to stop and communicator resizing is not supported, since
+    parallel configuration updates are shared among threads. */
+void IteratorScheduler::
+run_iterator_thread(Iterator& sub_iterator, ParLevLIter pl_iter)
+{
+  Model& sub_model = sub_iterator.iterated_model();
+  if (sub_model.initialize_mapping(pl_iter)) {
+    Cerr << "Error: variable resizing is not supported for threaded "
+	 << "iterator scheduling." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+
+  sub_iterator.run(); // communicators set by thread_schedule_iterators()
+
+  if (sub_model.finalize_mapping()) {
+    Cerr << "Error: variable resizing is not supported for threaded "
+	 << "iterator scheduling." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+}
+
+
 /** This is a convenience function for encapsulating the deallocation
     of communicators after running an iterator. */
 void IteratorScheduler::
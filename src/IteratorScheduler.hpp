@@ -13,6 +13,11 @@
 //#include "Scheduler.hpp"
 #include "DataMethod.hpp"
 #include "ParallelLibrary.hpp"
+#include "util_common.hpp"
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <thread>
 
 
 namespace Dakota {
@@ -79,6 +84,11 @@ public:
   /// convenience function for deallocating comms after running an iterator
   static void free_iterator(Iterator& sub_iterator, ParLevLIter pl_iter);
 
+  /// Convenience function for running one of several independent
+  /// iterator replicas on a worker thread.  Communicators must already
+  /// be set (see thread_schedule_iterators()).
+  static void run_iterator_thread(Iterator& sub_iterator, ParLevLIter pl_iter);
+
   //
   //- Heading: Member functions
   //
@@ -141,6 +151,12 @@ public:
   template <typename MetaType>
   void peer_static_schedule_iterators(MetaType& meta_object,
 				      Iterator& sub_iterator);
+  /// executed within a single iterator server to manage a dynamic
+  /// schedule of iterator jobs among threads, each owning one of the
+  /// independent sub_iterators
+  template <typename MetaType>
+  void thread_schedule_iterators(MetaType& meta_object,
+				 IteratorArray& sub_iterators);
 
   /// update schedPCIter
   void update(ParConfigLIter pc_iter);
@@ -170,6 +186,8 @@ public:
   int   iteratorCommRank;   ///< processor rank in iteratorComm
   int   iteratorCommSize;   ///< number of processors in iteratorComm
   int   iteratorServerId;   ///< identifier for an iterator server
+  int   numIteratorThreads; ///< number of shared-memory threads executing
+                            ///< iterator jobs within an iterator server
 
   bool  messagePass;        ///< flag for message passing among iterator servers
   short iteratorScheduling; ///< {DEFAULT,MASTER,PEER}_SCHEDULING
@@ -496,6 +514,85 @@ peer_static_schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
 }
 
 
+/** Jobs are assigned dynamically to the first idle thread, where each
+    thread runs its own Iterator/Model replica.  Results are updated by
+    job index and console output is buffered per job and replayed in job
+    order, such that the output does not depend on the thread schedule.
+    Evaluations are tagged by job, such that replicas using tagged
+    parameters/results files or work directories do not collide. */
+template <typename MetaType> void IteratorScheduler::
+thread_schedule_iterators(MetaType& meta_object, IteratorArray& sub_iterators)
+{
+  // restores the parallel configuration on exit, including the propagation
+  // of an exception from one of the threads
+  struct ParConfigRestore {
+    ParallelLibrary& parLib; ParConfigLIter pcIter;
+    ~ParConfigRestore() { parLib.parallel_configuration_iterator(pcIter); }
+  } pc_restore{parallelLib, parallelLib.parallel_configuration_iterator()};
+  parallelLib.parallel_configuration_iterator(
+    meta_object.parallel_configuration_iterator());
+
+  int i, num_threads
+    = std::min((int)sub_iterators.size(), std::min(numIteratorThreads,
+						   numIteratorJobs));
+  Cout << "Thread schedule: executing " << numIteratorJobs
+       << " iterator jobs on " << num_threads << " threads\n";
+
+  // parallel configuration updates within set_communicators() are not
+  // thread safe: activate comms for each replica prior to launch
+  ParLevLIter pl_iter = schedPCIter->mi_parallel_level_iterator(miPLIndex);
+  for (i=0; i<num_threads; ++i)
+    sub_iterators[i].set_communicators(pl_iter);
+
+  String tag_prefix = parallelLib.output_manager().build_output_tag();
+  std::vector<std::ostringstream> job_output(numIteratorJobs);
+  std::vector<std::exception_ptr> thread_except(num_threads);
+  std::atomic<int> job_cntr(0);
+  // threaded work within a sub-iterator shares this thread's allotment
+  int threads_per_job
+    = std::max(dakota::util::available_threads() / num_threads, 1);
+  auto thread_fn = [&](int thread_index) {
+    dakota::util::ThreadBudget job_budget(threads_per_job);
+    try {
+      int job_index;
+      Iterator& sub_iterator = sub_iterators[thread_index];
+      while ( (job_index = job_cntr++) < numIteratorJobs ) {
+	// thread-specific redirection of Cout/Cerr
+	dakota_thread_cout = dakota_thread_cerr = &job_output[job_index];
+	sub_iterator.eval_tag_prefix(tag_prefix + "." +
+				     std::to_string(job_index+1));
+	meta_object.initialize_iterator(job_index, thread_index);
+	run_iterator_thread(sub_iterator, pl_iter);
+	meta_object.update_local_results(job_index, thread_index);
+      }
+    }
+    catch (...)
+      { thread_except[thread_index] = std::current_exception(); }
+    dakota_thread_cout = dakota_thread_cerr = NULL;
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (i=0; i<num_threads; ++i)
+    threads.emplace_back(thread_fn, i);
+  for (i=0; i<num_threads; ++i)
+    threads[i].join();
+
+  // restore the shared replica's tag for any subsequent serial use
+  sub_iterators[0].eval_tag_prefix(tag_prefix);
+
+  // replay output in job order, independent of thread schedule
+  for (i=0; i<numIteratorJobs; ++i)
+    Cout << "\n----------------------\nParameter set " << i+1
+	 << " thread output:\n----------------------\n"
+	 << job_output[i].str();
+  Cout << std::flush;
+  for (i=0; i<num_threads; ++i)
+    if (thread_except[i])
+      std::rethrow_exception(thread_except[i]);
+}
+
+
 /** This function is similar in structure to
     ApplicationInterface::serve_evaluations_synch(). */
 template <typename MetaType> void IteratorScheduler::
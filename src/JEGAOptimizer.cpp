@@ -121,6 +121,7 @@ Includes
 #include <../Utilities/include/SingleObjectiveStatistician.hpp>
 
 #include <algorithm>
+#include <map>
 #include <sstream>
 
 /*
@@ -297,6 +298,22 @@ class JEGAOptimizer::Evaluator :
             Design& into
             ) const;
 
+        /**
+         * \brief Collects the asynchronous evaluations of a group,
+         *        recording each into its Design as it is collected.
+         *
+         * Completions already available are collected without blocking;
+         * the remainder of the group is collected with a blocking
+         * synchronize().
+         *
+         * \param pending The Designs awaiting responses keyed by their
+         *                evaluation ids.
+         */
+        void
+        CollectResponses(
+            std::map<int, Design*>& pending
+            );
+
         /// Returns the number of non-linear constraints for the problem.
         /**
          * This is computed by adding the number of non-linear equality
@@ -2095,6 +2112,59 @@ JEGAOptimizer::Evaluator::RecordResponses(
     }
 }
 
+void
+JEGAOptimizer::Evaluator::CollectResponses(
+    std::map<int, Design*>& pending
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    const DesignTarget& target = this->GetDesignTarget();
+
+    // Completions are collected without blocking while any are available.
+    // The Model offers no blocking wait for a single completion, so once a
+    // nonblocking pass returns nothing, the remaining evaluations are
+    // collected with a blocking synchronize().
+    // synchronize_nowait() is not supported with finite differencing.
+    bool blocking = this->_model.derivative_estimation();
+    while(!pending.empty())
+    {
+        const IntResponseMap& response_map = blocking ?
+            this->_model.synchronize() : this->_model.synchronize_nowait();
+        if(response_map.empty())
+        {
+            blocking = true;
+            continue;
+        }
+
+        this->IncrementNumberEvaluations(response_map.size());
+
+        for(IntRespMCIter r_cit=response_map.begin();
+            r_cit!=response_map.end(); ++r_cit)
+        {
+            std::map<int, Design*>::iterator p_it(pending.find(r_cit->first));
+            if(p_it == pending.end())
+            {
+                Cerr << "\nError: JEGA evaluator received a response for "
+                     << "evaluation " << r_cit->first << ",\n       which "
+                     << "does not correspond to a pending Design." << std::endl;
+                abort_handler(METHOD_ERROR);
+            }
+            Design& des = *p_it->second;
+            pending.erase(p_it);
+
+            // Put the responses into the Design properly.
+            this->RecordResponses(r_cit->second.function_values(), des);
+
+            // Label this guy as now being evaluated.
+            des.SetEvaluated(true);
+
+            // now check the feasibility of this design
+            target.CheckFeasibility(des);
+        }
+    }
+}
+
 bool
 JEGAOptimizer::Evaluator::Evaluate(
     DesignGroup& group
@@ -2150,6 +2220,9 @@ JEGAOptimizer::Evaluator::Evaluate(
     // designs wind up evaluated and non-illconditioned.
     bool ret = true;
 
+    // Designs queued for asynchronous evaluation, by evaluation id.
+    std::map<int, Design*> pending;
+
     for(; it!=e; ++it)
     {
         // If this Design is evaluated, let's skip it.
@@ -2196,6 +2269,7 @@ JEGAOptimizer::Evaluator::Evaluate(
             // Active set vector which is to just compute
             // function values, no gradients or hessians.
             this->_model.evaluate_nowait();
+            pending[this->_model.evaluation_id()] = *it;
         }
         else
         {
@@ -2238,44 +2312,9 @@ JEGAOptimizer::Evaluator::Evaluate(
 
     // If we did our evaluations asynchronously, we did not yet record
     // the results (because they were not available).  We need to do so
-    // now.  The call to _model.synchronize causes the program to block
-    // until all the results are available.  We can then record the
-    // responses in the same fashion as above.  Note that the linear
-    // constraints have already been computed!!
-    if(this->_model.asynch_flag())
-    {
-        // Wait for the responses.
-        const IntResponseMap& response_map = this->_model.synchronize();
-        size_t num_resp = response_map.size();
-
-        // increment the number of evaluations by the number of responses
-        this->IncrementNumberEvaluations(num_resp);
-
-        EDDY_ASSERT(num_resp == numEvalReqs);
-
-        // prepare to access the elements of the response_map by iterator.
-        IntRespMCIter r_cit = response_map.begin();
-
-        // Record the set of responses in the DesignGroup
-        for(it=group.BeginDV(); it!=e; ++it)
-        {
-            // we didn't send already-evaluated Designs out for evaluation
-            // so skip them here as well.
-            if((*it)->IsEvaluated()) continue;
-
-            // Put the responses into the Design properly.
-            this->RecordResponses(r_cit->second.function_values(), **it);
-
-            // Label this guy as now being evaluated.
-            (*it)->SetEvaluated(true);
-
-            // now check the feasibility of this design
-            target.CheckFeasibility(**it);
-
-	    // only increment for newly evaluated points contained in response_map
-	    ++r_cit;
-        }
-    }
+    // now, in the same fashion as above, as each evaluation completes.
+    // Note that the linear constraints have already been computed!!
+    if(!pending.empty()) this->CollectResponses(pending);
 
     return ret;
 }
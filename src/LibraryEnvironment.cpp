@@ -11,15 +11,22 @@
 #include "LibraryEnvironment.hpp"
 #include "ProblemDescDB.hpp"
 #include "DakotaInterface.hpp"
+#include "IteratorScheduler.hpp"
+#include "PRPMultiIndex.hpp"
+#include <mutex>
+#include <shared_mutex>
 
 static const char rcsId[]="@(#) $Id: LibraryEnvironment.cpp 6492 2009-12-19 00:04:28Z briadam $";
 
 
 namespace Dakota {
 
+extern PRPCache data_pairs; // global container
+extern std::shared_timed_mutex data_pairs_mutex;
+
 
 LibraryEnvironment::LibraryEnvironment():
-  Environment(BaseConstructor())
+  Environment(BaseConstructor()), executedFlag(false)
 { }
 
 
@@ -28,7 +35,7 @@ LibraryEnvironment::LibraryEnvironment():
 LibraryEnvironment::
 LibraryEnvironment(ProgramOptions prog_opts, bool check_bcast_construct,
 		   DbCallbackFunctionPtr callback, void* callback_data):
-  Environment(BaseConstructor(), prog_opts)
+  Environment(BaseConstructor(), prog_opts), executedFlag(false)
 {
   preprocess_inputs();
 
@@ -49,7 +56,8 @@ LibraryEnvironment::
 LibraryEnvironment(MPI_Comm dakota_mpi_comm, 
 		   ProgramOptions prog_opts, bool check_bcast_construct,
 		   DbCallbackFunctionPtr callback, void* callback_data):
-  Environment(BaseConstructor(), prog_opts, dakota_mpi_comm)
+  Environment(BaseConstructor(), prog_opts, dakota_mpi_comm),
+  executedFlag(false)
 { 
   preprocess_inputs();
 
@@ -91,6 +99,91 @@ void LibraryEnvironment::done_modifying_db()
 }
 
 
+void LibraryEnvironment::execute()
+{
+  Environment::execute();
+  executedFlag = true;
+}
+
+
+/** Sampling iterators treat the spec as a lower bound on samples, so
+    the reference is updated prior to the reset.  Flags match those of
+    a top-level study (statistics, but no retained sample history). */
+void LibraryEnvironment::num_samples(size_t samples)
+{
+  topLevelIterator.sampling_reference(samples);
+  topLevelIterator.sampling_reset(samples, false, true);
+}
+
+
+/** Clearing the evaluation cache (the global data_pairs, shared by all
+    interfaces) prevents updated bounds or data from being satisfied by
+    duplicates from a previous request.  Evaluation counters are reset
+    for every interface instance in the DB, such that evaluation ids
+    and the evaluation summary restart for each request; this should
+    be combined with a cache reset, since the cache is keyed by id.
+    Restarted ids repeat those of earlier restart records unless the
+    restart file is also truncated (RESET_RESTART), retaining only the
+    evaluations of the next request.  Must not be called while
+    asynchronous evaluations are pending. */
+void LibraryEnvironment::reset(unsigned short reset_flags)
+{
+  if (reset_flags & RESET_EVALUATION_CACHE) {
+    std::lock_guard<std::shared_timed_mutex> cache_lock(data_pairs_mutex);
+    data_pairs.clear();
+  }
+
+  if (reset_flags & RESET_EVALUATION_COUNTERS) {
+    InterfaceList interfaces = filtered_interface_list("", "");
+    for (InterfLIter il_iter = interfaces.begin();
+	 il_iter != interfaces.end(); ++il_iter)
+      il_iter->reset_evaluation_counters();
+  }
+
+  if (reset_flags & RESET_RESTART)
+    outputManager.truncate_restart();
+
+  // closing the stream causes graphics initialization in rerun() to
+  // truncate the tabular data file and write a new header
+  if (reset_flags & RESET_TABULAR_OUTPUT) {
+    outputManager.close_tabular_datastream();
+    outputManager.graphics_counter(1);
+  }
+
+  if (reset_flags & RESET_RESULTS_OUTPUT)
+    outputManager.init_results_db();
+}
+
+
+/** Unlike execute(), the DB is not relocked, usage is not re-tracked,
+    and graphics are only reinitialized when tabular output is reset,
+    so a warm rerun costs little beyond the iterator run itself.  The
+    first call delegates to execute().  Iterator state is not reset:
+    in particular, a sampling iterator continues its random number
+    sequence unless its seed is fixed (\c fixed_seed) or updated by
+    random_seed(). */
+void LibraryEnvironment::rerun(unsigned short reset_flags)
+{
+  if (topLevelIterator.is_null()) {
+    Cerr << "Error: LibraryEnvironment::rerun() requires a constructed "
+	 << "top-level iterator." << std::endl;
+    abort_handler(-1);
+  }
+  if (!executedFlag)
+    { execute(); return; }
+
+  reset(reset_flags);
+
+  if ( (reset_flags & RESET_TABULAR_OUTPUT) &&
+       (topLevelIterator.method_name() & PARALLEL_BIT) == 0 &&
+       parallelLib.world_rank() == 0 )
+    topLevelIterator.initialize_graphics();
+
+  ParLevLIter w_pl_iter = parallelLib.w_parallel_level_iterator();
+  IteratorScheduler::run_iterator(topLevelIterator, w_pl_iter);
+}
+
+
 /** DEPRECATED raw pointer API; assumes memory ownership is
     transferred to Dakota as API historically did. */
 bool LibraryEnvironment::plugin_interface(const String& model_type,
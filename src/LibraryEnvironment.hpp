@@ -25,7 +25,12 @@ namespace Dakota {
 class LibraryEnvironment: public Environment
 {
 public:
-  
+
+  /// state reset selectively by reset() and rerun(); combine bitwise
+  enum { RESET_NONE = 0, RESET_EVALUATION_CACHE = 1,
+	 RESET_EVALUATION_COUNTERS = 2, RESET_TABULAR_OUTPUT = 4,
+	 RESET_RESULTS_OUTPUT = 8, RESET_RESTART = 16, RESET_ALL = 31 };
+
   //
   //- Heading: Constructors and destructor
   //
@@ -57,7 +62,9 @@ public:
   //- Heading: Virtual function redefinitions
   //
 
-  //void execute(); // base class implementation is sufficient
+  /// execute the top-level iterator for the first time, initializing
+  /// results and graphics output
+  void execute();
 
   //
   //- Heading: Member functions
@@ -99,6 +106,29 @@ public:
 				const String& interf_type,
 				const String& an_driver);
 
+  /// return the top-level iterator for updates between rerun() calls
+  Iterator& top_level_iterator();
+  /// return the model iterated by the top-level iterator
+  Model& top_level_model();
+
+  /// update the continuous bounds of the top-level model
+  void continuous_bounds(const RealVector& l_bnds, const RealVector& u_bnds);
+  /// update the random seed of the top-level iterator (reruns repeat
+  /// a sample set for an unchanged seed only with fixed_seed)
+  void random_seed(int seed);
+  /// update the number of samples of a sampling top-level iterator
+  void num_samples(size_t samples);
+
+  /// reset the evaluation cache, interface evaluation counters,
+  /// restart file, and tabular or results output, as selected by
+  /// reset_flags
+  void reset(unsigned short reset_flags);
+
+  /// rerun the constructed top-level iterator without reparsing or
+  /// reconstruction, after applying reset(reset_flags)
+  void rerun(unsigned short reset_flags
+	     = RESET_EVALUATION_CACHE | RESET_EVALUATION_COUNTERS);
+
 private:
 
   //
@@ -109,8 +139,31 @@ private:
   //- Heading: Data members
   //
 
+  /// whether execute() has initialized results and graphics output
+  bool executedFlag;
 };
 
+
+inline Iterator& LibraryEnvironment::top_level_iterator()
+{ return topLevelIterator; }
+
+
+inline Model& LibraryEnvironment::top_level_model()
+{ return topLevelIterator.iterated_model(); }
+
+
+inline void LibraryEnvironment::
+continuous_bounds(const RealVector& l_bnds, const RealVector& u_bnds)
+{
+  Model& model = top_level_model();
+  model.continuous_lower_bounds(l_bnds);
+  model.continuous_upper_bounds(u_bnds);
+}
+
+
+inline void LibraryEnvironment::random_seed(int seed)
+{ topLevelIterator.random_seed(seed); }
+
 } // namespace Dakota
 
 #endif
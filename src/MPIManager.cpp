@@ -7,8 +7,11 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#include <algorithm>
 #include <cctype>
+#include <thread>
 #include "dakota_system_defs.hpp"
+#include "util_common.hpp"
 #include "MPIManager.hpp"
 #include "dakota_data_types.hpp"
 #include "dakota_global_defs.hpp"
@@ -18,7 +21,7 @@ namespace Dakota {
 
 MPIManager::MPIManager():
   dakotaMPIComm(MPI_COMM_WORLD), dakotaWorldRank(0), dakotaWorldSize(1),
-  mpirunFlag(false), ownMPIFlag(false)
+  dakotaNodeSize(1), mpirunFlag(false), ownMPIFlag(false)
 {
   // MPI check for library clients not passing any options or MPI
   // comm, since that will invoke this default ctor.  
@@ -32,6 +35,7 @@ MPIManager::MPIManager():
     mpirunFlag = true;
     MPI_Comm_rank(dakotaMPIComm, &dakotaWorldRank);
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
+    init_node_size();
   }
 #endif
 }
@@ -39,7 +43,7 @@ MPIManager::MPIManager():
 
 MPIManager::MPIManager(int& argc, char**& argv):
   dakotaMPIComm(MPI_COMM_WORLD), dakotaWorldRank(0), dakotaWorldSize(1),
-  mpirunFlag(false), ownMPIFlag(false)
+  dakotaNodeSize(1), mpirunFlag(false), ownMPIFlag(false)
 {
   // detect parallel launch of DAKOTA using mpirun/mpiexec/poe/etc.
   mpirunFlag = detect_parallel_launch(argc, argv);
@@ -53,6 +57,7 @@ MPIManager::MPIManager(int& argc, char**& argv):
     ownMPIFlag = true; // own MPI_Init, so call MPI_Finalize in destructor 
     MPI_Comm_rank(dakotaMPIComm, &dakotaWorldRank);
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
+    init_node_size();
   }
 #endif
 }
@@ -60,7 +65,7 @@ MPIManager::MPIManager(int& argc, char**& argv):
 
 MPIManager::MPIManager(MPI_Comm dakota_mpi_comm):
   dakotaMPIComm(dakota_mpi_comm), dakotaWorldRank(0), dakotaWorldSize(1),
-  mpirunFlag(false), ownMPIFlag(false)
+  dakotaNodeSize(1), mpirunFlag(false), ownMPIFlag(false)
 {
 #ifdef DAKOTA_HAVE_MPI
   // Do not initialize MPI, but check if initialized and get data on rank/size.
@@ -70,11 +75,35 @@ MPIManager::MPIManager(MPI_Comm dakota_mpi_comm):
     mpirunFlag = true;
     MPI_Comm_rank(dakotaMPIComm, &dakotaWorldRank);
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
+    init_node_size();
   }
 #endif
 }
 
 
+/** Processes of dakotaMPIComm that can share memory are assumed to
+    share a node (and its hardware threads).  Threaded work started by
+    this process is restricted to its share through
+    util::available_threads(). */
+void MPIManager::init_node_size()
+{
+#if defined(DAKOTA_HAVE_MPI) && MPI_VERSION >= 3
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(dakotaMPIComm, MPI_COMM_TYPE_SHARED, dakotaWorldRank,
+		      MPI_INFO_NULL, &node_comm);
+  MPI_Comm_size(node_comm, &dakotaNodeSize);
+  MPI_Comm_free(&node_comm);
+#else
+  dakotaNodeSize = 1;
+#endif
+
+  if (dakotaNodeSize > 1) {
+    int num_hw = std::max(1u, std::thread::hardware_concurrency());
+    dakota::util::set_process_threads(std::max(num_hw / dakotaNodeSize, 1));
+  }
+}
+
+
 MPIManager::~MPIManager()
 {
 #ifdef DAKOTA_HAVE_MPI
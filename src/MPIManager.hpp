@@ -55,6 +55,8 @@ public:
   int world_size() const;
   /// true when Dakota is running in MPI mode
   bool mpirun_flag() const;
+  /// get the number of Dakota processes sharing this node
+  int node_size() const;
   
   /// detect parallel launch of Dakota using mpirun/mpiexec/poe/etc.
   /// based on command line arguments and environment variables
@@ -62,9 +64,14 @@ public:
  
 private:
 
+  /// determine dakotaNodeSize from dakotaMPIComm and divide the node's
+  /// hardware threads among its Dakota processes
+  void init_node_size();
+
   MPI_Comm dakotaMPIComm; ///< MPI_Comm on which DAKOTA is running
   int dakotaWorldRank;    ///< rank in MPI_Comm in which DAKOTA is running
   int dakotaWorldSize;    ///< size of MPI_Comm in which DAKOTA is running
+  int dakotaNodeSize;     ///< number of Dakota processes sharing this node
   bool mpirunFlag;        ///< flag for a parallel mpirun/yod launch
   bool ownMPIFlag;        ///< flag for ownership of MPI_Init/MPI_Finalize
 
@@ -83,6 +90,9 @@ inline int MPIManager::world_size() const
 inline bool MPIManager::mpirun_flag() const 
 { return mpirunFlag; }
 
+inline int MPIManager::node_size() const
+{ return dakotaNodeSize; }
+
 }  // namespace Dakota
 
 #endif // DAKOTA_MPI_MANAGER_H
@@ -8,7 +8,10 @@
     _______________________________________________________________________ */
 
 #include "MorseSmaleComplex.hpp"
+#include "util_common.hpp"
+#include <algorithm>
 #include <map>
+#include <thread>
 #include <vector>
 // From the Dionysus package
 #include "topology/persistence-diagram.h"
@@ -19,17 +22,20 @@
 
 //using namespace std;
 
+int MS_Complex::NumThreads(size_t num_tasks)
+{
+	int limit = std::min(MS_MAX_THREADS, dakota::util::available_threads());
+	return (int)std::min<size_t>(num_tasks, limit);
+}
+
 ///////////////////////////////////////////////////
 //Vertex
 //////////////////////////////////////////////////
-Vertex::Vertex(int n, double *p, double _val, int _id)
+Vertex::Vertex(int n, const double *p, double _val, int _id)
 {
 	d = n;
-	x = new double[n];
-	for(int i=0; i < n; i++)
-		x[i] = p[i];
+	x = p;
 
-	e = -1;
 	PC_UF_min = PC_UF_max = UF_min = UF_max = ID = _id;
 	persistence = 0;
 	val = _val;
@@ -41,34 +47,6 @@ double Vertex::GetXi(int i)
 	return x[i];
 }
 
-int Vertex::GetIthNeighbor(int i, KNN_Edge * E[])
-{
-	int neighborID = E[this->e]->end;
-	int nextKNN_EdgeID = E[this->e]->nextKNN_Edge;
-	for(int j = 0; j < i; j++)
-	{
-		if(nextKNN_EdgeID != -1)
-		{
-			neighborID = E[nextKNN_EdgeID]->end;
-			nextKNN_EdgeID = E[nextKNN_EdgeID]->nextKNN_Edge;
-		}
-		else
-		{
-			neighborID = -1;
-		}
-	}
-	return neighborID;
-}
-
-void Vertex::CreateANNpoint(ANNpoint &p)
-{
-	if(p != NULL)
-		delete [] p;
-	p = new ANNcoord[d];
-	for(int i = 0; i < d; i++)
-		p[i] = this->x[i];
-}
-
 void Vertex::Union_Max(Vertex * v, Vertex * V[])
 {
 	Vertex *a = V[this->Find_Max(V)];
@@ -156,37 +134,20 @@ void Vertex::ResetExtrema()
 	persistence = 0;
 }
 double Vertex::Value() { return val; }
-Vertex::Vertex(Vertex &v)
+Vertex::Vertex(const Vertex &v)
 {
 	classification = v.classification;
 	d = v.d;
-	e = v.e;
 	ID = v.ID;
 	PC_UF_max = v.PC_UF_max;
 	PC_UF_min = v.PC_UF_min;
 	UF_max = v.UF_max;
-	UF_min = v.UF_max;
+	UF_min = v.UF_min;
 	val = v.val;
-	x = new double[d];
-	for(int i = 0; i < d; i++)
-		x[i] = v.x[i];
+	x = v.x;
 	persistence = 0;
 }
-Vertex::~Vertex() { delete [] x; }
-///////////////////////////////////////////////////
-//KNN_Edge
-//////////////////////////////////////////////////
-KNN_Edge::KNN_Edge(Vertex * _start, Vertex * _end, KNN_Edge * E[], int id)
-{
-	ID = id;
-	E[id] = this;
-
-	start = _start->ID;
-	end = _end->ID;
-
-	this->nextKNN_Edge = _start->e;
-	_start->e = id;
-}
+Vertex::~Vertex() { }
 ///////////////////////////////////////////////////
 //Crystal
 //////////////////////////////////////////////////
@@ -322,17 +283,13 @@ MS_Complex::MS_Complex(double  *points, int dimension, int count, int _k, bool p
   perturbed = perturb;
 	d = dimension-1;
 	numKneighbors = _k;
-	szV = numV = count;
-	//szE = szV*numKneighbors;
-  //Edges should be bi-directional
-	szE = szV*szV;
-
-	V = new Vertex *[szV];
-	E = new KNN_Edge *[szE];
+	numV = count;
+	SearchStructure = NULL;
 
 	// NOTE: Not removing use of srand/rand as code likely to be retired
   srand(8);
-	double *p = new double[dimension];
+	coords.resize((size_t)numV*d);
+	std::vector<double> values(numV);
 	for(int i=0; i < count; i++)
 	{
     double eps = (double)rand() / (double)RAND_MAX;
@@ -340,12 +297,11 @@ MS_Complex::MS_Complex(double  *points, int dimension, int count, int _k, bool p
     if(rand() > RAND_MAX / 2)
       eps = -eps;
 
-		for(int j = 0; j < dimension; j++)
-			p[j] = points[i*dimension+j];
-    p[dimension-1] += (perturbed ? eps : 0);
-		V[i] = new Vertex(d, p, p[d], i);
-	}	
-	delete [] p;
+		for(int j = 0; j < d; j++)
+			coords[(size_t)i*d+j] = points[i*dimension+j];
+    values[i] = points[i*dimension+d] + (perturbed ? eps : 0);
+	}
+	InitVertices(values.data());
 
 //  std::cout << "numV=" << numV << std::endl;
 //  std::cout << "d=" << d << std::endl;
@@ -356,83 +312,272 @@ MS_Complex::MS_Complex(double  *points, int dimension, int count, int _k, bool p
   maxDist = -1;
 }
 
+/** Adds new_point to a copy of Complex.  The neighbor rows of existing
+    vertices change only where the new point is closer than their current
+    k-th neighbor, and steepest ascent/descent is recomputed only for
+    vertices whose neighborhoods changed; the remaining flow is reused. */
 MS_Complex::MS_Complex(MS_Complex &Complex, double  *new_point)
 {
   perturbed = Complex.perturbed;
   d = Complex.d;
   numKneighbors = Complex.numKneighbors;
-	szV = numV = Complex.numV + 1;
-	//szE = szV*numKneighbors;
-  szE = szV*szV;
+	numV = Complex.numV + 1;
+	SearchStructure = NULL;
 
-	V = new Vertex *[szV];
-	E = new KNN_Edge *[szE];
-	
-	double *p = new double[d+1];
-	for(int i=0; i < Complex.numV; i++)
-	{
-		for(int j = 0; j < d; j++)
-			p[j] = Complex.V[i]->GetXi(j);
-    p[d] = Complex.V[i]->Value();
-		V[i] = new Vertex(d, p, p[d], i);
-	}	
+	int numOld = Complex.numV, newID = numV-1, K = numKneighbors;
+	coords.reserve((size_t)numV*d);
+	coords = Complex.coords;
+	coords.insert(coords.end(), new_point, new_point+d);
+	std::vector<double> values(numV);
+	for(int i=0; i < numOld; i++)
+		values[i] = Complex.V[i]->Value();
 
   double eps = (double)rand() / (double)RAND_MAX;
   eps = eps * 1e-6;
   if(rand() > RAND_MAX / 2)
     eps = -eps;
 
-  V[numV-1] = new Vertex(d, new_point, new_point[d] + (perturbed ? eps : 0), numV-1);
-	delete [] p;
-	KNN();
+	values[newID] = new_point[d] + (perturbed ? eps : 0);
+	InitVertices(values.data());
+
+	// Without the search structure and full neighbor rows of the original
+	// complex, build the new one from scratch
+	if(Complex.SearchStructure == NULL || numOld <= K ||
+	   Complex.knnIds.size() != (size_t)numOld*K)
+	{
+		KNN();
+		Compute();
+		maxDist = -1;
+		return;
+	}
+
+	// The new vertex is not in the original search structure, so its own
+	// k nearest neighbors are found directly
+	knnIds = Complex.knnIds;
+	knnSqDists = Complex.knnSqDists;
+	knnIds.resize((size_t)numV*K);
+	knnSqDists.resize((size_t)numV*K);
+	double *q = coords.data() + (size_t)newID*d;
+	Complex.SearchStructure->annkSearch(q, K, &knnIds[(size_t)newID*K],
+		&knnSqDists[(size_t)newID*K]);
+
+	// Existing vertices take the new one into their sorted rows only if it
+	// is closer than their current k-th neighbor
+	auto insertNewNeighbor = [&](int vStart, int vEnd)
+	{
+		for(int v = vStart; v < vEnd; v++)
+		{
+			const double *x = coords.data() + (size_t)v*d;
+			double sDist = 0;
+			for(int j = 0; j < d; j++)
+				sDist += (x[j]-q[j])*(x[j]-q[j]);
+
+			int *ids = &knnIds[(size_t)v*K];
+			double *sDists = &knnSqDists[(size_t)v*K];
+			if(sDist < sDists[K-1])
+			{
+				int k = K-1;
+				for( ; k > 0 && sDists[k-1] > sDist; k--)
+				{
+					ids[k] = ids[k-1];
+					sDists[k] = sDists[k-1];
+				}
+				ids[k] = newID;
+				sDists[k] = sDist;
+			}
+		}
+	};
+	int numThreads = 1;
+	if((size_t)numOld*d >= 65536)
+		numThreads = NumThreads(numOld);
+	if(numThreads > 1)
+	{
+		std::vector<std::thread> threads;
+		int chunk = (numOld + numThreads - 1) / numThreads;
+		for(int vStart = 0; vStart < numOld; vStart += chunk)
+			threads.emplace_back(insertNewNeighbor, vStart,
+				std::min(vStart + chunk, numOld));
+		for(size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+	}
+	else
+		insertNewNeighbor(0, numOld);
+
+	BuildNeighborGraph();
+
+	// Reuse the steepest ascent/descent of vertices with unchanged neighbors
+	if(Complex.steepestAscent.size() == (size_t)numOld &&
+	   Complex.steepestDescent.size() == (size_t)numOld)
+	{
+		steepestAscent = Complex.steepestAscent;
+		steepestDescent = Complex.steepestDescent;
+		steepestAscent.push_back(newID);
+		steepestDescent.push_back(newID);
+
+		std::vector<int> changed(1, newID);
+		for(int v = 0; v < numOld; v++)
+		{
+			int begin = neighborOffsets[v], count = NumNeighbors(v),
+				oldBegin = Complex.neighborOffsets[v];
+			if(count != Complex.NumNeighbors(v) ||
+			   !std::equal(neighborIds.begin()+begin,
+				       neighborIds.begin()+begin+count,
+				       Complex.neighborIds.begin()+oldBegin))
+				changed.push_back(v);
+		}
+		ComputeGradientFlow(changed);
+	}
+
 	Compute();
   maxDist = -1;
 }
 
+void MS_Complex::InitVertices(const double *values)
+{
+	vertexStore.clear();
+	vertexStore.reserve(numV);
+	V = new Vertex *[numV];
+	for(int i = 0; i < numV; i++)
+	{
+		vertexStore.emplace_back(d, coords.data() + (size_t)i*d, values[i], i);
+		V[i] = &vertexStore[i];
+	}
+}
+
 void MS_Complex::KNN()
 {
-	int eIndex = 0;
-	int i,k;
+	int i,j,k;
+
+	annPoints.resize(numV);
+	for(i = 0; i < numV; i++)
+		annPoints[i] = coords.data() + (size_t)i*d;
 
-	ANNpointArray pa = new ANNpoint[numV];
+	delete SearchStructure;
+	SearchStructure = new ANNkd_tree(annPoints.data(),numV,d);
+
+	// ANN keeps its search state in globals, so the queries are made in a
+	// single batch on this thread, writing straight into the neighbor rows
+	int numQuery = std::min(numKneighbors+1, numV);
+	std::vector<ANNidx> nn_idx(numQuery);
+	std::vector<ANNdist> dists(numQuery);
+	knnIds.assign((size_t)numV*numKneighbors, -1);
+	knnSqDists.assign((size_t)numV*numKneighbors, 0.);
 	for(i = 0; i < numV; i++)
 	{
-		pa[i] = NULL;
-		V[i]->CreateANNpoint(pa[i]);
+		SearchStructure->annkSearch(annPoints[i],numQuery,nn_idx.data(),
+			dists.data());
+
+		//Skip the query point itself (normally the first hit)
+		for(j = 0, k = 0; j < numQuery && k < numKneighbors; j++)
+		{
+			if(nn_idx[j] == i)
+				continue;
+			knnIds[(size_t)i*numKneighbors+k] = nn_idx[j];
+			knnSqDists[(size_t)i*numKneighbors+k] = dists[j];
+			k++;
+		}
 	}
 
-	SearchStructure = new ANNkd_tree(pa,numV,d);
-	ANNidxArray nn_idx;
-	ANNdistArray dists;
-	for(i = 0; i < numV; i++)
-	{		
-		nn_idx = new ANNidx[numKneighbors+1];
-		dists = new ANNdist[numKneighbors+1];
+	BuildNeighborGraph();
+	steepestAscent.clear();
+	steepestDescent.clear();
+}
 
-		SearchStructure->annkSearch(pa[i],numKneighbors+1,nn_idx,dists);
+/** Edges should be bi-directional: v and w are adjacent if either is
+    among the k nearest neighbors of the other. */
+void MS_Complex::BuildNeighborGraph()
+{
+	int i,k;
+	std::vector<int> offsets(numV+1, 0);
+	for(i = 0; i < numV; i++)
+		for(k = 0; k < numKneighbors; k++)
+		{
+			int j = knnIds[(size_t)i*numKneighbors+k];
+			if(j < 0)
+				continue;
+			offsets[i+1]++;
+			offsets[j+1]++;
+		}
+	for(i = 0; i < numV; i++)
+		offsets[i+1] += offsets[i];
 
-		for(k=1;k<numKneighbors+1;k++)
+	std::vector<int> ids(offsets[numV]);
+	std::vector<int> fill(offsets.begin(), offsets.end()-1);
+	for(i = 0; i < numV; i++)
+		for(k = 0; k < numKneighbors; k++)
 		{
-      if(!DoesEdgeExist(i, nn_idx[k], eIndex))
-      {
-			  E[eIndex] = new KNN_Edge(V[i],V[nn_idx[k]],E, eIndex);
-			  eIndex++;
-      }
-      if(!DoesEdgeExist(nn_idx[k],i, eIndex))
-      {
-			  E[eIndex] = new KNN_Edge(V[nn_idx[k]],V[i],E, eIndex);
-			  eIndex++;
-      }
+			int j = knnIds[(size_t)i*numKneighbors+k];
+			if(j < 0)
+				continue;
+			ids[fill[i]++] = j;
+			ids[fill[j]++] = i;
 		}
-		delete [] nn_idx;
-		delete [] dists;
-	}
 
+	//Drop the duplicates of mutual neighbors
+	neighborOffsets.assign(numV+1, 0);
+	neighborIds.clear();
+	neighborIds.reserve(ids.size());
 	for(i = 0; i < numV; i++)
-		delete [] pa[i];
+	{
+		std::vector<int>::iterator first = ids.begin()+offsets[i],
+			last = ids.begin()+offsets[i+1];
+		std::sort(first, last);
+		neighborIds.insert(neighborIds.end(), first, std::unique(first, last));
+		neighborOffsets[i+1] = neighborIds.size();
+	}
+	numE = neighborIds.size();
+}
 
-	delete [] pa;
-	numE = eIndex;
+/** The steepest neighbor of each vertex depends only on its own
+    neighborhood, so large sets of vertices are split over threads. */
+void MS_Complex::ComputeGradientFlow(const std::vector<int> &vertices)
+{
+	steepestAscent.resize(numV);
+	steepestDescent.resize(numV);
+
+	auto flow = [&](size_t iStart, size_t iEnd)
+	{
+		for(size_t i = iStart; i < iEnd; i++)
+		{
+			int v = vertices[i];
+			double maximum = V[v]->Value();
+			double minimum = V[v]->Value();
+			int steepestA = v;
+			int steepestD = v;
+			for(int e = neighborOffsets[v]; e < neighborOffsets[v+1]; e++)
+			{
+				int n = neighborIds[e];
+				double value = V[n]->Value();
+				if(value > maximum || (value == maximum && n > v))
+				{
+					maximum = value;
+					steepestA = n;
+				}
+				if(value < minimum || (value == minimum && n < v))
+				{
+					minimum = value;
+					steepestD = n;
+				}
+			}
+			steepestAscent[v] = steepestA;
+			steepestDescent[v] = steepestD;
+		}
+	};
+
+	size_t numVerts = vertices.size(), numThreads = 1;
+	if(numVerts >= 4096)
+		numThreads = NumThreads(numVerts / 1024);
+	if(numThreads > 1)
+	{
+		std::vector<std::thread> threads;
+		size_t chunk = (numVerts + numThreads - 1) / numThreads;
+		for(size_t iStart = 0; iStart < numVerts; iStart += chunk)
+			threads.emplace_back(flow, iStart, std::min(iStart + chunk, numVerts));
+		for(size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+	}
+	else
+		flow(0, numVerts);
 }
 
 void MS_Complex::Compute()
@@ -442,6 +587,14 @@ void MS_Complex::Compute()
 	int minCount=0;
 	double globalMax = V[0]->Value();
 	double globalMin = V[0]->Value();
+	if(steepestAscent.size() != (size_t)numV ||
+	   steepestDescent.size() != (size_t)numV)
+	{
+		std::vector<int> allVertices(numV);
+		for(i = 0; i < numV; i++)
+			allVertices[i] = i;
+		ComputeGradientFlow(allVertices);
+	}
 	for(i = 0; i < numV; i++)
 	{
 		Vertex *v = V[i];
@@ -451,45 +604,8 @@ void MS_Complex::Compute()
 		if(globalMin > v->Value())
 			globalMin = v->Value();
 
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-		//for(int j = 0; j < numKneighbors; j++)
-    j = 0;
-    while(v->GetIthNeighbor(j,E) != -1)
-		{
-			//neighbors[j] = V[v->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[v->GetIthNeighbor(j,E)]);
-      j++;
-		}
-
-		double maximum = v->Value();
-		double minimum = v->Value();
-		Vertex *steepestA = v;
-		Vertex *steepestD = v;
-
-		//for(int j = 0; j < numKneighbors; j++)
-    j = 0;
-    while(v->GetIthNeighbor(j,E) != -1)
-		{
-			Vertex *currentNeighbor = neighbors[j];
-
-			if(currentNeighbor->Value() > maximum ||
-				(currentNeighbor->Value() == maximum &&
-				 currentNeighbor->ID > v->ID))
-			{
-				maximum = currentNeighbor->Value();
-				steepestA = currentNeighbor;
-			}
-
-			if(currentNeighbor->Value() < minimum  ||
-				(currentNeighbor->Value() == minimum &&
-				 currentNeighbor->ID < v->ID))
-			{
-				minimum = currentNeighbor->Value();
-				steepestD = currentNeighbor;
-			}
-      j++;
-		}
+		Vertex *steepestA = V[steepestAscent[i]];
+		Vertex *steepestD = V[steepestDescent[i]];
 		if(steepestA == v)
 		{
 			v->classification = LOCAL_MAX;
@@ -503,8 +619,16 @@ void MS_Complex::Compute()
 
 		v->Union_Max(steepestA, V);
 		v->Union_Min(steepestD, V);
+	}
 
-		//delete [] neighbors;
+	//Resolve the ascending and descending manifold of every vertex once;
+	// the saddle and crystal passes below only read these
+	std::vector<int> maxManifold(numV);
+	std::vector<int> minManifold(numV);
+	for(i = 0; i < numV; i++)
+	{
+		maxManifold[i] = V[i]->Find_Max(V);
+		minManifold[i] = V[i]->Find_Min(V);
 	}
 
 	//Go through each vertex, examine its neighbors, if maxima are different, create or update the entry in a map
@@ -517,22 +641,10 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MAX || V[i]->classification == LOCAL_MIN)
 			continue;
 
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-    j = 0;
-    
-		//for(int j = 0; j < numKneighbors; j++)
-    while(V[i]->GetIthNeighbor(j,E) != -1)
+		for(int e = neighborOffsets[i]; e < neighborOffsets[i+1]; e++)
 		{
-			//neighbors[j] = V[V[i]->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[V[i]->GetIthNeighbor(j,E)]);
-      j++;
-		}
-		//for(int Bindex = 0; Bindex < numKneighbors; Bindex++)
-    for(int Bindex = 0; Bindex < j; Bindex++)
-		{
-			int AmaxIndex = V[i]->Find_Max(V);
-			int BmaxIndex = neighbors[Bindex]->Find_Max(V);
+			int AmaxIndex = maxManifold[i];
+			int BmaxIndex = maxManifold[neighborIds[e]];
 
 			if(AmaxIndex != BmaxIndex)
 			{
@@ -549,7 +661,6 @@ void MS_Complex::Compute()
 				}
 			}
 		}
-		//delete [] neighbors;
 	}
 	//Saddles between Minima
 	std::map<std::pair<int, int>, int> minSaddles = std::map<std::pair<int, int>, int>();
@@ -558,23 +669,10 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MAX || V[i]->classification == LOCAL_MIN)
 			continue;
 
-		//Vertex **neighbors = new Vertex *[numKneighbors];
-    std::vector<Vertex *> neighbors;
-    j = 0;
-		//for(int j = 0; j < numKneighbors; j++)
-    while(V[i]->GetIthNeighbor(j,E) != -1)
-		{
-			//neighbors[j] = V[V[i]->GetIthNeighbor(j,E)];
-      neighbors.push_back(V[V[i]->GetIthNeighbor(j,E)]);
-      j++;
-		}
-
-		int Bindex = 0;
-		//for(; Bindex < numKneighbors; Bindex++)
-    for(; Bindex < j; Bindex++)
+		for(int e = neighborOffsets[i]; e < neighborOffsets[i+1]; e++)
 		{
-			int AminIndex = V[i]->Find_Min(V);
-			int BminIndex = neighbors[Bindex]->Find_Min(V);
+			int AminIndex = minManifold[i];
+			int BminIndex = minManifold[neighborIds[e]];
 
 			if(AminIndex != BminIndex)
 			{
@@ -591,7 +689,6 @@ void MS_Complex::Compute()
 				}
 			}
 		}
-		//delete [] neighbors;
 	}
 
 	///////////////////////
@@ -701,8 +798,8 @@ void MS_Complex::Compute()
 		if(V[i]->classification == LOCAL_MIN || V[i]->classification == LOCAL_MAX)
 			continue;
 
-		int minI = V[i]->Find_Min(V);
-		int maxI = V[i]->Find_Max(V);
+		int minI = minManifold[i];
+		int maxI = maxManifold[i];
 		std::pair<int,int> minMaxPair = std::pair<int,int>(minI,maxI);
 		if(Crystals.find(minMaxPair) == Crystals.end())
 		{
@@ -1341,36 +1438,25 @@ double MS_Complex::FarFromSaddle(double *v, double p)
 
 MS_Complex::~MS_Complex()
 {
-	for(int i = 0; i < numV; i++)
-		delete V[i];
-	delete [] V;
-	for(int i = 0; i < numE; i++)
-		delete E[i];
-	delete [] E;
-	for(int i = 0; i < numC; i++)
-		delete C[i];
-	delete [] C;
-	
-	delete [] V_to_C;
-  delete [] persistences;
-	delete SearchStructure;
+	Destroy();
 }
 
 void MS_Complex::Destroy()
 {
-	for(int i = 0; i < numV; i++)
-		delete V[i];
 	delete [] V;
-	for(int i = 0; i < numE; i++)
-		delete E[i];
-	delete [] E;
-	for(int i = 0; i < numC; i++)
-		delete C[i];
+	V = NULL;
+	if(C != NULL)
+		for(int i = 0; i < numC; i++)
+			delete C[i];
 	delete [] C;
+	C = NULL;
 	
 	delete [] V_to_C;
+	V_to_C = NULL;
   delete [] persistences;
+	persistences = NULL;
 	delete SearchStructure;
+	SearchStructure = NULL;
 }
 
 int MS_Complex::GetIthHighestPersistence(int i)
@@ -1474,13 +1560,13 @@ Vertex *   MS_Complex::GetVertex(int i)
 
 double ScoreTOPOB(MS_Complex &C1, double *x)
 {
-  MS_Complex C2 = MS_Complex(C1,x);
+  MS_Complex C2(C1,x);
   return C1.CompareBottleneck(C2);
 }
 
 double ScoreTOPOP(MS_Complex &C1, double *x)
 {
-  MS_Complex C2 = MS_Complex(C1,x);
+  MS_Complex C2(C1,x);
   return C1.ComparePersistenceNoSaddles(C2);
 }
 
@@ -1648,11 +1734,15 @@ void MS_Complex::Draw(double gMin, double gMax,bool flatMode)
 
 	glLineWidth(1.0);
 	glBegin(GL_LINES);
-	for(int i = 0; i < numE; i++)
+	for(int i = 0; i < numV; i++)
 	{
-		glColor3f(0.25,0.25,0.25);
-		glVertex3f(V[E[i]->start]->GetXi(0),V[E[i]->start]->GetXi(1), flatMode ? 0 : ((V[E[i]->start]->Value()-gMin)/(gMax-gMin) - 1./2.));
-		glVertex3f(V[E[i]->end]->GetXi(0),  V[E[i]->end]->GetXi(1),  flatMode ? 0 : ((V[E[i]->end]->Value()-gMin)/(gMax-gMin) - 1./2.));
+		for(int k = 0; k < NumNeighbors(i); k++)
+		{
+			int j = GetIthNeighbor(i, k);
+			glColor3f(0.25,0.25,0.25);
+			glVertex3f(V[i]->GetXi(0),V[i]->GetXi(1), flatMode ? 0 : ((V[i]->Value()-gMin)/(gMax-gMin) - 1./2.));
+			glVertex3f(V[j]->GetXi(0),V[j]->GetXi(1), flatMode ? 0 : ((V[j]->Value()-gMin)/(gMax-gMin) - 1./2.));
+		}
 	}
 	glEnd();
 
@@ -1679,9 +1769,9 @@ void MS_Complex::Draw(double gMin, double gMax,bool flatMode)
     glEnable(GL_BLEND);
 		glColor3f(0,0,0);
 		glLineWidth(6.0);
-		for(int k = 0; k < numKneighbors; k++)
+		for(int k = 0; k < NumNeighbors(i); k++)
 		{
-			int nextIdx = curV->GetIthNeighbor(k, E);
+			int nextIdx = GetIthNeighbor(i, k);
 			Vertex *nextV = V[nextIdx];
 			if(nextIdx == curV->NeighborMax() || nextIdx == curV->NeighborMin())
 			{
@@ -26,35 +26,34 @@
 #define SADDLE 2
 #define REGULAR 3
 
-class KNN_Edge;
+// limit on worker threads within util::available_threads(): the vertex
+// loops are memory bound, so more threads add contention rather than speed
+#define MS_MAX_THREADS 8
 
 class Vertex
 {
 public:
-	Vertex(int n, double *p, double _val, int _id);
-	void CreateANNpoint(ANNpoint &p);
+	Vertex(int n, const double *p, double _val, int _id);
 	double GetXi(int i);
 	void Union_Max(Vertex * v, Vertex * V[]);
 	int Find_Max(Vertex * V[]);
 	void Union_Min(Vertex * v, Vertex * V[]);
 	int Find_Min(Vertex * V[]);
-	int GetIthNeighbor(int i, KNN_Edge * E[]);
 	void ResetExtrema();
 	double Value();
   double SDistance(Vertex *v);
-	Vertex(Vertex &v);
+	Vertex(const Vertex &v);
 	~Vertex();
 
 	int NeighborMax() { return UF_max;}
 	int NeighborMin() { return UF_min;}
 
-	int e;
 	int classification;		//0 = minimum, 1=maximmum, 2=saddle, 3=regular
 	int ID;
 	double persistence;
 
 private:
-	double *x;
+	const double *x; //row of the owning complex's coordinate array
 	double val;
 	int d;
 	int UF_max; //The neighboring maximumm
@@ -72,15 +71,6 @@ struct Saddle
 	Saddle *next;
 };
 
-class KNN_Edge
-{
-public:
-	KNN_Edge(Vertex * _start, Vertex * _end, KNN_Edge * E[], int id);
-	int ID;
-	int start,end;
-	int nextKNN_Edge;
-};
-
 class MS_Crystal
 {
 public:
@@ -118,11 +108,8 @@ public:
 	void Compute();
   void Print(std::ostream &out);
 	Vertex * *V;
-	KNN_Edge * *E;
 	MS_Crystal * *C;
 	//Saddle * *S;
-	int szV;
-	int szE;
 	int numV;
 	int numE;
 	int numC;
@@ -136,6 +123,12 @@ public:
   double maxDist;
 	int szP;
 
+  /// number of vertices adjacent to vertex v in the symmetric kNN graph
+  int NumNeighbors(int v) { return neighborOffsets[v+1] - neighborOffsets[v]; }
+  /// the i-th neighbor of vertex v, or -1 if v has fewer neighbors
+  int GetIthNeighbor(int v, int i)
+  { return (i < NumNeighbors(v)) ? neighborIds[neighborOffsets[v]+i] : -1; }
+
 #ifdef USING_GL
 	void Draw(double gMin, double gMax,bool flatMode);
 	void DrawBurst();
@@ -168,14 +161,33 @@ public:
   int CountSaddles(double p=0);
 
 private:
+  /// number of worker threads for num_tasks independent tasks
+  static int NumThreads(size_t num_tasks);
+
+  void InitVertices(const double *values);
+  void BuildNeighborGraph();
+  void ComputeGradientFlow(const std::vector<int> &vertices);
+
   bool perturbed;
-  bool DoesEdgeExist(int v1, int v2, int maxIndex)
-  {
-    for(int i = 0; i < maxIndex; i++)
-      if(E[i]->start == v1 && E[i]->end == v2)
-        return true;
-    return false;
-  }
+
+  /// vertex coordinates, one row of d values per vertex
+  std::vector<double> coords;
+  /// vertices in one block; V holds pointers into it
+  std::vector<Vertex> vertexStore;
+  /// per-vertex rows of the numKneighbors nearest neighbors, ascending by
+  /// distance, and their squared distances
+  std::vector<int>    knnIds;
+  std::vector<double> knnSqDists;
+  /// symmetric kNN graph in compressed sparse row form: the neighbors of
+  /// vertex v are neighborIds[neighborOffsets[v]..neighborOffsets[v+1])
+  std::vector<int> neighborOffsets;
+  std::vector<int> neighborIds;
+  /// neighbor of steepest ascent/descent per vertex (itself at a maximum/minimum)
+  std::vector<int> steepestAscent;
+  std::vector<int> steepestDescent;
+
+  /// query points for SearchStructure, pointing into coords
+  std::vector<ANNpoint> annPoints;
 	ANNkd_tree *SearchStructure;
 };
 double ScoreTOPOB(MS_Complex &C, double *x);
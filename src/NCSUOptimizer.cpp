@@ -41,7 +41,7 @@ enum { SETUP_MODEL, SETUP_USERFUNC };
 // BMA: maxfunc = 90000-20; MSE: increased for use with cheap evals by GenACV
 #define NCSU_DIRECT_MAXFUNC 255000
 
-NCSUOptimizer* NCSUOptimizer::ncsudirectInstance(NULL);
+thread_local NCSUOptimizer* NCSUOptimizer::ncsudirectInstance(NULL);
 
 
 /** This is the standard constructor with method specification support. */ 
@@ -330,6 +330,9 @@ objective_eval(int *n, double c[], double l[], double u[], int point[],
 
 void NCSUOptimizer::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   //------------------------------------------------------------------
   //     Solve the problem.
   //------------------------------------------------------------------
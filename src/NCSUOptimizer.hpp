@@ -137,7 +137,7 @@ private:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static NCSUOptimizer* ncsudirectInstance;
+  static thread_local NCSUOptimizer* ncsudirectInstance;
 
   /// controls iteration mode: SETUP_MODEL (normal usage) or SETUP_USERFUNC
   /// (user-supplied functions mode for "on the fly" instantiations).
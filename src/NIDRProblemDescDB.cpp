@@ -6572,11 +6572,13 @@ static bool
 	MP_(fileSaveFlag),
 	MP_(fileTagFlag),
 	MP_(nearbyEvalCacheFlag),
+	MP_(numpyBatchArrays),
 	MP_(numpyFlag),
 	MP_(restartFileFlag),
 	MP_(templateReplace),
 	MP_(useWorkdir),
-	MP_(verbatimFlag);
+	MP_(verbatimFlag),
+	MP_(workdirPrestage);
 
 static int
 	MP_(analysisServers),
@@ -7019,10 +7021,12 @@ static int
 	MP_(expandAfterSuccess),
         MP_(evidenceSamples),
         MP_(iteratorServers),
+        MP_(iteratorThreads),
 	MP_(jumpStep),
 	MP_(maxCrossIterations),
 	MP_(maxHifiEvals),
 	MP_(mutationRange),
+	MP_(muqNumChains),
         MP_(neighborOrder),
 	MP_(newSolnsGenerated),
 	MP_(numChains),
@@ -7034,6 +7038,7 @@ static int
 	MP_(populationSize),
         MP_(procsPerIterator),
         MP_(proposalCovUpdatePeriod),
+        MP_(pseudoInvThreads),
 	MP_(numPushforwardSamples),
 	MP_(randomSeed),
 	MP_(samplesOnEmulator),
@@ -7048,6 +7053,7 @@ static int
 
 static size_t
 	MP_(collocationPoints),
+	MP_(evaluationWindow),
         MP_(expansionSamples),
         MP_(kickRank),
         MP_(maxCVRankCandidates),
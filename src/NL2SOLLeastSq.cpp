@@ -18,7 +18,7 @@
 
 namespace Dakota {
 
-NL2SOLLeastSq* NL2SOLLeastSq::nl2solInstance(NULL);
+thread_local NL2SOLLeastSq* NL2SOLLeastSq::nl2solInstance(NULL);
 
 
 NL2SOLLeastSq::NL2SOLLeastSq(ProblemDescDB& problem_db, Model& model):
@@ -291,6 +291,9 @@ calcj(int *np, int *pp, Real *x, int *nfp, Real *J, int *ui, void *ur, Vf vf)
 
 void NL2SOLLeastSq::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   // set the object instance pointer for use within the static member fns
   NL2SOLLeastSq* prev_instance = nl2solInstance;
   nl2solInstance = this;
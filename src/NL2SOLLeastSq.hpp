@@ -89,7 +89,7 @@ private:
 
   /// pointer to the active object instance used within the static
   /// evaluator functions
-  static NL2SOLLeastSq* nl2solInstance;
+  static thread_local NL2SOLLeastSq* nl2solInstance;
 
   // For more details on the following data, see "Usage Summary for Selected
   // Optimization Routines" by David M. Gay, Computing Science Technical Report
@@ -42,7 +42,7 @@ void NLOPTN2_F77( const char* option_string );
 
 namespace Dakota {
 
-NLSSOLLeastSq* NLSSOLLeastSq::nlssolInstance(NULL);
+thread_local NLSSOLLeastSq* NLSSOLLeastSq::nlssolInstance(NULL);
 
 
 /** This is the primary constructor.  It accepts a Model reference. */
@@ -152,6 +152,9 @@ void NLSSOLLeastSq::check_sub_iterator_conflict()
 
 void NLSSOLLeastSq::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   //------------------------------------------------------------------
   //     Solve the problem.
   //------------------------------------------------------------------
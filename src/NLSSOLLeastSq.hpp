@@ -123,7 +123,7 @@ private:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static NLSSOLLeastSq* nlssolInstance;
+  static thread_local NLSSOLLeastSq* nlssolInstance;
 };
 
 } // namespace Dakota
@@ -52,7 +52,7 @@ void NPOPTN2_F77( const char* option_string );
 
 namespace Dakota {
 
-NPSOLOptimizer* NPSOLOptimizer::npsolInstance(NULL);
+thread_local NPSOLOptimizer* NPSOLOptimizer::npsolInstance(NULL);
 
 
 /** This is the primary constructor.  It accepts a Model reference. */
@@ -382,6 +382,9 @@ void NPSOLOptimizer::check_sub_iterator_conflict()
 
 void NPSOLOptimizer::core_run()
 {
+  // Fortran/f2c state is process-global: serialize concurrent instances
+  std::lock_guard<std::recursive_mutex> solver_lock(nonReentrantMutex);
+
   if (setUpType == "model")
     find_optimum_on_model();
   else if (setUpType == "user_functions")
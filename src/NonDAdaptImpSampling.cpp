@@ -161,20 +161,24 @@ initialize(const RealVectorArray& acv_points, bool x_space_data,
       designPoint[i] = acv_pt_0[i];
   }
 
-  RealVector acv_u_point;
+  // gather the x-space points into one matrix and transform them as a batch
+  RealMatrix acv_u_points;
+  if (x_space_data && num_points) {
+    size_t num_acv = acv_points[0].length();
+    RealMatrix acv_x_points(num_acv, num_points, false);
+    for (i=0; i<num_points; i++) {
+      const Real* acv_pt_i = acv_points[i].values();
+      std::copy(acv_pt_i, acv_pt_i + num_acv, acv_x_points[i]);
+    }
+    uSpaceModel.trans_X_to_U(acv_x_points, acv_u_points);
+  }
   for (i=0; i<num_points; i++) {
+    const Real* acv_pt_i = (x_space_data) ? acv_u_points[i] :
+      acv_points[i].values();
     RealVector& init_pt_i = initPointsU[i];
     init_pt_i.sizeUninitialized(numCAUV);
-    if (x_space_data) {
-      uSpaceModel.trans_X_to_U(acv_points[i], acv_u_point);
-      for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
-	init_pt_i[cntr] = acv_u_point[j];
-    }
-    else {
-      const RealVector& acv_init_pt_i = acv_points[i];
-      for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
-	init_pt_i[cntr] = acv_init_pt_i[j];
-    }
+    for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
+      init_pt_i[cntr] = acv_pt_i[j];
   }
 #ifdef DEBUG  
   for (i=0; i<num_points; i++)
@@ -203,21 +207,17 @@ initialize(const RealMatrix& acv_points, bool x_space_data, size_t resp_index,
       designPoint[i] = acv_pt_0[i];
   }
 
-  RealVector acv_u_point;
+  // transform the x-space points as one batch
+  RealMatrix acv_u_points;
+  if (x_space_data)
+    uSpaceModel.trans_X_to_U(acv_points, acv_u_points);
+  const RealMatrix& acv_init_pts = (x_space_data) ? acv_u_points : acv_points;
   for (i=0; i<num_points; i++) {
-    const Real* acv_pt_i = acv_points[i];
+    const Real* acv_pt_i = acv_init_pts[i];
     RealVector& init_pt_i = initPointsU[i];
     init_pt_i.sizeUninitialized(numCAUV);
-    if (x_space_data) {
-      RealVector acv_pt_view(Teuchos::View, const_cast<Real*>(acv_pt_i),
-			     numContinuousVars);
-      uSpaceModel.trans_X_to_U(acv_pt_view, acv_u_point);
-      for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
-	init_pt_i[cntr] = acv_u_point[j];
-    }
-    else
-      for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
-	init_pt_i[cntr] = acv_pt_i[j];
+    for (j=startCAUV, cntr=0; cntr<numCAUV; ++j, ++cntr)
+      init_pt_i[cntr] = acv_pt_i[j];
   }
 #ifdef DEBUG  
   for (i=0; i<num_points; i++)
@@ -40,7 +40,6 @@
 //#include "dakota_tabular_io.hpp"
 #include "dakota_linear_algebra.hpp"
 #include "DiscrepancyCorrection.hpp"
-#include "bayes_calibration_utils.hpp"
 #include "dakota_stat_util.hpp"
 
 static const char rcsId[]="@(#) $Id$";
@@ -2379,6 +2378,71 @@ log_likelihood(const RealVector& residuals, const RealVector& all_params)
 }
 
 
+/** Each column of all_params holds the calibration parameters and any
+    trailing hyper-parameters for one proposal.  With an asynchronous
+    residualModel, the proposals are queued with evaluate_nowait() and
+    collected with a single synchronize(), so the evaluation concurrency
+    is the number of proposals; otherwise they are evaluated in turn. */
+void NonDBayesCalibration::
+log_likelihood(const RealMatrix& all_params, RealVector& log_likes,
+	       RealMatrix* all_residuals)
+{
+  int i, num_params = all_params.numRows(), num_props = all_params.numCols();
+  if (log_likes.length() != num_props)
+    log_likes.sizeUninitialized(num_props);
+  if (all_residuals)
+    all_residuals->shapeUninitialized(residualModel.response_size(),
+				      num_props);
+
+  if (num_props > 1 && residualModel.asynch_flag()) {
+    IntIntMap id_to_index;
+    for (i=0; i<num_props; ++i) {
+      RealVector params_i(Teuchos::View, const_cast<Real*>(all_params[i]),
+			  num_params);
+      residualModel.continuous_variables(params_i);
+      residualModel.evaluate_nowait();
+      id_to_index[residualModel.evaluation_id()] = i;
+    }
+    const IntResponseMap& resp_map = residualModel.synchronize();
+    if (resp_map.size() != (size_t)num_props) {
+      Cerr << "Error: NonDBayesCalibration::log_likelihood() received "
+	   << resp_map.size() << " responses for a batch of " << num_props
+	   << " proposals." << std::endl;
+      abort_handler(METHOD_ERROR);
+    }
+    IntIntMCIter id_it;
+    for (IntRespMCIter r_it=resp_map.begin(); r_it!=resp_map.end(); ++r_it) {
+      id_it = id_to_index.find(r_it->first);
+      if (id_it == id_to_index.end()) {
+	Cerr << "Error: NonDBayesCalibration::log_likelihood() received "
+	     << "unknown evaluation id " << r_it->first << " for a batch of "
+	     << "proposals." << std::endl;
+	abort_handler(METHOD_ERROR);
+      }
+      i = id_it->second;
+      RealVector params_i(Teuchos::View, const_cast<Real*>(all_params[i]),
+			  num_params);
+      const RealVector& residuals = r_it->second.function_values();
+      log_likes[i] = log_likelihood(residuals, params_i);
+      if (all_residuals)
+	copy_data(residuals, (*all_residuals)[i], residuals.length());
+    }
+  }
+  else
+    for (i=0; i<num_props; ++i) {
+      RealVector params_i(Teuchos::View, const_cast<Real*>(all_params[i]),
+			  num_params);
+      residualModel.continuous_variables(params_i);
+      residualModel.evaluate();
+      const RealVector& residuals
+	= residualModel.current_response().function_values();
+      log_likes[i] = log_likelihood(residuals, params_i);
+      if (all_residuals)
+	copy_data(residuals, (*all_residuals)[i], residuals.length());
+    }
+}
+
+
 void NonDBayesCalibration::prior_cholesky_factorization()
 {
   // factorization to be performed offline (init time) and used online
@@ -2626,6 +2690,7 @@ void NonDBayesCalibration::compute_statistics()
   int num_samples = acceptanceChain.numCols();
   int num_filtered = int((num_samples-burnin)/num_skip);
 
+  // burn-in and sub-sampling stride over the chain in place
   RealMatrix filtered_chain;
   if (burnInSamples > 0 || num_skip > 1) {
     filter_chain(acceptanceChain, filtered_chain);
@@ -2644,6 +2709,15 @@ void NonDBayesCalibration::compute_statistics()
 
   }
 
+  // batch statistics for diagnostics are accumulated in a single pass
+  // over the full (retained) chain once sampling has completed
+  if (chainDiagnostics) {
+    chainDiagnosticStats.initialize(acceptanceChain.numRows(), num_samples);
+    chainDiagnosticStats.accumulate(acceptanceChain);
+    fnDiagnosticStats.initialize(acceptedFnVals.numRows(), num_samples);
+    fnDiagnosticStats.accumulate(acceptedFnVals);
+  }
+
   NonDSampling::compute_moments(filtered_chain, chainStats,
 				Pecos::STANDARD_MOMENTS);
 
@@ -2694,7 +2768,7 @@ void NonDBayesCalibration::filter_chain(const RealMatrix& acceptance_chain,
 {
   int burnin = (burnInSamples > 0) ? burnInSamples : 0;
   int num_skip = (subSamplingPeriod > 0) ? subSamplingPeriod : 1;
-  filter_matrix_cols(acceptance_chain, burnin, num_skip, filtered_chain);
+  filter_matrix_view(acceptance_chain, burnin, num_skip, filtered_chain);
 }
 
 void NonDBayesCalibration::filter_fnvals(const RealMatrix& accepted_fn_vals,
@@ -2702,7 +2776,7 @@ void NonDBayesCalibration::filter_fnvals(const RealMatrix& accepted_fn_vals,
 {
   int burnin = (burnInSamples > 0) ? burnInSamples : 0;
   int num_skip = (subSamplingPeriod > 0) ? subSamplingPeriod : 1;
-  filter_matrix_cols(accepted_fn_vals, burnin, num_skip, filtered_fn_vals);
+  filter_matrix_view(accepted_fn_vals, burnin, num_skip, filtered_fn_vals);
 }
 
 
@@ -2730,6 +2804,27 @@ filter_matrix_cols(const RealMatrix& orig_matrix, int start_index,
 }
 
 
+void NonDBayesCalibration::
+filter_matrix_view(const RealMatrix& orig_matrix, int start_index,
+		   int stride, RealMatrix& filtered_view)
+{
+  int num_orig = orig_matrix.numCols();
+  if (num_orig <= start_index || stride <= 0) {
+    Cerr << "\nError: Invalid arguments to NonDBayesCalibraion::"
+	 << "filter_matrix_view()\n";
+    abort_handler(METHOD_ERROR);
+  }
+
+  // successive filtered columns are stride columns apart in orig_matrix,
+  // so a view with leading dimension stride*ldim selects them without a copy
+  int num_filtered = 1 + (num_orig-start_index-1)/stride;
+  filtered_view = RealMatrix(Teuchos::View,
+			     const_cast<Real*>(orig_matrix[start_index]),
+			     stride*orig_matrix.stride(), orig_matrix.numRows(),
+			     num_filtered);
+}
+
+
 void NonDBayesCalibration::compute_intervals()
 {
   std::ofstream interval_stream("dakota_mcmc_CredPredIntervals.dat");
@@ -3705,10 +3800,33 @@ void NonDBayesCalibration::print_kl(std::ostream& s)
 void NonDBayesCalibration::print_chain_diagnostics(std::ostream& s)
 {
   s << "\nChain diagnostics\n";
+  print_effective_sample_sizes(s);
   if (chainDiagnosticsCI)
     print_batch_means_intervals(s);
 }
 
+void NonDBayesCalibration::print_effective_sample_sizes(std::ostream& s)
+{
+  size_t width = write_precision+7;
+  StringArray var_labels;
+  copy_data(residualModel.continuous_variable_labels(),	var_labels);
+  const StringArray& resp_labels
+    = mcmcModel.current_response().function_labels();
+
+  RealVector variables_ess, responses_ess;
+  chainDiagnosticStats.effective_sample_size(variables_ess);
+  fnDiagnosticStats.effective_sample_size(responses_ess);
+
+  s << "\tEffective sample sizes (batch means) of "
+    << chainDiagnosticStats.count() << " chain samples\n";
+  for (int i = 0; i < variables_ess.length(); i++)
+    s << '\t' << std::setw(width) << var_labels[i] << " = "
+      << variables_ess[i] << '\n';
+  for (int i = 0; i < responses_ess.length(); i++)
+    s << '\t' << std::setw(width) << resp_labels[i] << " = "
+      << responses_ess[i] << '\n';
+}
+
 void NonDBayesCalibration::print_batch_means_intervals(std::ostream& s)
 {
   size_t width = write_precision+7;
@@ -3718,20 +3836,20 @@ void NonDBayesCalibration::print_batch_means_intervals(std::ostream& s)
   StringArray var_labels;
   copy_data(residualModel.continuous_variable_labels(),	var_labels);
   RealMatrix variables_mean_interval_mat, variables_mean_batch_means;
-  batch_means_interval(acceptanceChain, variables_mean_interval_mat,
-                       variables_mean_batch_means, 1, alpha);
+  chainDiagnosticStats.batch_means_interval(variables_mean_interval_mat,
+					    variables_mean_batch_means, 1, alpha);
   RealMatrix variables_var_interval_mat, variables_var_batch_means;
-  batch_means_interval(acceptanceChain, variables_var_interval_mat,
-                       variables_var_batch_means, 2, alpha);
+  chainDiagnosticStats.batch_means_interval(variables_var_interval_mat,
+					    variables_var_batch_means, 2, alpha);
   
   int num_responses = acceptedFnVals.numRows();
   StringArray resp_labels = mcmcModel.current_response().function_labels();
   RealMatrix responses_mean_interval_mat, responses_mean_batch_means;
-  batch_means_interval(acceptedFnVals, responses_mean_interval_mat,
-                       responses_mean_batch_means, 1, alpha);
+  fnDiagnosticStats.batch_means_interval(responses_mean_interval_mat,
+					 responses_mean_batch_means, 1, alpha);
   RealMatrix responses_var_interval_mat, responses_var_batch_means;
-  batch_means_interval(acceptedFnVals, responses_var_interval_mat,
-                       responses_var_batch_means, 2, alpha);
+  fnDiagnosticStats.batch_means_interval(responses_var_interval_mat,
+					 responses_var_batch_means, 2, alpha);
 
   if (outputLevel >= DEBUG_OUTPUT) {
     for (int i = 0; i < num_vars; i++) {
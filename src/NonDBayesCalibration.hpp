@@ -15,6 +15,7 @@
 #include "InvGammaRandomVariable.hpp"
 #include "GaussianKDE.hpp"
 #include "ANN/ANN.h" 
+#include "bayes_calibration_utils.hpp"
 
 //#define DEBUG
 
@@ -242,6 +243,12 @@ protected:
   /// they are already sized and scaled by covariance / hyperparams...
   Real log_likelihood(const RealVector& residuals,
 		      const RealVector& hyper_params);
+  /// evaluate residualModel at each column of all_params (a batch of
+  /// proposals) and return the corresponding log-likelihoods, along
+  /// with the residuals if all_residuals is provided; the batch is
+  /// scheduled asynchronously when the model supports it
+  void log_likelihood(const RealMatrix& all_params, RealVector& log_likes,
+		      RealMatrix* all_residuals = NULL);
 
   /// compute priorCovCholFactor based on prior distributions for random
   /// variables and any hyperparameters
@@ -495,7 +502,8 @@ protected:
   /// Perform chain filtering based on target chain length
   void filter_chain(const RealMatrix& acceptance_chain, RealMatrix& filtered_chain, 
       		    int target_length);
-  /// Perform chain filtering with burn-in and sub-sampling
+  /// Perform chain filtering with burn-in and sub-sampling, returning a
+  /// view of acceptance_chain
   void filter_chain(const RealMatrix& acceptance_chain, RealMatrix& filtered_chain);
   void filter_fnvals(const RealMatrix& accepted_fn_vals, RealMatrix& filtered_fn_vals);
 
@@ -504,6 +512,10 @@ protected:
   /// number of burn-in discards
   void filter_matrix_cols(const RealMatrix& orig_matrix, int start_index,
 			  int stride, RealMatrix& filtered_matrix);
+  /// return a view of the same columns selected by filter_matrix_cols(),
+  /// striding over orig_matrix in place
+  void filter_matrix_view(const RealMatrix& orig_matrix, int start_index,
+			  int stride, RealMatrix& filtered_view);
 
   /// Compute credibility and prediction intervals of final chain
   RealMatrix predVals;
@@ -541,6 +553,11 @@ protected:
   void print_kl(std::ostream& stream);		
   void print_chain_diagnostics(std::ostream& s);
   void print_batch_means_intervals(std::ostream& s); 
+  void print_effective_sample_sizes(std::ostream& s);
+  /// one-pass batch statistics of acceptanceChain for chain diagnostics
+  ChainAccumulator chainDiagnosticStats;
+  /// one-pass batch statistics of acceptedFnVals for chain diagnostics
+  ChainAccumulator fnDiagnosticStats;
 
   /// whether response scaling is active
   bool scaleFlag;
@@ -92,7 +92,8 @@ NonDDREAMBayesCalibration(ProblemDescDB& problem_db, Model& model):
   numCR(probDescDB.get_int("method.dream.num_cr")),
   crossoverChainPairs(probDescDB.get_int("method.dream.crossover_chain_pairs")),
   grThreshold(probDescDB.get_real("method.dream.gr_threshold")),
-  jumpStep(probDescDB.get_int("method.dream.jump_step"))
+  jumpStep(probDescDB.get_int("method.dream.jump_step")),
+  prevDREAMInstance(NULL)
 { 
   // don't use max_function_evaluations, since we have num_samples
   // consider max_iterations = generations, and adjust as needed?
@@ -153,7 +154,9 @@ NonDDREAMBayesCalibration::~NonDDREAMBayesCalibration()
 /** Perform the uncertainty quantification */
 void NonDDREAMBayesCalibration::calibrate()
 {
-  // instantiate DREAM objects and execute
+  // instantiate DREAM objects and execute; a nested calibration restores
+  // the enclosing instance on completion
+  prevDREAMInstance = nonDDREAMInstance;
   nonDDREAMInstance = this;
 
   // diagnostic information
@@ -277,6 +280,7 @@ void NonDDREAMBayesCalibration::calibrate()
   // Generate useful stats from the posterior samples
   compute_statistics();
 
+  nonDDREAMInstance = prevDREAMInstance;
 }
 
 
@@ -296,17 +300,16 @@ print_results(std::ostream& s, short results_state)
 /** Static callback function to evaluate the likelihood */
 double NonDDREAMBayesCalibration::sample_likelihood(int par_num, double zp[])
 {
-  RealVector all_params(Teuchos::View, zp, par_num);
-
   // DREAM searches in either the original space (default for GPs and no
-  // emulator) or standardized space (PCE/SC, optional for GP/no emulator).  
-  nonDDREAMInstance->residualModel.continuous_variables(all_params); 
-
-  // Compute simulation response to use in likelihood 
-  nonDDREAMInstance->residualModel.evaluate();
+  // emulator) or standardized space (PCE/SC, optional for GP/no emulator).
+  // DREAM requests one chain's proposal at a time, so this is a batch of
+  // one through the shared proposal-batch evaluation.
+  RealMatrix all_params(Teuchos::View, zp, par_num, par_num, 1);
+  RealVector log_likes;
+  nonDDREAMInstance->log_likelihood(all_params, log_likes);
+  double log_like = log_likes[0];
   const RealVector& residuals = 
     nonDDREAMInstance->residualModel.current_response().function_values();
-  double log_like = nonDDREAMInstance->log_likelihood(residuals, all_params);
 
   if (nonDDREAMInstance->outputLevel >= DEBUG_OUTPUT) {
     Cout << "Log likelihood is " << log_like << " Likelihood is "
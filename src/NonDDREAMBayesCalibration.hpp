@@ -116,6 +116,9 @@ private:
 
   /// Pointer to current class instance for use in static callback functions
   static NonDDREAMBayesCalibration* nonDDREAMInstance;
+  /// pointer containing previous value of nonDDREAMInstance, restored
+  /// when this calibration completes
+  NonDDREAMBayesCalibration* prevDREAMInstance;
   
 };
 
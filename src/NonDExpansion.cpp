@@ -2079,6 +2079,26 @@ increment_sets(Real& delta_star, bool revert, bool print_metric)
   const std::set<UShortArray>& active_mi = nond_sparse->active_multi_index();
   std::set<UShortArray>::const_iterator cit, cit_star = active_mi.end();
   Real delta; delta_star = -DBL_MAX;  size_t index = 0, index_star = _NPOS;
+
+  // For asynchronous models, gather the trial grids of all new candidates
+  // into a single concurrent wave.  Each queued set is popped (without
+  // evaluation) and later restored by evaluate_set(set), which retrieves
+  // its cached evaluations for the sequential assessment below.
+  if (nond_sparse->iterated_model().asynch_flag()) {
+    size_t num_queued = 0;
+    for (cit=active_mi.begin(); cit!=active_mi.end(); ++cit) {
+      nond_sparse->increment_set(*cit);
+      if (!uSpaceModel.push_available() && nond_sparse->queue_set(*cit))
+	++num_queued;
+      nond_sparse->decrement_set();
+    }
+    if (num_queued) {
+      Cout << "\n>>>>> Evaluating " << num_queued << " new trial index sets "
+	   << "concurrently.\n";
+      nond_sparse->synchronize_sets();
+    }
+  }
+
   for (cit=active_mi.begin(); cit!=active_mi.end(); ++cit, ++index) {
 
     // increment grid with current candidate
@@ -2089,7 +2109,7 @@ increment_sets(Real& delta_star, bool revert, bool print_metric)
       uSpaceModel.push_approximation();
     }
     else {                                    // a new active set
-      nond_sparse->evaluate_set();
+      nond_sparse->evaluate_set(*cit);        // retrieve if queued above
       uSpaceModel.append_approximation(true); // rebuild
     }
 
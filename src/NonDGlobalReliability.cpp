@@ -699,17 +699,24 @@ void NonDGlobalReliability::optimize_gaussian_process()
       const Pecos::SurrogateData& gp_data
 	= uSpaceModel.approximation_data(respFnCount);
       size_t num_data_pts = gp_data.size(), num_vars = uSpaceModel.cv();
+      // x-space build data is transformed to u-space as one batch
+      RealMatrix sams_x, sams_u;
+      if (mppSearchType == SUBMETHOD_EGRA_X) {
+	sams_x.shapeUninitialized(num_vars, num_data_pts);
+	for (size_t i=0; i<num_data_pts; ++i) {
+	  const Real* sams = gp_data.continuous_variables(i).values();
+	  std::copy(sams, sams + num_vars, sams_x[i]);
+	}
+	uSpaceModel.trans_X_to_U(sams_x, sams_u);
+      }
       for (size_t i=0; i<num_data_pts; ++i) {
 	const RealVector& sams = gp_data.continuous_variables(i); // view
 	Real true_fn = gp_data.response_function(i);
 	
 	if (mppSearchType == SUBMETHOD_EGRA_X) {
-	  RealVector sams_u(num_vars);
-	  uSpaceModel.trans_X_to_U(sams,sams_u);
-	  
 	  samsOut << '\n';
 	  for (size_t j=0; j<num_vars; j++)
-	    samsOut << std::setw(13) << sams_u[j] << ' ';
+	    samsOut << std::setw(13) << sams_u(j,i) << ' ';
 	  samsOut<< std::setw(13) << true_fn;
 	}
 	else {
@@ -216,8 +216,10 @@ void NonDLHSSampling::pre_run()
 
   // Only need to create the pick-freeze samples for the 
   // Saltelli method.
+  // Unless all data is retained, the A_B^i replicates are streamed
+  // within core_run().
   if (vbdFlag && vbdViaSamplingMethod==VBD_PICK_AND_FREEZE ) {
-    get_vbd_parameter_sets(iteratedModel, numSamples);
+    get_vbd_parameter_sets(iteratedModel, numSamples, !allDataFlag);
     return;
   }
 
@@ -670,9 +672,17 @@ void NonDLHSSampling::post_input()
     statistics on the set of responses if statsFlag is set. */
 void NonDLHSSampling::core_run()
 {
-  bool log_resp_flag = (allDataFlag || statsFlag);
+  // moment-only statistics may be accumulated within an evaluation window,
+  // unless refinement or PCA needs the responses
+  bool stream_moments
+    = initialize_streamed_moments(refineSamples.length() || pcaFlag);
+  bool log_resp_flag = (allDataFlag || statsFlag) && !stream_moments;
   bool log_best_flag = !numResponseFunctions; // DACE mode w/ opt or NLS
-  evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
+  if (vbdStreamFlag) // VBD indices are accumulated block by block
+    evaluate_vbd_parameter_sets(iteratedModel, numSamples, nonDSampCorr,
+				log_best_flag);
+  else
+    evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
 
   //Needed if we want to do bootstrapping for covariance of 
   //scalarization term cov[mean,sigma]
@@ -740,13 +750,14 @@ void NonDLHSSampling::post_run(std::ostream& s)
   // redefinition of print_results().
   if (statsFlag) {
     if(vbdFlag) {
-      nonDSampCorr.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
-                                                  vbdViaSamplingNumBins,
-                                                  numFunctions,
-                                                  numContinuousVars + numDiscreteIntVars + numDiscreteRealVars + numDiscreteStringVars,
-                                                  numSamples,
-                                                  allSamples,
-                                                  allResponses);
+      if (!vbdStreamFlag) // else computed within core_run()
+        nonDSampCorr.compute_vbd_stats_via_sampling(vbdViaSamplingMethod,
+                                                    vbdViaSamplingNumBins,
+                                                    numFunctions,
+                                                    numContinuousVars + numDiscreteIntVars + numDiscreteRealVars + numDiscreteStringVars,
+                                                    numSamples,
+                                                    allSamples,
+                                                    allResponses);
       nonDSampCorr.archive_sobol_indices(run_identifier(),
                                          resultsDB,
                                          iteratedModel.ordered_labels(),
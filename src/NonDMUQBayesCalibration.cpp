@@ -27,6 +27,9 @@
 #include "MUQ/Modeling/Distributions/Gaussian.h"
 
 #include <boost/property_tree/ptree.hpp>
+#include <exception>
+#include <stdexcept>
+#include <thread>
 
 namespace Dakota {
 
@@ -42,6 +45,8 @@ NonDMUQBayesCalibration* NonDMUQBayesCalibration::nonDMUQInstance(NULL);
 NonDMUQBayesCalibration::
 NonDMUQBayesCalibration(ProblemDescDB& problem_db, Model& model):
   NonDBayesCalibration(problem_db, model),
+  numChains(probDescDB.get_int("method.nond.muq_num_chains")),
+  chainTurn(0), chainAbort(false),
   numBestSamples(1),
   mcmcType(probDescDB.get_string("method.nond.mcmc_type")),
   priorPropCovMult(probDescDB.get_real("method.prior_prop_cov_mult")),
@@ -131,6 +136,27 @@ NonDMUQBayesCalibration(ProblemDescDB& problem_db, Model& model):
       abort_handler(METHOD_ERROR);
     }
   }
+
+  if (numChains > 1) {
+    if (mcmcType == "mala" || mcmcType == "dili") {
+      Cerr << "\nError: NonDMUQBayesCalibration::constructor(): multiple chains"
+           << " are not supported for " << mcmcType << ".\n";
+      abort_handler(METHOD_ERROR);
+    }
+    // as for DREAM, chain_samples is the total over all chains
+    if (chainSamples > 0) {
+      int num_chains = numChains,
+        chain_length = std::max(chainSamples / num_chains, 1);
+      if (chain_length * num_chains != chainSamples) {
+        chainSamples = chain_length * num_chains;
+        Cout << "Warning: MUQ chain_samples adjusted to " << chainSamples
+             << " for " << numChains << " chains of " << chain_length
+             << " samples." << std::endl;
+      }
+    }
+    // the chains' proposals are evaluated concurrently, one per chain
+    maxEvalConcurrency *= numChains;
+  }
 }
 
 
@@ -144,6 +170,10 @@ double MUQLikelihood::LogDensityImpl(muq::Modeling::ref_vector<Eigen::VectorXd>
   Eigen::VectorXd const& c_vars = inputs.at(0);
   size_t num_cv = c_vars.size();
 
+  // Multiple chains evaluate their proposals together, one round at a time
+  if (nonDMUQInstancePtr->numChains > 1)
+    return nonDMUQInstancePtr->chain_log_likelihood(chainIndex, c_vars);
+
   // Set the calibration variables and hyperparams in the outer
   // residualModel: note that this won't update the Variables object
   // in any inner models.
@@ -158,22 +188,9 @@ double MUQLikelihood::LogDensityImpl(muq::Modeling::ref_vector<Eigen::VectorXd>
   const RealVector& residuals = nonDMUQInstancePtr->residualModel.current_response().function_values();
   double log_like = nonDMUQInstancePtr->log_likelihood(residuals, all_params);
   
-  if (nonDMUQInstancePtr->outputLevel >= DEBUG_OUTPUT) {
-    Cout << "Log likelihood is " << log_like << " Likelihood is "
-         << std::exp(log_like) << '\n';
-
-    std::ofstream LogLikeOutput;
-    LogLikeOutput.open("NonDMUQLogLike.txt", std::ios::out | std::ios::app);
-    // Note: parameter values are in scaled space, if scaling is
-    // active; residuals may be scaled by covariance
-    size_t num_total_params = nonDMUQInstancePtr->numContinuousVars + nonDMUQInstancePtr->numHyperparams; 
-    for (size_t i(0); i < num_total_params; ++i)
-      LogLikeOutput << c_vars[i] << ' ' ;
-    for (size_t i(0); i < residuals.length(); ++i)
-      LogLikeOutput << residuals[i] << ' ' ;
-    LogLikeOutput << log_like << '\n';
-    LogLikeOutput.close();
-  }
+  if (nonDMUQInstancePtr->outputLevel >= DEBUG_OUTPUT)
+    nonDMUQInstancePtr->log_likelihood_debug(c_vars.data(), residuals,
+                                             log_like);
 
   return log_like;
 }
@@ -268,14 +285,14 @@ void NonDMUQBayesCalibration::specify_prior()
   nonDMUQInstance = this;
   Eigen::VectorXi input_sizes(1);
   input_sizes(0) = numContinuousVars;
-  MUQPriorPtr = std::make_shared<MUQPrior>(nonDMUQInstance, input_sizes);
+  MUQPriorPtr = std::make_shared<MUQPrior>(this, input_sizes);
 }
 
 void NonDMUQBayesCalibration::specify_likelihood()
 {
   Eigen::VectorXi input_sizes(1);
   input_sizes(0) = numContinuousVars;
-  MUQLikelihoodPtr = std::make_shared<MUQLikelihood>(nonDMUQInstance, input_sizes);
+  MUQLikelihoodPtr = std::make_shared<MUQLikelihood>(this, input_sizes);
 }
 
 void NonDMUQBayesCalibration::init_bayesian_solver()
@@ -283,42 +300,8 @@ void NonDMUQBayesCalibration::init_bayesian_solver()
   init_proposal_covariance();
 
   parameterPtr = std::make_shared<muq::Modeling::IdentityOperator>(numContinuousVars);
-  workGraph = std::make_shared<muq::Modeling::WorkGraph>();
-
-  workGraph->AddNode(parameterPtr, "Parameters");
-  if (mcmcType == "dili") {
-    Eigen::VectorXd muqGaussianPriorMu = Eigen::VectorXd::Zero(numContinuousVars);
-    Eigen::MatrixXd muqGaussianPriorCovMatrix = Eigen::MatrixXd::Zero(numContinuousVars,numContinuousVars);
-
-    std::vector<Pecos::RandomVariable>& variables = residualModel.multivariate_distribution().random_variables();
-    size_t i(0);
-    for ( Pecos::RandomVariable variable : variables ) {
-      if (variable.type() == Pecos::NORMAL) {
-        muqGaussianPriorMu[i] = variable.mean();
-        muqGaussianPriorCovMatrix(i, i) = variable.variance();
-        i += 1;
-      }
-    }
-    //std::cout << "In NonDMUQBayesCalibration::init_bayesian_solver()"
-    //          << ": 'dili' case"
-    //          << ", muqGaussianPriorMu = "        << muqGaussianPriorMu
-    //          << ", muqGaussianPriorCovMatrix = " << muqGaussianPriorCovMatrix
-    //          << std::endl;
-    std::shared_ptr<muq::Modeling::Gaussian> muqGaussianPrior(new muq::Modeling::Gaussian(muqGaussianPriorMu, muqGaussianPriorCovMatrix));
-
-    workGraph->AddNode(MUQLikelihoodPtr, "Likelihood");
-    workGraph->AddNode(muqGaussianPrior->AsDensity(), "Prior");
-  }
-  else {
-    workGraph->AddNode(MUQLikelihoodPtr, "Likelihood");
-    workGraph->AddNode(MUQPriorPtr, "Prior");
-  }
-  workGraph->AddNode(posteriorPtr, "Posterior");
-
-  workGraph->AddEdge("Parameters", 0, "Prior",      0); // 0 = index of input,output
-  workGraph->AddEdge("Parameters", 0, "Likelihood", 0); // 0 = index of input,output
-  workGraph->AddEdge("Prior",      0, "Posterior",  0);
-  workGraph->AddEdge("Likelihood", 0, "Posterior",  1);
+  workGraph = construct_work_graph(parameterPtr, MUQLikelihoodPtr, MUQPriorPtr,
+                                   posteriorPtr);
 
   // Dump out a visualization of the work graph
   if (outputLevel >= DEBUG_OUTPUT)
@@ -330,7 +313,7 @@ void NonDMUQBayesCalibration::init_bayesian_solver()
   // input specification is communicated using Boost property trees
   boost::property_tree::ptree pt; // TO DO: look at options...
   int N =  (chainSamples > 0) ? chainSamples : 1000;
-  pt.put("NumSamples", N);
+  pt.put("NumSamples", std::max(N / (int)numChains, 1)); // per chain
   pt.put("PrintLevel",0);
 
   pt.put("KernelList", "Kernel1"); // the transition kernel
@@ -415,9 +398,79 @@ void NonDMUQBayesCalibration::init_bayesian_solver()
     pt.put("Kernel1.MyProposal.StepSize",malaStepSize);
   }
 
-  boost::property_tree::ptree kernOpts = pt.get_child("Kernel1");
+  mcmc = construct_chain(pt, workGraph->CreateModPiece("Posterior"));
+
+  // Each additional chain gets its own graph, since the MUQ densities
+  // retain the state of their most recent evaluation
+  chainSamplers.assign(1, mcmc);
+  Eigen::VectorXi input_sizes(1);
+  input_sizes(0) = numContinuousVars;
+  for (size_t c(1); c < numChains; ++c) {
+    std::shared_ptr<muq::Modeling::WorkGraph> chain_graph =
+      construct_work_graph(
+        std::make_shared<muq::Modeling::IdentityOperator>(numContinuousVars),
+        std::make_shared<MUQLikelihood>(this, input_sizes, c),
+        std::make_shared<MUQPrior>(this, input_sizes),
+        std::make_shared<muq::Modeling::DensityProduct>(2));
+    chainSamplers.push_back(
+      construct_chain(pt, chain_graph->CreateModPiece("Posterior")));
+  }
+}
+
 
-  auto dens = workGraph->CreateModPiece("Posterior");
+std::shared_ptr<muq::Modeling::WorkGraph> NonDMUQBayesCalibration::
+construct_work_graph(std::shared_ptr<muq::Modeling::IdentityOperator> parameters,
+                     std::shared_ptr<MUQLikelihood> likelihood,
+                     std::shared_ptr<MUQPrior> prior,
+                     std::shared_ptr<muq::Modeling::DensityProduct> posterior)
+{
+  auto graph = std::make_shared<muq::Modeling::WorkGraph>();
+
+  graph->AddNode(parameters, "Parameters");
+  if (mcmcType == "dili") {
+    Eigen::VectorXd muqGaussianPriorMu = Eigen::VectorXd::Zero(numContinuousVars);
+    Eigen::MatrixXd muqGaussianPriorCovMatrix = Eigen::MatrixXd::Zero(numContinuousVars,numContinuousVars);
+
+    std::vector<Pecos::RandomVariable>& variables = residualModel.multivariate_distribution().random_variables();
+    size_t i(0);
+    for ( Pecos::RandomVariable variable : variables ) {
+      if (variable.type() == Pecos::NORMAL) {
+        muqGaussianPriorMu[i] = variable.mean();
+        muqGaussianPriorCovMatrix(i, i) = variable.variance();
+        i += 1;
+      }
+    }
+    //std::cout << "In NonDMUQBayesCalibration::construct_work_graph()"
+    //          << ": 'dili' case"
+    //          << ", muqGaussianPriorMu = "        << muqGaussianPriorMu
+    //          << ", muqGaussianPriorCovMatrix = " << muqGaussianPriorCovMatrix
+    //          << std::endl;
+    std::shared_ptr<muq::Modeling::Gaussian> muqGaussianPrior(new muq::Modeling::Gaussian(muqGaussianPriorMu, muqGaussianPriorCovMatrix));
+
+    graph->AddNode(likelihood, "Likelihood");
+    graph->AddNode(muqGaussianPrior->AsDensity(), "Prior");
+  }
+  else {
+    graph->AddNode(likelihood, "Likelihood");
+    graph->AddNode(prior, "Prior");
+  }
+  graph->AddNode(posterior, "Posterior");
+
+  graph->AddEdge("Parameters", 0, "Prior",      0); // 0 = index of input,output
+  graph->AddEdge("Parameters", 0, "Likelihood", 0); // 0 = index of input,output
+  graph->AddEdge("Prior",      0, "Posterior",  0);
+  graph->AddEdge("Likelihood", 0, "Posterior",  1);
+
+  return graph;
+}
+
+
+std::shared_ptr<muq::SamplingAlgorithms::SingleChainMCMC>
+NonDMUQBayesCalibration::
+construct_chain(boost::property_tree::ptree& pt,
+                std::shared_ptr<muq::Modeling::ModPiece> dens)
+{
+  boost::property_tree::ptree kernOpts = pt.get_child("Kernel1");
 
   auto problem = std::make_shared<muq::SamplingAlgorithms::SamplingProblem>(dens);
 
@@ -468,7 +521,7 @@ void NonDMUQBayesCalibration::init_bayesian_solver()
     kernels.at(0) = std::make_shared<muq::SamplingAlgorithms::DILIKernel>(kernOpts, problem);
   }
 
-  mcmc = std::make_shared<muq::SamplingAlgorithms::SingleChainMCMC>(pt,kernels);
+  return std::make_shared<muq::SamplingAlgorithms::SingleChainMCMC>(pt,kernels);
 }
 
 
@@ -486,7 +539,7 @@ void NonDMUQBayesCalibration::calibrate()
   const size_t &num_cv = numContinuousVars;
   Eigen::VectorXd init_pt(num_cv);
   if(mapOptimizer.is_null()) {
-    const RealVector& init_point = nonDMUQInstance->mcmcModel.continuous_variables();
+    const RealVector& init_point = mcmcModel.continuous_variables();
     for (size_t i(0); i < num_cv; ++i)
       init_pt[i] = init_point[i];
   } else {
@@ -496,11 +549,17 @@ void NonDMUQBayesCalibration::calibrate()
   }
 
   Cout << "Running Bayesian Calibration with MUQ " << mcmcType << " using "
-       << N << " MCMC samples." << std::endl;
+       << N << " MCMC samples";
+  if (numChains > 1)
+    Cout << " in " << numChains << " chains";
+  Cout << '.' << std::endl;
 
   muq::Utilities::RandomGenerator::SetSeed(randomSeed);
 
-  samps = mcmc->Run(init_pt);
+  if (numChains > 1)
+    run_chains(init_pt);
+  else
+    samps = mcmc->Run(init_pt);
 
   bfs::path wd( WorkdirHelper::rel_to_abs("MUQDiagnostics") );
   WorkdirHelper::create_directory(wd, DIR_CLEAN);
@@ -518,6 +577,159 @@ void NonDMUQBayesCalibration::calibrate()
 }
 
 
+/** MUQ draws from a single global generator, so the chains take turns
+    in index order: each runs until it needs a likelihood, deposits its
+    proposal, and yields to the next.  Once every active chain has had
+    its turn, this thread evaluates the round of proposals as one batch
+    and hands the turn back to the first chain.  The turn order keeps
+    the generator draws, and therefore the chains, reproducible. */
+void NonDMUQBayesCalibration::run_chains(const Eigen::VectorXd& init_pt)
+{
+  std::vector<std::shared_ptr<muq::SamplingAlgorithms::SampleCollection>>
+    chain_samps(numChains);
+  std::vector<std::exception_ptr> chain_errors(numChains);
+
+  chainTurn = 0; chainAbort = false;
+  chainActive.resize(numChains);  chainActive.set();
+  chainPending.resize(numChains); chainPending.reset();
+  chainProposals.shapeUninitialized(numContinuousVars, numChains);
+  chainLogLikes.sizeUninitialized(numChains);
+
+  std::vector<std::thread> threads;
+  threads.reserve(numChains);
+  for (size_t c=0; c<numChains; ++c)
+    threads.emplace_back([this, c, &init_pt, &chain_samps, &chain_errors]() {
+      bool abort;
+      {
+        std::unique_lock<std::mutex> lock(chainMutex);
+        chainCondition.wait(lock, [this, c]()
+          { return chainTurn == c || chainAbort; });
+        abort = chainAbort;
+      }
+      if (!abort) {
+        try
+          { chain_samps[c] = chainSamplers[c]->Run(init_pt); }
+        catch (...)
+          { chain_errors[c] = std::current_exception(); }
+      }
+      std::lock_guard<std::mutex> lock(chainMutex);
+      chainActive.reset(c);
+      pass_chain_turn(c);
+    });
+
+  // an evaluation error aborts the chains, which must be joined before
+  // it propagates
+  std::exception_ptr eval_error;
+  {
+    std::unique_lock<std::mutex> lock(chainMutex);
+    RealMatrix proposals, residuals;
+    RealVector log_likes;
+    bool debug_log = (outputLevel >= DEBUG_OUTPUT);
+    for (;;) {
+      chainCondition.wait(lock, [this]() { return chainTurn == numChains; });
+      if (chainActive.none())
+        break;
+
+      // every active chain has deposited a proposal for this round
+      size_t c, p, num_pending = chainPending.count();
+      proposals.shapeUninitialized(numContinuousVars, num_pending);
+      for (c=chainPending.find_first(), p=0; c!=BitArray::npos;
+           c=chainPending.find_next(c), ++p)
+        for (size_t i=0; i<numContinuousVars; ++i)
+          proposals(i, p) = chainProposals(i, c);
+      try {
+        log_likelihood(proposals, log_likes,
+                       (debug_log) ? &residuals : NULL);
+      }
+      catch (...) {
+        eval_error = std::current_exception();
+        chainAbort = true;
+        chainCondition.notify_all();
+        break;
+      }
+      for (c=chainPending.find_first(), p=0; c!=BitArray::npos;
+           c=chainPending.find_next(c), ++p) {
+        chainLogLikes[c] = log_likes[p];
+        if (debug_log) {
+          RealVector resid_p(Teuchos::View, residuals[p], residuals.numRows());
+          log_likelihood_debug(proposals[p], resid_p, log_likes[p]);
+        }
+      }
+
+      chainPending.reset();
+      chainTurn = chainActive.find_first();
+      chainCondition.notify_all();
+    }
+  }
+
+  for (size_t c=0; c<numChains; ++c)
+    threads[c].join();
+  if (eval_error)
+    std::rethrow_exception(eval_error);
+  for (size_t c=0; c<numChains; ++c)
+    if (chain_errors[c])
+      std::rethrow_exception(chain_errors[c]);
+
+  // interleave the chains by step, as for DREAM generations
+  samps = std::make_shared<muq::SamplingAlgorithms::SampleCollection>();
+  size_t k, c, chain_len = chain_samps[0]->size();
+  for (c=1; c<numChains; ++c)
+    chain_len = std::min(chain_len, (size_t)chain_samps[c]->size());
+  for (k=0; k<chain_len; ++k)
+    for (c=0; c<numChains; ++c)
+      samps->Add(chain_samps[c]->at(k));
+}
+
+
+double NonDMUQBayesCalibration::
+chain_log_likelihood(size_t chain, const Eigen::VectorXd& c_vars)
+{
+  std::unique_lock<std::mutex> lock(chainMutex);
+  for (size_t i=0; i<numContinuousVars; ++i)
+    chainProposals(i, chain) = c_vars[i];
+  chainPending.set(chain);
+  pass_chain_turn(chain);
+
+  chainCondition.wait(lock, [this, chain]()
+    { return (chainTurn == chain && !chainPending[chain]) || chainAbort; });
+  // unwind the sampler of an aborted chain; run_chains() reports the
+  // evaluation error instead
+  if (chainAbort)
+    throw std::runtime_error("MUQ chain aborted by an evaluation error");
+  return chainLogLikes[chain];
+}
+
+
+/** Parameter values are in scaled space, if scaling is active;
+    residuals may be scaled by covariance. */
+void NonDMUQBayesCalibration::
+log_likelihood_debug(const Real* params, const RealVector& residuals,
+                     Real log_like)
+{
+  Cout << "Log likelihood is " << log_like << " Likelihood is "
+       << std::exp(log_like) << '\n';
+
+  std::ofstream LogLikeOutput;
+  LogLikeOutput.open("NonDMUQLogLike.txt", std::ios::out | std::ios::app);
+  size_t num_total_params = numContinuousVars + numHyperparams;
+  for (size_t i(0); i < num_total_params; ++i)
+    LogLikeOutput << params[i] << ' ' ;
+  for (size_t i(0); i < residuals.length(); ++i)
+    LogLikeOutput << residuals[i] << ' ' ;
+  LogLikeOutput << log_like << '\n';
+  LogLikeOutput.close();
+}
+
+
+/** Must be called with chainMutex held. */
+void NonDMUQBayesCalibration::pass_chain_turn(size_t chain)
+{
+  size_t next = chainActive.find_next(chain);
+  chainTurn = (next == BitArray::npos) ? numChains : next;
+  chainCondition.notify_all();
+}
+
+
 void NonDMUQBayesCalibration::map_pre_solve()
 {
   // doing a double check here to avoid a double copy if not optimizing 
@@ -639,9 +851,9 @@ void NonDMUQBayesCalibration::cache_chain()
 
   // temporaries for evals/lookups
   // the MCMC model omits the hyper params and residual transformations...
-  Variables lookup_vars = nonDMUQInstance->mcmcModel.current_variables().copy();
-  String   interface_id = nonDMUQInstance->mcmcModel.interface_id();
-  Response  lookup_resp = nonDMUQInstance->mcmcModel.current_response().copy();
+  Variables lookup_vars = mcmcModel.current_variables().copy();
+  String   interface_id = mcmcModel.interface_id();
+  Response  lookup_resp = mcmcModel.current_response().copy();
   ActiveSet   lookup_as = lookup_resp.active_set();
   lookup_as.request_values(1);
   lookup_resp.active_set(lookup_as);
@@ -702,9 +914,9 @@ void NonDMUQBayesCalibration::cache_chain()
     // now retreive function values
 
     if (mcmcModelHasSurrogate) {
-      nonDMUQInstance->mcmcModel.active_variables(lookup_vars);
-      nonDMUQInstance->mcmcModel.evaluate(lookup_resp.active_set());
-      const RealVector& fn_vals = nonDMUQInstance->mcmcModel.current_response().function_values();
+      mcmcModel.active_variables(lookup_vars);
+      mcmcModel.evaluate(lookup_resp.active_set());
+      const RealVector& fn_vals = mcmcModel.current_response().function_values();
       Teuchos::setCol(fn_vals, i, acceptedFnVals);
     }
     else {
@@ -19,6 +19,9 @@
 #include "MUQ/Modeling/Distributions/Density.h"
 #include "MUQ/Modeling/Distributions/DensityProduct.h"
 
+#include <condition_variable>
+#include <mutex>
+
 namespace Dakota {
 
 class MUQLikelihood;
@@ -90,6 +93,35 @@ protected:
   // perform sanity checks on proposalCovMatrix
   void validate_proposal();
 
+  /// assemble the Parameters -> {Prior, Likelihood} -> Posterior graph
+  std::shared_ptr<muq::Modeling::WorkGraph> construct_work_graph(
+    std::shared_ptr<muq::Modeling::IdentityOperator> parameters,
+    std::shared_ptr<MUQLikelihood> likelihood, std::shared_ptr<MUQPrior> prior,
+    std::shared_ptr<muq::Modeling::DensityProduct> posterior);
+
+  /// construct the proposal, transition kernel, and sampler for one
+  /// chain targeting the posterior density dens
+  std::shared_ptr<muq::SamplingAlgorithms::SingleChainMCMC> construct_chain(
+    boost::property_tree::ptree& pt,
+    std::shared_ptr<muq::Modeling::ModPiece> dens);
+
+  /// run numChains samplers in lockstep from init_pt, evaluating each
+  /// round of proposals as one batch, and interleave their samples
+  void run_chains(const Eigen::VectorXd& init_pt);
+
+  /// deposit the proposal c_vars of chain index chain into the current
+  /// round and block until the round has been evaluated
+  double chain_log_likelihood(size_t chain, const Eigen::VectorXd& c_vars);
+
+  /// pass the turn to the next active chain after chain, or to the
+  /// evaluating thread once every active chain has had its turn
+  void pass_chain_turn(size_t chain);
+
+  /// echo a log-likelihood evaluation and append its parameters,
+  /// residuals, and value to NonDMUQLogLike.txt (DEBUG_OUTPUT)
+  void log_likelihood_debug(const Real* params, const RealVector& residuals,
+                            Real log_like);
+
 
   //
   //- Heading: Data
@@ -105,6 +137,30 @@ protected:
   std::shared_ptr<muq::SamplingAlgorithms::SingleChainMCMC>  mcmc;
   std::shared_ptr<muq::SamplingAlgorithms::SampleCollection> samps;
 
+  /// number of independent chains run in lockstep (from the \c chains
+  /// specification)
+  size_t numChains;
+  /// one sampler per chain when numChains > 1; the first is mcmc
+  std::vector<std::shared_ptr<muq::SamplingAlgorithms::SingleChainMCMC>>
+    chainSamplers;
+
+  /// serializes the chains so that only one executes MUQ code at a time
+  std::mutex chainMutex;
+  /// signals a change of chainTurn
+  std::condition_variable chainCondition;
+  /// chain permitted to run; numChains designates the evaluating thread
+  size_t chainTurn;
+  /// set when an evaluation error ends the run, releasing waiting chains
+  bool chainAbort;
+  /// chains whose sampler has not yet returned
+  BitArray chainActive;
+  /// chains with a proposal awaiting evaluation in the current round
+  BitArray chainPending;
+  /// proposals of the current round, one column per chain
+  RealMatrix chainProposals;
+  /// log-likelihoods of the current round, one per chain
+  RealVector chainLogLikes;
+
   /// MCMC type ("dram" or "delayed_rejection" or "adaptive_metropolis" 
   /// or "metropolis_hastings" or "multilevel",  within QUESO) 
   String mcmcType;
@@ -198,9 +254,11 @@ public:
 
   inline MUQLikelihood( NonDMUQBayesCalibration       * nond_muq_ptr
                       , Eigen::VectorXi         const & input_sizes
+                      , size_t                          chain_index = 0
                       )
     : muq::Modeling::DensityBase(input_sizes)
     , nonDMUQInstancePtr        (nond_muq_ptr)
+    , chainIndex                (chain_index)
   {
     // Nothing extra to do
   };
@@ -215,6 +273,9 @@ protected:
 private:
 
   NonDMUQBayesCalibration * nonDMUQInstancePtr;
+
+  /// index of the chain whose proposals this likelihood evaluates
+  size_t chainIndex;
 };
 
 class MUQPrior : public muq::Modeling::DensityBase {
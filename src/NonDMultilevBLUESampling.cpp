@@ -18,6 +18,10 @@
 #include "ActiveKey.hpp"
 #include "DakotaIterator.hpp"
 #include "SharedPolyApproxData.hpp"
+#include "util_common.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
 
 static const char rcsId[]="@(#) $Id: NonDMultilevBLUESampling.cpp 7035 2010-10-22 21:45:39Z mseldre $";
 
@@ -29,12 +33,13 @@ namespace Dakota {
     probDescDB can be queried for settings from the method specification. */
 NonDMultilevBLUESampling::
 NonDMultilevBLUESampling(ProblemDescDB& problem_db, Model& model):
-  NonDNonHierarchSampling(problem_db, model),
+  NonDNonHierarchSampling(problem_db, model), psiMapValid(false),
   pilotGroupSampling(problem_db.get_short("method.nond.pilot_samples.mode")),
   groupThrottleType(problem_db.get_short("method.nond.group_throttle_type")),
   groupSizeThrottle(problem_db.get_ushort("method.nond.group_size_throttle")),
   rCondBestThrottle(problem_db.get_sizet("method.nond.rcond_best_throttle")),
-  rCondTolThrottle(problem_db.get_real("method.nond.rcond_tol_throttle"))
+  rCondTolThrottle(problem_db.get_real("method.nond.rcond_tol_throttle")),
+  pseudoInvThreads(problem_db.get_int("method.nond.pseudo_inverse_threads"))
 {
   mlmfSubMethod = problem_db.get_ushort("method.sub_method");
 
@@ -1382,10 +1387,10 @@ compute_GG_covariance(const RealMatrixArray& sum_G,
   initialize_rsm2a(cov_GG);  initialize_rsm2a(cov_GG_inv); // bypass if sized
 
   size_t g, m, m2, num_models, qoi, num_G_gq;
-  Real sum_G_gqm;  int code;  RealVector rcond(numFunctions);
-  bool rcond_throttle = (groupThrottleType == RCOND_TOLERANCE_THROTTLE ||
-			 groupThrottleType == RCOND_BEST_COUNT_THROTTLE);
-  if (rcond_throttle) groupCovCondMap.clear();
+  Real sum_G_gqm;  SizetSizetPairArray gq_updates;
+  if (groupCovRCond.numRows() != numFunctions ||
+      groupCovRCond.numCols() != numGroups)
+    groupCovRCond.shape(numFunctions, numGroups);
 
   for (g=0; g<numGroups; ++g) {
     num_models = modelGroups[g].size();
@@ -1408,19 +1413,20 @@ compute_GG_covariance(const RealMatrixArray& sum_G,
 	    compute_covariance(sum_G_gqm, sum_G_g(qoi,m2), sum_GG_gq(m,m2),
 			       num_G_gq, cov_GG_gq(m,m2));
 	}
-	compute_C_inverse(cov_GG_gq, cov_GG_inv_g[qoi], g, qoi, rcond[qoi]);
+	gq_updates.push_back(SizetSizetPair(g, qoi));
       }
-      else if (!update_prev) // inadequate samples to define covar
-	{ cov_GG_g[qoi].shape(0); cov_GG_inv_g[qoi].shape(0); rcond[qoi] = 0.; }
-      //else: leave as previous shared covariance and covariance-inverse
+      else if (!update_prev) { // inadequate samples to define covar
+	cov_GG_g[qoi].shape(0);  cov_GG_inv_g[qoi].shape(0);
+	groupCovRCond(qoi, g) = 0.;
+      }
+      //else: leave as previous shared covariance, covariance-inverse, and
+      //      cached rcond
     }
-    if (rcond_throttle)
-      groupCovCondMap.insert(std::pair<Real,size_t>(average(rcond), g));
   }
 
   // precompute 2D array of C_k inverses for numerical solver use
   // (Phi-inverse is dependent on N_G, but C-inverse is not)
-  //compute_C_inverse(cov_GG, cov_GG_inv);
+  compute_C_inverse(cov_GG, cov_GG_inv, gq_updates);
   if (outputLevel >= DEBUG_OUTPUT)
     Cout << "In compute_GG_covariance(), cov_GG:\n" << cov_GG
 	 << "cov_GG inverse:\n" << cov_GG_inv << std::endl;
@@ -1623,10 +1629,8 @@ compute_C_inverse(const RealSymMatrix& cov_GG_gq, RealSymMatrix& cov_GG_inv_gq,
     copy_data(cov_GG_gq, A);         // RealSymMatrix to RealMatrix
     pseudo_inverse(A, A_inv, rcond);
     copy_data(A_inv, cov_GG_inv_gq); // RealMatrix to RealSymMatrix
-    if (outputLevel >= DEBUG_OUTPUT)
-      Cout << "Pseudo-inverse by SVD for group " << group << " QoI " << qoi
-	   << ": rcond = " << rcond << " Inverse =\n" << cov_GG_inv_gq
-	   << "\n--------------\n" << std::endl;
+    // Note: may be invoked concurrently for different (group, qoi);
+    // debug output is deferred to the caller
  
     // Alternatives:
     // > Pseudo-inverse for covariances: is symmetric_eigenvalue_decomp()
@@ -1642,6 +1646,154 @@ compute_C_inverse(const RealSymMatrix& cov_GG_gq, RealSymMatrix& cov_GG_inv_gq,
 }
 
 
+/** The (pseudo-)inverses for the (group, QoI) pairs in gq_updates are
+    independent SVDs, which are distributed over pseudoInvThreads threads
+    (or by default, util::available_threads()).  The resulting
+    rcond estimates are cached in groupCovRCond, from which
+    groupCovCondMap is rebuilt for use by prune_model_groups(). */
+void NonDMultilevBLUESampling::
+compute_C_inverse(const RealSymMatrix2DArray& cov_GG,
+		  RealSymMatrix2DArray& cov_GG_inv,
+		  const SizetSizetPairArray& gq_updates)
+{
+  if (groupCovRCond.numRows() != numFunctions ||
+      groupCovRCond.numCols() != numGroups)
+    groupCovRCond.shape(numFunctions, numGroups);
+
+  // default thread count is this process's share of the node's hardware
+  // threads (see MPIManager::init_node_size())
+  int num_jobs = gq_updates.size(), num_threads = std::min(num_jobs,
+    (pseudoInvThreads > 0) ? pseudoInvThreads :
+    dakota::util::available_threads());
+  std::vector<std::exception_ptr> thread_except(num_threads);
+  std::atomic<int> job_cntr(0);
+  auto thread_fn = [&](int thread_index) {
+    try {
+      int j;
+      while ( (j = job_cntr++) < num_jobs ) {
+	size_t g = gq_updates[j].first, q = gq_updates[j].second;
+	compute_C_inverse(cov_GG[g][q], cov_GG_inv[g][q], g, q,
+			  groupCovRCond(q, g));
+      }
+    }
+    catch (...)
+      { thread_except[thread_index] = std::current_exception(); }
+  };
+  if (num_threads > 1) {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t=0; t<num_threads; ++t)
+      threads.emplace_back(thread_fn, t);
+    for (int t=0; t<num_threads; ++t)
+      threads[t].join();
+    for (int t=0; t<num_threads; ++t)
+      if (thread_except[t])
+	std::rethrow_exception(thread_except[t]);
+  }
+  else if (num_jobs)
+    thread_fn(0);
+
+  if (outputLevel >= DEBUG_OUTPUT)
+    for (int j=0; j<num_jobs; ++j) {
+      size_t g = gq_updates[j].first, q = gq_updates[j].second;
+      Cout << "Pseudo-inverse by SVD for group " << g << " QoI " << q
+	   << ": rcond = " << groupCovRCond(q, g) << " Inverse =\n"
+	   << cov_GG_inv[g][q] << "\n--------------\n" << std::endl;
+    }
+
+  // rank groups from the cached rcond estimates
+  if (groupThrottleType == RCOND_TOLERANCE_THROTTLE ||
+      groupThrottleType == RCOND_BEST_COUNT_THROTTLE) {
+    groupCovCondMap.clear();
+    for (size_t g=0; g<numGroups; ++g) {
+      RealVector rcond_g(Teuchos::View, groupCovRCond[g], numFunctions);
+      groupCovCondMap.insert(std::pair<Real,size_t>(average(rcond_g), g));
+    }
+  }
+
+  psiMapValid = false; // C-inverses have changed
+}
+
+
+/** Psi_q = sum_g v_g R_g^T C_gq^{-1} R_g is linear in the group sample
+    design variables, so each packed lower-triangular entry of Psi_q is
+    a sparse inner product of (nonnegative) design variables with the
+    C-inverse terms that scatter into it.  This sparse operator is
+    formed once per update to covGGinv or to the retained groups, after
+    which Psi assembly within the numerical solve involves only these
+    inner products. */
+void NonDMultilevBLUESampling::update_Psi_map()
+{
+  size_t q, g, r, c, e, num_models_g, v_index, all_models = numApprox + 1,
+    num_entries = all_models * (all_models + 1) / 2;
+  bool no_retain_throttle = retainedModelGroups.empty();
+  psiMapOffsets.resize(numFunctions);  psiMapVarIndices.resize(numFunctions);
+  psiMapCoeffs.resize(numFunctions);
+  std::vector<std::vector<std::pair<size_t, Real> > > entry_terms(num_entries);
+  for (q=0; q<numFunctions; ++q) {
+    for (e=0; e<num_entries; ++e) entry_terms[e].clear();
+    for (g=0, v_index=0; g<numGroups; ++g) {
+      if (!no_retain_throttle && !retainedModelGroups[g]) continue;
+      const RealSymMatrix& cov_GG_inv_gq = covGGinv[g][q];
+      const UShortArray& models_g = modelGroups[g];
+      num_models_g = cov_GG_inv_gq.numRows();
+      for (r=0; r<num_models_g; ++r)
+	for (c=0; c<=r; ++c) {
+	  size_t m_r = models_g[r], m_c = models_g[c];
+	  if (m_r < m_c) std::swap(m_r, m_c);
+	  entry_terms[m_r * (m_r + 1) / 2 + m_c].push_back(
+	    std::pair<size_t, Real>(v_index, cov_GG_inv_gq(r,c)));
+	}
+      ++v_index;
+    }
+    SizetArray& offsets_q = psiMapOffsets[q];
+    SizetArray& indices_q = psiMapVarIndices[q];
+    RealArray&   coeffs_q = psiMapCoeffs[q];
+    offsets_q.resize(num_entries + 1);  indices_q.clear();  coeffs_q.clear();
+    for (e=0; e<num_entries; ++e) {
+      offsets_q[e] = indices_q.size();
+      const std::vector<std::pair<size_t, Real> >& terms_e = entry_terms[e];
+      for (size_t t=0; t<terms_e.size(); ++t) {
+	indices_q.push_back(terms_e[t].first);
+	coeffs_q.push_back(terms_e[t].second);
+      }
+    }
+    offsets_q[num_entries] = indices_q.size();
+  }
+  psiMapValid = true;
+}
+
+
+/** This version used during numerical solution, using the sparse
+    operator from update_Psi_map(). */
+void NonDMultilevBLUESampling::
+compute_Psi(const RealVector& cdv, RealSymMatrixArray& Psi)
+{
+  if (!psiMapValid) update_Psi_map();
+  initialize_rsma(Psi, false);
+
+  // as for compute_Psi(cov_GG_inv, cdv, Psi), groups with nonpositive
+  // samples do not contribute
+  size_t i, q, r, c, e, k, num_v = cdv.length(), all_models = numApprox + 1;
+  RealArray v_pos(num_v);
+  for (i=0; i<num_v; ++i)
+    v_pos[i] = std::max(cdv[i], 0.);
+  for (q=0; q<numFunctions; ++q) {
+    const SizetArray& offsets_q = psiMapOffsets[q];
+    const SizetArray& indices_q = psiMapVarIndices[q];
+    const RealArray&   coeffs_q = psiMapCoeffs[q];
+    RealSymMatrix& Psi_q = Psi[q];
+    for (r=0, e=0; r<all_models; ++r)
+      for (c=0; c<=r; ++c, ++e) {
+	Real sum = 0.;
+	for (k=offsets_q[e]; k<offsets_q[e+1]; ++k)
+	  sum += coeffs_q[k] * v_pos[indices_q[k]];
+	Psi_q(r,c) = sum;
+      }
+  }
+}
+
+
 void NonDMultilevBLUESampling::
 compute_mu_hat(const RealSymMatrix2DArray& cov_GG_inv,
 	       const RealMatrixArray& sum_G, const Sizet2DArray& N_G,
@@ -1701,7 +1853,7 @@ estimator_variance(const RealVector& cd_vars, RealVector& estvar)
   // equilibration during factorization (inverting Psi in place can only
   // leverage the latter).  It seems to work much more reliably.
   RealSymMatrixArray Psi;
-  compute_Psi(covGGinv, cd_vars, Psi);
+  compute_Psi(cd_vars, Psi);
 
   size_t q, all_models = numApprox + 1;
 
@@ -1759,6 +1911,8 @@ estimator_variance(const RealVector& cd_vars, RealVector& estvar)
 
 void NonDMultilevBLUESampling::prune_model_groups()
 {
+  psiMapValid = false; // retained groups define the design variables
+
   if (groupThrottleType != RCOND_BEST_COUNT_THROTTLE &&
       groupThrottleType != RCOND_TOLERANCE_THROTTLE )
     { retainedModelGroups.clear(); return; }
@@ -89,8 +89,13 @@ protected:
 			 size_t group, size_t qoi, Real& rcond);
   void compute_C_inverse(const RealSymMatrix2DArray& cov_GG,
 			 RealSymMatrix2DArray& cov_GG_inv);
+  void compute_C_inverse(const RealSymMatrix2DArray& cov_GG,
+			 RealSymMatrix2DArray& cov_GG_inv,
+			 const SizetSizetPairArray& gq_updates);
   void compute_Psi(const RealSymMatrix2DArray& cov_GG_inv,
 		   const RealVector& N_G, RealSymMatrixArray& Psi);
+  void compute_Psi(const RealVector& N_G, RealSymMatrixArray& Psi);
+  void update_Psi_map();
   void compute_Psi(const RealSymMatrix2DArray& cov_GG_inv,
 		   const Sizet2DArray& N_G, RealSymMatrixArray& Psi);
   /*
@@ -272,6 +277,19 @@ private:
   /// in-place matrix inverses of covGG
   RealSymMatrix2DArray covGGinv;
 
+  /// for each QoI, offsets into psiMapVarIndices and psiMapCoeffs for
+  /// each packed lower-triangular entry of Psi (see update_Psi_map())
+  Sizet2DArray psiMapOffsets;
+  /// for each QoI, the group design variable index for each term
+  /// contributing to Psi
+  Sizet2DArray psiMapVarIndices;
+  /// for each QoI, the covGGinv coefficient for each term contributing
+  /// to Psi
+  Real2DArray psiMapCoeffs;
+  /// indicates that the psiMap* operator is consistent with covGGinv
+  /// and retainedModelGroups
+  bool psiMapValid;
+
   /// mode for pilot sampling: shared or independent
   short pilotGroupSampling;
 
@@ -285,8 +303,14 @@ private:
   /// throttle the number of groups based on this tolerance for
   /// condition number in group covariance
   Real rCondTolThrottle;
+  /// number of threads for the group covariance (pseudo-)inverses
+  /// (0 defaults to util::available_threads())
+  int pseudoInvThreads;
   /// map from rcond to group number: pick the first rCondBestThrottle groups
   std::multimap<Real, size_t> groupCovCondMap;
+  /// cached rcond estimates from the group covariance pseudo-inverses,
+  /// numFunctions x numGroups
+  RealMatrix groupCovRCond;
   /// runtime group throttling due to covariance conditioning
   BitArray retainedModelGroups;
 
@@ -679,20 +703,13 @@ compute_C_inverse(const RealSymMatrix2DArray& cov_GG,
 {
   // cov matrices are sized according to group member size
   initialize_rsm2a(cov_GG_inv);
-  bool rcond_throttle = (groupThrottleType == RCOND_TOLERANCE_THROTTLE ||
-			 groupThrottleType == RCOND_BEST_COUNT_THROTTLE);
-  if (rcond_throttle) groupCovCondMap.clear();
 
   size_t q, g, num_groups = modelGroups.size();
-  RealVector rcond(numFunctions);
-  for (g=0; g<num_groups; ++g) {
-    const RealSymMatrixArray& cov_GG_g = cov_GG[g];
-    RealSymMatrixArray&   cov_GG_inv_g = cov_GG_inv[g];
+  SizetSizetPairArray gq_updates;  gq_updates.reserve(num_groups*numFunctions);
+  for (g=0; g<num_groups; ++g)
     for (q=0; q<numFunctions; ++q)
-      compute_C_inverse(cov_GG_g[q], cov_GG_inv_g[q], g, q, rcond[q]);
-    if (rcond_throttle)
-      groupCovCondMap.insert(std::pair<Real,size_t>(average(rcond), g));
-  }
+      gq_updates.push_back(SizetSizetPair(g, q));
+  compute_C_inverse(cov_GG, cov_GG_inv, gq_updates);
 }
 
 
@@ -264,19 +264,16 @@ transform_samples(Pecos::ProbabilityTransformation& nataf,
   //else if (sample_matrix.numCols() != num_samples)
   //  sample_matrix.shapeUninitialized(numContinuousVars, num_samples);
 
+  // the source copy of each sample reuses one buffer for the whole batch
   size_t num_samples = sample_matrix.numCols();
-  if (x_to_u)
-    for (size_t i=0; i<num_samples; ++i) {
-      RealVector x_samp(Teuchos::Copy, sample_matrix[i], numContinuousVars);
-      RealVector u_samp(Teuchos::View, sample_matrix[i], numContinuousVars);
-      nataf.trans_X_to_U(x_samp, src_cv_ids, u_samp, tgt_cv_ids);
-    }
-  else
-    for (size_t i=0; i<num_samples; ++i) {
-      RealVector u_samp(Teuchos::Copy, sample_matrix[i], numContinuousVars);
-      RealVector x_samp(Teuchos::View, sample_matrix[i], numContinuousVars);
-      nataf.trans_U_to_X(u_samp, src_cv_ids, x_samp, tgt_cv_ids);
-    }
+  RealVector src_samp(numContinuousVars, false);
+  for (size_t i=0; i<num_samples; ++i) {
+    Real* samp_i = sample_matrix[i];
+    std::copy(samp_i, samp_i + numContinuousVars, src_samp.values());
+    RealVector tgt_samp(Teuchos::View, samp_i, numContinuousVars);
+    if (x_to_u) nataf.trans_X_to_U(src_samp, src_cv_ids, tgt_samp, tgt_cv_ids);
+    else        nataf.trans_U_to_X(src_samp, src_cv_ids, tgt_samp, tgt_cv_ids);
+  }
 }
 
 
@@ -973,11 +970,86 @@ void NonDSampling::active_set_mapping()
 void NonDSampling::core_run()
 {
   Cout << "Hello from NonDSampling::core_run" << std::endl;
-  bool log_resp_flag = (allDataFlag || statsFlag), log_best_flag = false;
+  bool stream_moments = initialize_streamed_moments(),
+    log_resp_flag = (allDataFlag || statsFlag) && !stream_moments,
+    log_best_flag = false;
   evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
 }
 
 
+/** Correlations (top-level), level mappings, regression coefficients,
+    VBD, and moment gradients all require the complete set of responses.
+    Tolerance intervals are accumulated alongside the moments. */
+bool NonDSampling::initialize_streamed_moments(bool require_responses)
+{
+  streamedCounts.clear(); streamedSums.shape(0, 0);
+
+  if (require_responses || !evalWindow || !statsFlag || !subIteratorFlag ||
+      allDataFlag || epistemicStats || totalLevelRequests ||
+      stdRegressionCoeffs || vbdFlag)
+    return false;
+  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+  for (size_t i=0; i<final_asv.size(); ++i)
+    if (final_asv[i] & 2)
+      return false;
+
+  streamedCounts.assign(numFunctions, 0);
+  streamedSums.shape(4, numFunctions);
+  if (toleranceIntervalsFlag)
+    { tiNumValidSamples = 0; tiStreamedMus.size(0); tiStreamedSumSqDiffs.size(0); }
+  return true;
+}
+
+
+/** One-pass updates of the mean and central sums (Pebay, 2008), which
+    avoid the cancellation of accumulating raw power sums. */
+void NonDSampling::process_response_batch(const IntResponseMap& resp_map)
+{
+  if (streamedCounts.empty())
+    return;
+
+  for (IntRespMCIter r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit) {
+    const RealVector& fn_vals = r_cit->second.function_values();
+    for (size_t i=0; i<numFunctions; ++i) {
+      Real sample = fn_vals[i];
+      if (!std::isfinite(sample)) // omit failed evaluations
+	continue;
+      accumulate_central_sums(sample, streamedCounts[i]++, streamedSums[i]);
+    }
+  }
+
+  if (toleranceIntervalsFlag)
+    accumulateDSTIEN(resp_map, tiNumValidSamples, tiStreamedMus,
+		     tiStreamedSumSqDiffs);
+}
+
+
+void NonDSampling::compute_streamed_moments()
+{
+  if (momentStats.empty()) momentStats.shapeUninitialized(4, numFunctions);
+  const StringArray& labels = iteratedModel.response_labels();
+  for (size_t i=0; i<numFunctions; ++i) {
+    size_t num_samp = streamedCounts[i];
+    Real* moments_i = momentStats[i];
+    if (num_samp)
+      central_sums_to_moments(streamedSums[i], num_samp,
+			      finalMomentsType != Pecos::CENTRAL_MOMENTS,
+			      moments_i);
+    else {
+      Cerr << "Warning: Number of samples for " << labels[i]
+	   << " must be nonzero for moment calculation in NonDSampling::"
+	   << "compute_streamed_moments().\n";
+      for (size_t j=0; j<4; ++j)
+	moments_i[j] = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  compute_moment_confidence_intervals(momentStats, momentCIs, streamedCounts,
+				      finalMomentsType);
+  functionMomentsComputed = true;
+}
+
+
 void NonDSampling::
 compute_statistics(const RealMatrix&     vars_samples,
 		   const IntResponseMap& resp_samples)
@@ -1020,7 +1092,10 @@ compute_statistics(const RealMatrix&     vars_samples,
   }
   else { // Aleatory
     // compute means and std deviations with confidence intervals
-    compute_moments(resp_samples);
+    if (resp_samples.empty() && !streamedCounts.empty())
+      compute_streamed_moments(); // responses streamed and not retained
+    else
+      compute_moments(resp_samples);
     // compute CDF/CCDF mappings of z to p/beta and p/beta to z
     if (totalLevelRequests)
       compute_level_mappings(resp_samples);
@@ -1034,7 +1109,22 @@ compute_statistics(const RealMatrix&     vars_samples,
     nonDSampCorr.compute_std_regress_coeffs(vars_samples, resp_samples);
   }
 
-  if (toleranceIntervalsFlag) {
+  if (toleranceIntervalsFlag && resp_samples.empty() &&
+      !streamedCounts.empty()) {
+    if (tiStreamedMus.empty()) // no streamed evaluations
+      { tiStreamedMus.size(numFunctions); tiStreamedSumSqDiffs.size(numFunctions); }
+    computeDSTIEN( tiNumValidSamples
+                 , tiStreamedMus
+                 , tiStreamedSumSqDiffs
+                 , tiCoverage
+                 , 1. - tiConfidenceLevel
+                 , tiDstienMus                 // Output
+                 , tiDeltaMultiplicativeFactor // Output
+                 , tiSampleSigmas              // Output
+                 , tiDstienSigmas              // Output
+                 );
+  }
+  else if (toleranceIntervalsFlag) {
     computeDSTIEN( resp_samples
                  , tiCoverage
                  , 1. - tiConfidenceLevel
@@ -110,6 +110,15 @@ public:
   /// z to p/beta and of p/beta to z as well as PDFs
   void compute_level_mappings(const IntResponseMap& samples);
 
+  /// when moments are the only statistics required and an evaluation
+  /// window is active, prepare to accumulate them from streamed
+  /// evaluations in lieu of retaining responses; returns true if so.
+  /// Accumulators from a previous run are always cleared, including
+  /// when the caller requires the responses (require_responses).
+  bool initialize_streamed_moments(bool require_responses = false);
+  /// accumulate running moments from a batch of streamed evaluations
+  void process_response_batch(const IntResponseMap& resp_map);
+
   /// prints the statistics computed in compute_statistics()
   void print_statistics(std::ostream& s) const;
 
@@ -417,9 +426,24 @@ private:
   void sample_to_drv(const Real* sample_vars, Variables& vars,
 		     size_t& adrv_index, size_t num_adrv, size_t& samp_index);
 
+  /// convert the streamed moment accumulators into momentStats/momentCIs
+  void compute_streamed_moments();
+
   //
   //- Heading: Data
   //
+
+  /// per-function counts of finite samples accumulated from streamed
+  /// evaluations (empty when responses are retained)
+  SizetArray streamedCounts;
+  /// per-function running mean and central sums of powers 2-4 for
+  /// streamed evaluations (4 x numFunctions)
+  RealMatrix streamedSums;
+  /// running means of the valid samples for tolerance intervals, accumulated
+  /// from streamed evaluations along with tiNumValidSamples
+  RealVector tiStreamedMus;
+  /// running sums of squared deviations from tiStreamedMus
+  RealVector tiStreamedSumSqDiffs;
   
   /// Matrix of confidence internals on moments, with rows for mean_lower,
   /// mean_upper, sd_lower, sd_upper (calculated in compute_moments())
@@ -301,6 +301,72 @@ void NonDSparseGrid::increment_grid_weights(const RealVector& aniso_wts)
 }
 
 
+/** Generalized sparse grid refinement assesses each candidate set in
+    turn.  To support a single concurrent wave for all new candidates,
+    this function is called between increment_set(set) and
+    decrement_set(): the trial grid is computed and its evaluations are
+    scheduled (asynchronously) as a batch identified with the set.  A
+    trial set may add no new points (e.g., under restricted growth), in
+    which case nothing is queued and evaluate_set(set) falls back to
+    evaluate_set(). */
+bool NonDSparseGrid::queue_set(const UShortArray& set)
+{
+  ssgDriver->compute_trial_grid(allSamples);
+  if (allSamples.numCols() == 0)
+    return false;
+
+  int batch_id = (batchSamplesMap.empty()) ? 0 :
+    batchSamplesMap.rbegin()->first + 1;
+  evaluate_batch(iteratedModel, batch_id);
+  queuedSetBatches[set] = batch_id;
+  return true;
+}
+
+
+void NonDSparseGrid::synchronize_sets()
+{
+  // synchronous evaluate_batch() has already logged its responses
+  if (!queuedSetBatches.empty() && iteratedModel.asynch_flag())
+    synchronize_batches(iteratedModel);
+}
+
+
+/** A queued set was popped after its trial grid was computed, such
+    that SparseGridDriver::push_set() restores its trial points and
+    weights; the cached batch then replaces all{Samples,Responses} for
+    use by DataFitSurrModel::append_approximation(). */
+void NonDSparseGrid::evaluate_set(const UShortArray& set)
+{
+  std::map<UShortArray, int>::iterator q_it = queuedSetBatches.find(set);
+  if (q_it == queuedSetBatches.end())
+    { evaluate_set(); return; }
+
+  int batch_id = q_it->second;
+  ssgDriver->push_set();
+
+  IntIntRealVector2DMap::iterator s_it = batchSamplesMap.find(batch_id);
+  IntIntResponse2DMap::iterator   r_it = batchResponsesMap.find(batch_id);
+  if (s_it == batchSamplesMap.end() || r_it == batchResponsesMap.end()) {
+    Cerr << "Error: queued evaluations for trial set not available in "
+	 << "NonDSparseGrid::evaluate_set()." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+  const IntRealVectorMap& samp_map = s_it->second;
+  size_t i, num_samp = samp_map.size(),
+    num_cv = (num_samp) ? samp_map.begin()->second.length() : 0;
+  allSamples.shapeUninitialized(num_cv, num_samp);
+  IntRVMCIter rv_cit;
+  for (i=0, rv_cit=samp_map.begin(); rv_cit!=samp_map.end(); ++i, ++rv_cit)
+    std::copy(rv_cit->second.values(), rv_cit->second.values() + num_cv,
+	      allSamples[i]);
+  allResponses = r_it->second; // ordered by eval id, consistent with samples
+
+  batchSamplesMap.erase(s_it);  batchResponsesMap.erase(r_it);
+  queuedSetBatches.erase(q_it);
+  ++numIntegrations;
+}
+
+
 void NonDSparseGrid::decrement_grid()
 {
   // adaptive increment logic is not reversible, so use ssgLevelPrev
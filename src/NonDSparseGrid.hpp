@@ -93,6 +93,15 @@ public:
   void push_set();
   /// invokes SparseGridDriver::compute_trial_grid()
   void evaluate_set();
+  /// retrieves the evaluations queued for set by queue_set(), if any,
+  /// or else invokes evaluate_set()
+  void evaluate_set(const UShortArray& set);
+  /// computes the trial grid for set and queues its evaluations as a
+  /// batch, for retrieval by evaluate_set(set) following synchronize_sets();
+  /// returns false (queueing nothing) when the trial grid adds no points
+  bool queue_set(const UShortArray& set);
+  /// synchronizes all batches queued by queue_set() in a single wave
+  void synchronize_sets();
   /// invokes SparseGridDriver::pop_set()
   void decrement_set();
   /// invokes SparseGridDriver::update_sets()
@@ -146,6 +155,10 @@ private:
   /// in decrement_grid() since increment must induce a change in grid size
   /// and this adaptive increment in not reversible
   unsigned short ssgLevelPrev;
+
+  /// batch ids for the candidate sets queued by queue_set() and not yet
+  /// retrieved by evaluate_set(set)
+  std::map<UShortArray, int> queuedSetBatches;
 };
 
 
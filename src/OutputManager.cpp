@@ -8,6 +8,7 @@
     _______________________________________________________________________ */
 
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/regex.hpp>
@@ -37,6 +38,9 @@ extern PRPCache data_pairs;
 extern ResultsManager iterator_results_db;
 extern EvaluationStore evaluation_store_db;
 
+/// serializes restart appends from concurrent (threaded) sub-iterators
+static std::mutex restartMutex;
+
 // BMA TODO: consider removing or reimplementing
 /** Heartbeat function provided by dakota_filesystem_utils; pass
     output interval in seconds, or -1 to use $DAKOTA_HEARTBEAT */
@@ -404,6 +408,8 @@ void OutputManager::append_restart(const ParamResponsePair& prp)
 	 << std::endl;
     abort_handler(-1);
   }
+  // serialize restart records from threaded sub-iterators
+  std::lock_guard<std::mutex> restart_lock(restartMutex);
   std::shared_ptr<RestartWriter> rst_writer = restartDestinations.back();
   rst_writer->append_prp(prp);
   // flush is critical so we have a complete restart record should Dakota abort
@@ -411,6 +417,31 @@ void OutputManager::append_restart(const ParamResponsePair& prp)
 }
 
 
+/** The active writer, together with any levels of the destination
+    stack that share it, is replaced by a new writer for the same file.
+    The old stream is closed before the file is reopened for writing. */
+void OutputManager::truncate_restart()
+{
+  if (restartDestinations.empty() ||
+      restartDestinations.back()->filename().empty())
+    return; // no restart output is active
+
+  std::lock_guard<std::mutex> restart_lock(restartMutex);
+  std::shared_ptr<RestartWriter> old_writer = restartDestinations.back();
+  String rst_filename(old_writer->filename());
+  SizetArray shared_levels;
+  for (size_t i=0; i<restartDestinations.size(); ++i)
+    if (restartDestinations[i] == old_writer)
+      { shared_levels.push_back(i); restartDestinations[i].reset(); }
+  old_writer.reset(); // last reference: closes the restart stream
+
+  std::shared_ptr<RestartWriter>
+    rst_writer(new RestartWriter(rst_filename));
+  for (size_t i=0; i<shared_levels.size(); ++i)
+    restartDestinations[shared_levels[i]] = rst_writer;
+}
+
+
 /** Opens the tabular data file stream and prints headings, one for
     each active continuous and discrete variable and one for each response
     function, using the variable and response function labels. This
@@ -240,6 +240,9 @@ public:
 
   /// append a parameter/response set to the restart file
   void append_restart(const ParamResponsePair& prp);
+  /// discard the records in the active restart file, retaining only
+  /// a new version header
+  void truncate_restart();
 
 
   // -----
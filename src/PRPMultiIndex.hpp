@@ -81,22 +81,58 @@ set_compare(const ParamResponsePair& database_pr, const ActiveSet& search_set)
 // Comparison and hashing functions for PRPCache/PRPQueue
 // ------------------------------------------------------
 
-/// search function for a particular ParamResponsePair within a PRPMultiIndex
+/// search key for lookups by interface id and variables
+
+/** A lightweight (non-owning) alternative to a search ParamResponsePair
+    for hashed lookups, which avoids constructing a search Response (and
+    its letter, data arrays, and ActiveSet) on each lookup.  The
+    fingerprint is formed once per key, for use in both hashing and
+    comparison within the equal_range() traversal. */
+struct PRPSearchKey {
+  /// constructor
+  PRPSearchKey(const String& interface_id, const Variables& vars):
+    interfaceId(interface_id), variables(vars),
+    interfaceIndex(interface_id_index(interface_id)),
+    fingerprint(prp_fingerprint(interfaceIndex, vars))
+  { }
+  /// constructor given the cached interned index of interface_id
+  PRPSearchKey(const String& interface_id, int interface_index,
+	       const Variables& vars):
+    interfaceId(interface_id), variables(vars), interfaceIndex(interface_index),
+    fingerprint(prp_fingerprint(interface_index, vars))
+  { }
+  /// constructor reusing the fingerprint of a search pair
+  explicit PRPSearchKey(const ParamResponsePair& search_pr):
+    interfaceId(search_pr.interface_id()), variables(search_pr.variables()),
+    interfaceIndex(search_pr.interface_id_index()),
+    fingerprint(search_pr.fingerprint())
+  { }
+
+  const String&    interfaceId; ///< interface id of the search
+  const Variables& variables;   ///< variables of the search
+  int              interfaceIndex; ///< interned index of interfaceId
+  PRPFingerprint   fingerprint;    ///< fingerprint of interfaceId/variables
+};
 
-/** a global function to compare the interface id and variables of a
-    particular database_pr (presumed to be in the global history list) with
-    a passed in key of interface id and variables provided by search_pr. */
+
+/// compare the interface id and variables of database_pr with those of
+/// a search, given its interned interface id and fingerprint
 inline bool id_vars_exact_compare(const ParamResponsePair& database_pr,
-				  const ParamResponsePair& search_pr)
+				  int search_interface_index,
+				  const PRPFingerprint& search_fingerprint,
+				  const Variables& search_vars)
 {
-  // First check interface id strings.  If a different interface was used, then
+  // First check interface ids.  If a different interface was used, then
   // we must assume that the results are not interchangeable (differing model
   // fidelity).
-  if ( search_pr.interface_id()   != database_pr.interface_id() )
+  if ( search_interface_index != database_pr.interface_id_index() )
     return false;
 
-  // For Boost hashing, need exact binary equality (not tolerance-based)
-  if ( search_pr.variables() != database_pr.variables() )
+  // Differing fingerprints reject without traversing the variables data;
+  // equal fingerprints are confirmed with exact binary equality (not
+  // tolerance-based) as required for Boost hashing
+  if ( !(search_fingerprint == database_pr.fingerprint()) ||
+       search_vars != database_pr.variables() )
     return false;
 
   // For Boost hashing, a post-processing step is used to manage the ActiveSet
@@ -105,21 +141,34 @@ inline bool id_vars_exact_compare(const ParamResponsePair& database_pr,
   return true;
 }
 
+/// search function for a particular ParamResponsePair within a PRPMultiIndex
 
-/// hash_value for ParamResponsePairs stored in a PRPMultiIndex
-inline std::size_t hash_value(const ParamResponsePair& prp)
+/** a global function to compare the interface id and variables of a
+    particular database_pr (presumed to be in the global history list) with
+    a passed in key of interface id and variables provided by search_pr. */
+inline bool id_vars_exact_compare(const ParamResponsePair& database_pr,
+				  const ParamResponsePair& search_pr)
 {
-  // hash using interface ID string.
-  std::size_t seed = 0;
-  boost::hash_combine(seed, prp.interface_id());
+  return id_vars_exact_compare(database_pr, search_pr.interface_id_index(),
+			       search_pr.fingerprint(), search_pr.variables());
+}
 
-  // Now, hash values of variables using Variables hash_value friend function
-  boost::hash_combine(seed, prp.variables());
 
-  return seed;
+/// compare the interface id and variables of database_pr with a search key
+inline bool id_vars_exact_compare(const ParamResponsePair& database_pr,
+				  const PRPSearchKey& key)
+{
+  return id_vars_exact_compare(database_pr, key.interfaceIndex,
+			       key.fingerprint, key.variables);
 }
 
 
+/// hash_value for ParamResponsePairs stored in a PRPMultiIndex: the
+/// precomputed fingerprint of the interface id and variables
+inline std::size_t hash_value(const ParamResponsePair& prp)
+{ return prp.fingerprint().hash; }
+
+
 // --------------------------------------
 // structs and typedefs for PRPMultiIndex
 // --------------------------------------
@@ -130,6 +179,9 @@ struct partial_prp_hash {
   /// access operator
   std::size_t operator()(const ParamResponsePair& prp) const
   { return hash_value(prp); } // ONLY interfaceId & Vars used for hash_value
+  /// access operator for compatible key lookups
+  std::size_t operator()(const PRPSearchKey& key) const
+  { return key.fingerprint.hash; }
 };
 
 /// predicate for comparing ONLY the interfaceId and Vars attributes of PRPair
@@ -138,6 +190,13 @@ struct partial_prp_equality {
   bool operator()(const ParamResponsePair& database_pr,
                   const ParamResponsePair& search_pr) const
   { return id_vars_exact_compare(database_pr, search_pr); }
+  /// access operators for compatible key lookups
+  bool operator()(const PRPSearchKey& key,
+		  const ParamResponsePair& database_pr) const
+  { return id_vars_exact_compare(database_pr, key); }
+  bool operator()(const ParamResponsePair& database_pr,
+		  const PRPSearchKey& key) const
+  { return id_vars_exact_compare(database_pr, key); }
 };
 
 
@@ -240,9 +299,11 @@ inline PRPQueueHIter hashedQueueEnd(PRPQueue& prp_queue)
 inline PRPCacheHIter
 lookup_by_val(PRPMultiIndexCache& prp_cache, const ParamResponsePair& search_pr)
 {
+  PRPSearchKey search_key(search_pr);
   PRPCacheHIter prp_hash_it0, prp_hash_it1;
   boost::tuples::tie(prp_hash_it0, prp_hash_it1)
-    = prp_cache.get<hashed>().equal_range(search_pr);
+    = prp_cache.get<hashed>().equal_range(search_key, partial_prp_hash(),
+					  partial_prp_equality());
 
   // equal_range returns a small sequence of possibilities resulting from
   // hashing with ONLY interfaceId and variables.  Post-processing is then
@@ -256,15 +317,34 @@ lookup_by_val(PRPMultiIndexCache& prp_cache, const ParamResponsePair& search_pr)
 }
 
 
-/// find a ParamResponsePair within a PRPMultiIndexCache based on the
+/// find a ParamResponsePair within a PRPMultiIndexCache based on a
+/// search key (interface id and fingerprinted variables) and ActiveSet
+inline PRPCacheHIter
+lookup_by_val(PRPMultiIndexCache& prp_cache, const PRPSearchKey& search_key,
+	      const ActiveSet& search_set)
+{
+  // compatible key lookup: no search Response/ParamResponsePair is allocated
+  PRPCacheHIter prp_hash_it0, prp_hash_it1;
+  boost::tuples::tie(prp_hash_it0, prp_hash_it1)
+    = prp_cache.get<hashed>().equal_range(search_key, partial_prp_hash(),
+					  partial_prp_equality());
+  while (prp_hash_it0 != prp_hash_it1) {
+    if (set_compare(*prp_hash_it0, search_set))
+      return prp_hash_it0;
+    ++prp_hash_it0;
+  }
+  return prp_cache.get<hashed>().end();
+}
+
+
+/// find a ParamResponsePair within a PRPMultiIndexCache based on
 /// interface id, variables, and ActiveSet search data
 inline PRPCacheHIter
 lookup_by_val(PRPMultiIndexCache& prp_cache, const String& search_interface_id,
 	      const Variables& search_vars,  const ActiveSet& search_set)
 {
-  Response search_resp(SIMULATION_RESPONSE, search_set);
-  ParamResponsePair search_pr(search_vars, search_interface_id, search_resp);
-  return lookup_by_val(prp_cache, search_pr);
+  PRPSearchKey search_key(search_interface_id, search_vars);
+  return lookup_by_val(prp_cache, search_key, search_set);
 }
 
 
@@ -452,9 +532,11 @@ lookup_by_ids(PRPMultiIndexCache& prp_cache, const ParamResponsePair& search_pr,
 inline PRPQueueHIter
 lookup_by_val(PRPMultiIndexQueue& prp_queue, const ParamResponsePair& search_pr)
 {
+  PRPSearchKey search_key(search_pr);
   PRPQueueHIter prp_hash_it0, prp_hash_it1;
   boost::tuples::tie(prp_hash_it0, prp_hash_it1)
-    = prp_queue.get<hashed>().equal_range(search_pr);
+    = prp_queue.get<hashed>().equal_range(search_key, partial_prp_hash(),
+					  partial_prp_equality());
 
   // equal_range returns a small sequence of possibilities resulting from
   // hashing with ONLY interfaceId and variables.  Post-processing is then
@@ -468,15 +550,34 @@ lookup_by_val(PRPMultiIndexQueue& prp_queue, const ParamResponsePair& search_pr)
 }
 
 
+/// find a ParamResponsePair within a PRPMultiIndexQueue based on a
+/// search key (interface id and fingerprinted variables) and ActiveSet
+inline PRPQueueHIter
+lookup_by_val(PRPMultiIndexQueue& prp_queue, const PRPSearchKey& search_key,
+	      const ActiveSet& search_set)
+{
+  // compatible key lookup: no search Response/ParamResponsePair is allocated
+  PRPQueueHIter prp_hash_it0, prp_hash_it1;
+  boost::tuples::tie(prp_hash_it0, prp_hash_it1)
+    = prp_queue.get<hashed>().equal_range(search_key, partial_prp_hash(),
+					  partial_prp_equality());
+  while (prp_hash_it0 != prp_hash_it1) {
+    if (set_compare(*prp_hash_it0, search_set))
+      return prp_hash_it0;
+    ++prp_hash_it0;
+  }
+  return prp_queue.get<hashed>().end();
+}
+
+
 /// find a ParamResponsePair within a PRPMultiIndexQueue based on
 /// interface id, variables, and ActiveSet search data
 inline PRPQueueHIter
 lookup_by_val(PRPMultiIndexQueue& prp_queue, const String& search_interface_id,
 	      const Variables& search_vars,  const ActiveSet& search_set)
 {
-  Response search_resp(SIMULATION_RESPONSE, search_set);
-  ParamResponsePair search_pr(search_vars, search_interface_id, search_resp);
-  return lookup_by_val(prp_queue, search_pr);
+  PRPSearchKey search_key(search_interface_id, search_vars);
+  return lookup_by_val(prp_queue, search_key, search_set);
 }
 
 
@@ -14,6 +14,10 @@
 #include <boost/serialization/utility.hpp>  // for std::pair
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/export.hpp>
+#include <boost/functional/hash/hash.hpp>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 
 static const char rcsId[]="@(#) $Id: ParamResponsePair.cpp 6715 2010-04-02 21:58:15Z wjbohnh $";
 
@@ -21,6 +25,43 @@ BOOST_CLASS_EXPORT(Dakota::ParamResponsePair)
 
 namespace Dakota {
 
+/** Interface ids are few and long-lived, so the table only grows.
+    ApplicationInterface caches the index of its id, so reads come from
+    other PRP constructions and search keys; lookups take a shared lock
+    and only a new id takes an exclusive one. */
+int interface_id_index(const String& interface_id)
+{
+  static std::map<String, int> id_indices;
+  static std::shared_timed_mutex id_indices_mutex;
+
+  {
+    std::shared_lock<std::shared_timed_mutex> read_lock(id_indices_mutex);
+    std::map<String, int>::const_iterator cit = id_indices.find(interface_id);
+    if (cit != id_indices.end())
+      return cit->second;
+  }
+  std::lock_guard<std::shared_timed_mutex> write_lock(id_indices_mutex);
+  // insert is a no-op returning the existing index if another thread
+  // interned this id after the read lock was released
+  int next_index = (int)id_indices.size();
+  return id_indices.insert(std::make_pair(interface_id, next_index))
+    .first->second;
+}
+
+
+PRPFingerprint prp_fingerprint(int interface_index, const Variables& vars)
+{
+  PRPFingerprint fp;
+  fp.hash = 0;
+  boost::hash_combine(fp.hash, interface_index);
+  boost::hash_combine(fp.hash, vars);
+  // independently seeded pass over the variables data
+  std::size_t check_seed = 0x9e3779b97f4a7c15ULL;
+  boost::hash_combine(check_seed, interface_index);
+  fp.check = hash_value(vars, check_seed);
+  return fp;
+}
+
 
 void ParamResponsePair::read_annotated(std::istream& s)
 {
@@ -31,6 +72,7 @@ void ParamResponsePair::read_annotated(std::istream& s)
     evalInterfaceIds.second.clear();
   prpResponse.read_annotated(s);
   s >> evalInterfaceIds.first;
+  update_fingerprint();
 }
 
 
@@ -75,6 +117,8 @@ void ParamResponsePair::serialize(Archive& ar, const unsigned int version)
   ar & evalInterfaceIds.second;
   ar & prpResponse;
   ar & evalInterfaceIds.first;
+  if (Archive::is_loading::value)
+    update_fingerprint();
 }
 
 
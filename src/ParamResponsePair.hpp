@@ -17,6 +17,30 @@
 
 namespace Dakota {
 
+/// 128-bit fingerprint of the interface id and variables of a
+/// ParamResponsePair
+
+/** Formed once from two independently seeded hashes, such that
+    hashed PRPCache/PRPQueue operations need not traverse the variables
+    data, and candidate matches with different fingerprints are rejected
+    without a full Variables comparison. */
+struct PRPFingerprint {
+  std::size_t hash;  ///< hash used for PRPCache/PRPQueue hashed indices
+  std::size_t check; ///< independently seeded hash for fast rejection
+};
+
+/// equality operator for PRPFingerprint
+inline bool operator==(const PRPFingerprint& fp1, const PRPFingerprint& fp2)
+{ return (fp1.hash == fp2.hash && fp1.check == fp2.check); }
+
+/// return the index of interface_id within a process-wide table of
+/// interned interface ids, adding it if not present; callers on hot
+/// paths (e.g., ApplicationInterface) cache the index
+int interface_id_index(const String& interface_id);
+
+/// compute the fingerprint of an interned interface id and variables
+PRPFingerprint prp_fingerprint(int interface_index, const Variables& vars);
+
 
 /// Container class for a variables object, a response object, and an
 /// evaluation id.
@@ -64,14 +88,24 @@ public:
   ParamResponsePair(const Variables& vars, const String& interface_id,
 		    const Response& response, const int eval_id,
 		    bool deep_copy = true);
+  /// standard constructor for history uses, given the cached interned
+  /// index of interface_id (see interface_id_index())
+  ParamResponsePair(const Variables& vars, const String& interface_id,
+		    int interface_index, const Response& response,
+		    const int eval_id, bool deep_copy = true);
   /// copy constructor
   ParamResponsePair(const ParamResponsePair& pair);
+  /// move constructor, allowing queue/cache insertion without copying
+  /// handles or the interface id string
+  ParamResponsePair(ParamResponsePair&& pair) noexcept;
 
   /// destructor
   ~ParamResponsePair();
 
   /// assignment operator
   ParamResponsePair& operator=(const ParamResponsePair& pair);
+  /// move assignment operator
+  ParamResponsePair& operator=(ParamResponsePair&& pair) noexcept;
 
   //
   //- Heading: Member functions
@@ -116,10 +150,18 @@ public:
 
   /// return the aggregate eval/interface identifier from the response object
   const IntStringPair& eval_interface_ids() const;
+  /// return the interned index of the interface identifier
+  int interface_id_index() const;
+
+  /// return the fingerprint of the interface id and variables
+  const PRPFingerprint& fingerprint() const;
+  /// recompute the fingerprint of the interface id and variables
+  void update_fingerprint();
 
   /// return the parameters object
   const Variables& variables() const;
-  /// return the parameters object
+  /// return the parameters object for update; callers updating its
+  /// values must then call update_fingerprint()
   Variables& variables();
   /// set the parameters object
   void variables(const Variables& vars);
@@ -145,6 +187,14 @@ private:
   template<class Archive>
   void serialize(Archive& ar, const unsigned int version);
 
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// recompute the fingerprint for the current variables, retaining
+  /// the interned interface id index
+  void update_variables_fingerprint();
+
   //
   //- Heading: Data
   //
@@ -165,10 +215,18 @@ private:
       used for storage of all low level fn evals that get evaluated in
       ApplicationInterface::map(). */
   IntStringPair evalInterfaceIds;
+
+  /// interned index of evalInterfaceIds.second (see interface_id_index())
+  int interfaceIdIndex;
+  /// fingerprint of the interface id and variables, computed on
+  /// construction or explicit update and copied with the pair, rather
+  /// than on each hashed lookup/insertion
+  PRPFingerprint prpFingerprint;
 };
 
 
-inline ParamResponsePair::ParamResponsePair()
+inline ParamResponsePair::ParamResponsePair():
+  interfaceIdIndex(0), prpFingerprint{0, 0}
 { }
 
 
@@ -183,7 +241,7 @@ ParamResponsePair(const Variables& vars, const String& interface_id,
   prpVariables( (deep_copy) ? vars.copy()     : vars     ),
   prpResponse(  (deep_copy) ? response.copy() : response ),
   evalInterfaceIds(0, interface_id)
-{ }
+{ update_fingerprint(); }
 
 
 /** Uses of this constructor often do not share representations since
@@ -195,12 +253,35 @@ ParamResponsePair(const Variables& vars, const String& interface_id,
   prpVariables( (deep_copy) ? vars.copy()     : vars     ),
   prpResponse(  (deep_copy) ? response.copy() : response ),
   evalInterfaceIds(eval_id, interface_id)
-{ }
+{ update_fingerprint(); }
 
 
+/** As for the standard constructor, without interning interface_id. */
+inline ParamResponsePair::
+ParamResponsePair(const Variables& vars, const String& interface_id,
+		  int interface_index, const Response& response,
+		  const int eval_id, bool deep_copy):
+  prpVariables( (deep_copy) ? vars.copy()     : vars     ),
+  prpResponse(  (deep_copy) ? response.copy() : response ),
+  evalInterfaceIds(eval_id, interface_id), interfaceIdIndex(interface_index)
+{ update_variables_fingerprint(); }
+
+
+/** The fingerprint is copied rather than recomputed: a pair sharing
+    variables that are updated through another handle must be
+    refingerprinted with update_fingerprint(). */
 inline ParamResponsePair::ParamResponsePair(const ParamResponsePair& pair):
   prpVariables(pair.prpVariables), prpResponse(pair.prpResponse),
-  evalInterfaceIds(pair.evalInterfaceIds)
+  evalInterfaceIds(pair.evalInterfaceIds),
+  interfaceIdIndex(pair.interfaceIdIndex), prpFingerprint(pair.prpFingerprint)
+{ }
+
+
+inline ParamResponsePair::ParamResponsePair(ParamResponsePair&& pair) noexcept:
+  prpVariables(std::move(pair.prpVariables)),
+  prpResponse(std::move(pair.prpResponse)),
+  evalInterfaceIds(std::move(pair.evalInterfaceIds)),
+  interfaceIdIndex(pair.interfaceIdIndex), prpFingerprint(pair.prpFingerprint)
 { }
 
 
@@ -210,6 +291,21 @@ ParamResponsePair::operator=(const ParamResponsePair& pair)
   prpVariables     = pair.prpVariables;
   prpResponse      = pair.prpResponse;
   evalInterfaceIds = pair.evalInterfaceIds;
+  interfaceIdIndex = pair.interfaceIdIndex;
+  prpFingerprint   = pair.prpFingerprint;
+
+  return *this;
+}
+
+
+inline ParamResponsePair&
+ParamResponsePair::operator=(ParamResponsePair&& pair) noexcept
+{
+  prpVariables     = std::move(pair.prpVariables);
+  prpResponse      = std::move(pair.prpResponse);
+  evalInterfaceIds = std::move(pair.evalInterfaceIds);
+  interfaceIdIndex = pair.interfaceIdIndex;
+  prpFingerprint   = pair.prpFingerprint;
 
   return *this;
 }
@@ -232,13 +328,37 @@ inline const String& ParamResponsePair::interface_id() const
 
 
 inline void ParamResponsePair::interface_id(const String& id)
-{ evalInterfaceIds.second = id; }
+{ evalInterfaceIds.second = id; update_fingerprint(); }
 
 
 inline const IntStringPair& ParamResponsePair::eval_interface_ids() const
 { return evalInterfaceIds; }
 
 
+inline int ParamResponsePair::interface_id_index() const
+{ return interfaceIdIndex; }
+
+
+/** The fingerprint is only written on construction and explicit update,
+    so it may be read concurrently (e.g., under a shared cache lock). */
+inline const PRPFingerprint& ParamResponsePair::fingerprint() const
+{ return prpFingerprint; }
+
+
+inline void ParamResponsePair::update_fingerprint()
+{
+  interfaceIdIndex = Dakota::interface_id_index(evalInterfaceIds.second);
+  update_variables_fingerprint();
+}
+
+
+inline void ParamResponsePair::update_variables_fingerprint()
+{
+  if (prpVariables.is_null()) prpFingerprint = PRPFingerprint{0, 0};
+  else prpFingerprint = prp_fingerprint(interfaceIdIndex, prpVariables);
+}
+
+
 inline const Variables& ParamResponsePair::variables() const
 { return prpVariables; }
 
@@ -248,7 +368,7 @@ inline Variables& ParamResponsePair::variables()
 
 
 inline void ParamResponsePair::variables(const Variables& vars)
-{ prpVariables = vars; }
+{ prpVariables = vars; update_fingerprint(); }
 
 
 inline const Response& ParamResponsePair::response() const
@@ -281,7 +401,7 @@ inline void ParamResponsePair::active_set(const ActiveSet& set)
 // ASCII read operator is not currently used. The MPIPackBuffer/MPIUnpackBuffer
 // operators are used to pass a source point for the continuation algorithm.
 inline void ParamResponsePair::read(std::istream& s)
-{ s >> prpVariables >> prpResponse; }
+{ s >> prpVariables >> prpResponse; update_fingerprint(); }
 
 
 inline void ParamResponsePair::write(std::ostream& s) const
@@ -306,7 +426,10 @@ inline std::ostream& operator<<(std::ostream& s, const ParamResponsePair& pair)
 /** interfaceId is omitted since master processor retains interface
     ids and communicates asv and response data only with slaves. */
 inline void ParamResponsePair::read(MPIUnpackBuffer& s)
-{ s >> prpVariables >> prpResponse >> evalInterfaceIds.first; }
+{
+  s >> prpVariables >> prpResponse >> evalInterfaceIds.first;
+  update_fingerprint();
+}
 
 
 /** interfaceId is omitted since master processor retains interface
@@ -706,6 +706,88 @@ pecos_to_dakota_variable_type(unsigned short pecos_var_type, size_t rv_index)
 }
 
 
+/** The view resolution of the RealVector transformations is performed
+    once for the batch, and samples are transformed through views of the
+    matrix columns so that no per-sample storage is allocated. */
+void ProbabilityTransformModel::
+transform_samples(const RealMatrix& src_samples, RealMatrix& tgt_samples,
+		  bool x_to_u)
+{
+  const Variables& x_vars = subModel.current_variables();
+  short u_active_view = currentVariables.shared_data().view().first,
+        x_active_view = x_vars.shared_data().view().first;
+
+  // Note: the cv ids for x and u should be identical following view alignment,
+  // but we pass both for generality
+  if (u_active_view == x_active_view)
+    transform_samples(src_samples, tgt_samples,
+		      currentVariables.continuous_variable_ids(),
+		      x_vars.continuous_variable_ids(), x_to_u);
+  else {
+    bool u_all = (u_active_view == RELAXED_ALL || u_active_view == MIXED_ALL),
+         x_all = (x_active_view == RELAXED_ALL || x_active_view == MIXED_ALL);
+    if (!u_all && x_all)
+      transform_samples(src_samples, tgt_samples,
+			currentVariables.all_continuous_variable_ids(),
+			x_vars.continuous_variable_ids(), x_to_u);
+    else if (!x_all && u_all)
+      transform_samples(src_samples, tgt_samples,
+			currentVariables.continuous_variable_ids(),
+			x_vars.all_continuous_variable_ids(), x_to_u);
+    else {
+      Cerr << "Error: unsupported variable view differences in "
+	   << "ProbabilityTransformModel::transform_samples()." << std::endl;
+      abort_handler(MODEL_ERROR);
+    }
+  }
+}
+
+
+void ProbabilityTransformModel::
+transform_samples(const RealMatrix& src_samples, RealMatrix& tgt_samples,
+		  SizetMultiArrayConstView u_cv_ids,
+		  SizetMultiArrayConstView x_cv_ids, bool x_to_u)
+{
+  size_t num_src = (x_to_u) ? x_cv_ids.size() : u_cv_ids.size(),
+         num_tgt = (x_to_u) ? u_cv_ids.size() : x_cv_ids.size();
+  int i, num_samples = src_samples.numCols();
+  if (src_samples.numRows() != num_src) {
+    Cerr << "Error: sample dimension (" << src_samples.numRows()
+	 << ") inconsistent with transformation dimension (" << num_src
+	 << ") in ProbabilityTransformModel::transform_samples()." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+
+  // an in-place transformation needs a copy of each source sample, since
+  // the target is updated as the source is read
+  bool in_place = (&src_samples == &tgt_samples);
+  if (in_place && num_src != num_tgt) {
+    Cerr << "Error: in-place transformation requires matching dimensions in "
+	 << "ProbabilityTransformModel::transform_samples()." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+  else if (!in_place && (tgt_samples.numRows() != num_tgt ||
+			 tgt_samples.numCols() != num_samples))
+    tgt_samples.shapeUninitialized(num_tgt, num_samples);
+
+  RealVector src_copy;
+  if (in_place) src_copy.sizeUninitialized(num_src);
+  for (i=0; i<num_samples; ++i) {
+    const Real* src_i = src_samples[i];
+    if (in_place) {
+      std::copy(src_i, src_i + num_src, src_copy.values());
+      src_i = src_copy.values();
+    }
+    RealVector src_samp(Teuchos::View, const_cast<Real*>(src_i), num_src);
+    RealVector tgt_samp(Teuchos::View, tgt_samples[i], num_tgt);
+    if (x_to_u)
+      natafTransform.trans_X_to_U(src_samp, x_cv_ids, tgt_samp, u_cv_ids);
+    else
+      natafTransform.trans_U_to_X(src_samp, u_cv_ids, tgt_samp, x_cv_ids);
+  }
+}
+
+
 void ProbabilityTransformModel::
 resp_x_to_u_mapping(const Variables& x_vars,     const Variables& u_vars,
                     const Response&  x_response, Response&        u_response)
@@ -89,6 +89,8 @@ protected:
   void trans_U_to_X(const Variables&  u_vars,   Variables&  x_vars);
   void trans_X_to_U(const RealVector& x_c_vars, RealVector& u_c_vars);
   void trans_X_to_U(const Variables&  x_vars,   Variables&  u_vars);
+  void trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples);
+  void trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples);
 
   void trans_grad_X_to_U(const RealVector& fn_grad_x, RealVector& fn_grad_u,
 			 const RealVector& x_vars);
@@ -130,6 +132,17 @@ protected:
     const Pecos::MultivariateDistribution& x_dist,
     const Pecos::MultivariateDistribution& u_dist) const;
 
+  /// transform each column of src_samples between u-space and x-space,
+  /// resolving the variable views once for the batch
+  void transform_samples(const RealMatrix& src_samples,
+			 RealMatrix& tgt_samples, bool x_to_u);
+  /// transform each column of src_samples with natafTransform for the
+  /// given u-space and x-space continuous variable ids
+  void transform_samples(const RealMatrix& src_samples,
+			 RealMatrix& tgt_samples,
+			 SizetMultiArrayConstView u_cv_ids,
+			 SizetMultiArrayConstView x_cv_ids, bool x_to_u);
+
   /// convert vector<RandomVariable> index to active correlation index
   size_t rv_index_to_corr_index(size_t rv_index);
   /// convert allContinuousVars index to active correlation index
@@ -530,6 +543,22 @@ trans_X_to_U(const Variables& x_vars, Variables& u_vars)
 }
 
 
+/** Map a matrix of samples (one per column) from iterator space (u)
+    to simulation space (x).  x_samples may be the same matrix as
+    u_samples. */
+inline void ProbabilityTransformModel::
+trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples)
+{ transform_samples(u_samples, x_samples, false); }
+
+
+/** Map a matrix of samples (one per column) from simulation space (x)
+    to iterator space (u).  u_samples may be the same matrix as
+    x_samples. */
+inline void ProbabilityTransformModel::
+trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples)
+{ transform_samples(x_samples, u_samples, true); }
+
+
 /** Map the variables from iterator space (u) to simulation space (x). */
 inline void ProbabilityTransformModel::
 vars_u_to_x_mapping(const Variables& u_vars, Variables& x_vars)
@@ -48,7 +48,7 @@ extern ProblemDescDB *Dak_pddb;	  // defined in dakota_global_defs.cpp
 ProblemDescDB::ProblemDescDB(BaseConstructor, ParallelLibrary& parallel_lib):
   parallelLib(parallel_lib), environmentCntr(0), methodDBLocked(true),
   modelDBLocked(true), variablesDBLocked(true), interfaceDBLocked(true),
-  responsesDBLocked(true)
+  responsesDBLocked(true), uniqueInstances(false)
 { /* empty ctor */ }
 
 
@@ -960,9 +960,9 @@ const Iterator& ProblemDescDB::get_iterator()
   String id_method = dbRep->dataMethodIter->dataMethodRep->idMethod;
   if(id_method.empty())
     id_method = "NO_METHOD_ID";
-  IterLIter i_it
-    = std::find_if(dbRep->iteratorList.begin(), dbRep->iteratorList.end(),
-                   boost::bind(&Iterator::method_id, _1) == id_method);
+  IterLIter i_it = (dbRep->uniqueInstances) ? dbRep->iteratorList.end() :
+    std::find_if(dbRep->iteratorList.begin(), dbRep->iteratorList.end(),
+		 boost::bind(&Iterator::method_id, _1) == id_method);
   if (i_it == dbRep->iteratorList.end()) {
     Iterator new_iterator(*this);
     dbRep->iteratorList.push_back(new_iterator);
@@ -1060,9 +1060,9 @@ const Model& ProblemDescDB::get_model()
   String id_model = dbRep->dataModelIter->dataModelRep->idModel;
   if(id_model.empty())
     id_model = "NO_MODEL_ID";
-  ModelLIter m_it
-    = std::find_if(dbRep->modelList.begin(), dbRep->modelList.end(),
-                   boost::bind(&Model::model_id, _1) == id_model);
+  ModelLIter m_it = (dbRep->uniqueInstances) ? dbRep->modelList.end() :
+    std::find_if(dbRep->modelList.begin(), dbRep->modelList.end(),
+		 boost::bind(&Model::model_id, _1) == id_model);
   if (m_it == dbRep->modelList.end()) {
     Model new_model(*this);
     dbRep->modelList.push_back(new_model);
@@ -1152,9 +1152,9 @@ const Interface& ProblemDescDB::get_interface()
   if(id_interface.empty())
     id_interface = "NO_ID";
 
-  InterfLIter i_it
-    = std::find_if(dbRep->interfaceList.begin(), dbRep->interfaceList.end(),
-                   boost::bind(&Interface::interface_id, _1) == id_interface);
+  InterfLIter i_it = (dbRep->uniqueInstances) ? dbRep->interfaceList.end() :
+    std::find_if(dbRep->interfaceList.begin(), dbRep->interfaceList.end(),
+		 boost::bind(&Interface::interface_id, _1) == id_interface);
   if (i_it == dbRep->interfaceList.end()) {
     Interface new_interface(*this);
     dbRep->interfaceList.push_back(new_interface);
@@ -2304,15 +2304,18 @@ int ProblemDescDB::get_int(const String& entry_name) const
       {"nond.dili_ses_exp_rank", P_MET diliSesExpRank},
       {"nond.dili_ses_overs_factor", P_MET diliSesOversFactor},
       {"nond.dili_ses_block_size", P_MET diliSesBlockSize},
+      {"nond.muq_num_chains", P_MET muqNumChains},
       {"evidence_samples", P_MET evidenceSamples},
       {"fsu_cvt.num_trials", P_MET numTrials},
       {"iterator_servers", P_MET iteratorServers},
+      {"iterator_threads", P_MET iteratorThreads},
       {"max_hifi_evaluations", P_MET maxHifiEvals},
       {"mesh_adaptive_search.neighbor_order", P_MET neighborOrder},
       {"nl2sol.covariance", P_MET covarianceType},
       {"nond.c3function_train.max_cross_iterations", P_MET maxCrossIterations},
       {"nond.chain_samples", P_MET chainSamples},
       {"nond.prop_cov_update_period", P_MET proposalCovUpdatePeriod},
+      {"nond.pseudo_inverse_threads", P_MET pseudoInvThreads},
       {"nond.pushforward_samples", P_MET numPushforwardSamples},
       {"nond.samples_on_emulator", P_MET samplesOnEmulator},
       {"nond.surrogate_order", P_MET emulatorOrder},
@@ -2564,6 +2567,7 @@ size_t ProblemDescDB::get_sizet(const String& entry_name) const
   ( "get_sizet()",
     { /* environment */ },
     { /* method */
+      {"evaluation_window", P_MET evaluationWindow},
       {"final_solutions", P_MET numFinalSolutions},
       {"jega.num_cross_points", P_MET numCrossPoints},
       {"jega.num_designs", P_MET numDesigns},
@@ -2792,10 +2796,12 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"evaluation_cache", P_INT evalCacheFlag},
       {"labeled_results", P_INT dakotaResultsFileLabeled},
       {"nearby_evaluation_cache", P_INT nearbyEvalCacheFlag},
+      {"python.batch_arrays", P_INT numpyBatchArrays},
       {"python.numpy", P_INT numpyFlag},
       {"restart_file", P_INT restartFileFlag},
       {"templateReplace", P_INT templateReplace},
-      {"useWorkdir", P_INT useWorkdir}
+      {"useWorkdir", P_INT useWorkdir},
+      {"workdirPrestage", P_INT workdirPrestage}
     },
     { /* responses */
       {"calibration_data", P_RES calibrationDataFlag},
@@ -128,6 +128,13 @@ public:
   void lock();
   /// Explicitly unlocks the database.  Use with care.
   void unlock();
+  /// when set, get_model(), get_interface(), and get_iterator() bypass
+  /// reuse of existing objects and always instantiate new (unshared)
+  /// instances, e.g., for thread-private sub-iterator replicas
+  void unique_instances(bool flag);
+  /// return whether new (unshared) instances are currently being
+  /// constructed (see unique_instances(bool))
+  bool unique_instances() const;
 
   /// set dataMethodIter based on a method identifier string to activate a
   /// particular method specification in dataMethodList and use pointers from
@@ -514,6 +521,8 @@ private:
   /// prevents use of get_<type> retrieval and set_<type> update functions 
   /// prior to setting the list node for the active responses specification
   bool responsesDBLocked;
+  /// disables object reuse within get_<object>() (see unique_instances())
+  bool uniqueInstances;
 
   /// pointer to the letter (initialized only for the envelope)
   std::shared_ptr<ProblemDescDB> dbRep;
@@ -542,6 +551,17 @@ inline void ProblemDescDB::unlock()
 }
 
 
+inline void ProblemDescDB::unique_instances(bool flag)
+{
+  if (dbRep) dbRep->uniqueInstances = flag;
+  else       uniqueInstances = flag;
+}
+
+
+inline bool ProblemDescDB::unique_instances() const
+{ return (dbRep) ? dbRep->uniqueInstances : uniqueInstances; }
+
+
 inline ParallelLibrary& ProblemDescDB::parallel_library() const
 { return (dbRep) ? dbRep->parallelLib : parallelLib; }
 
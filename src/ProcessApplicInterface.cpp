@@ -13,9 +13,11 @@
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
 #include "WorkdirHelper.hpp"
+#include "WorkdirPool.hpp"
 #include "ParametersFileWriter.hpp"
 #include "ResultsFileReader.hpp"
 #include <algorithm>
+#include <thread>
 #include <boost/filesystem/fstream.hpp>
 #include <nlohmann/json.hpp>
 
@@ -130,7 +132,8 @@ ProcessApplicInterface(const ProblemDescDB& problem_db):
   dirSave(problem_db.get_bool("interface.dirSave")),
   linkFiles(problem_db.get_sa("interface.linkFiles")),
   copyFiles(problem_db.get_sa("interface.copyFiles")),
-  templateReplace(problem_db.get_bool("interface.templateReplace"))
+  templateReplace(problem_db.get_bool("interface.templateReplace")),
+  workdirPrestage(problem_db.get_bool("interface.workdirPrestage"))
 {
   // When using work directory, relative analysis drivers starting
   // with . or .. may need to be converted to absolute so they work
@@ -168,10 +171,13 @@ ProcessApplicInterface(const ProblemDescDB& problem_db):
   // asynchLocalEvalConcurrency because this is set per parallel
   // configuration in set_communicators.
 
+  // Interface replicas for threaded sub-iterators (see
+  // ConcurrentMetaIterator) likewise evaluate concurrently with the
+  // original instance; their evaluations are tagged by iterator job.
   bool require_unique =
-    (interface_synchronization() == ASYNCHRONOUS_INTERFACE) &&
-    (asynchLocalEvalConcSpec != 1) && 
-    !batchEval;
+    ( (interface_synchronization() == ASYNCHRONOUS_INTERFACE) &&
+      (asynchLocalEvalConcSpec != 1) && !batchEval ) ||
+    problem_db.unique_instances();
 
   if (require_unique) {
     if (useWorkdir) {
@@ -382,11 +388,29 @@ void ProcessApplicInterface::define_filenames(const String& eval_id_tag)
     if (useWorkdir) {
       // curWorkdir is used by Fork/SysCall arg_adjust
       curWorkdir = get_workdir_name();
-      // TODO: Create with 0700 mask?
-      wd_created = WorkdirHelper::create_directory(curWorkdir, DIR_PERSIST);
-      // copy/link tolerate empty items
-      WorkdirHelper::copy_items(copyFiles, curWorkdir, templateReplace);
-      WorkdirHelper::link_items(linkFiles, curWorkdir, templateReplace);
+      // on request, per-evaluation directories with template files are
+      // prestaged in the background, adjacent to the work directories
+      bool unique_workdir = dirTag || workDirName.empty();
+      if (workdirPrestage && !workdirPool && unique_workdir &&
+	  (!copyFiles.empty() || !linkFiles.empty())) {
+	bfs::path pool_root = workDirName.empty() ?
+	  WorkdirHelper::system_tmp_path() :
+	  WorkdirHelper::rel_to_abs(workDirName).parent_path();
+	size_t pool_size = (asynchLocalEvalConcurrency > 0) ?
+	  asynchLocalEvalConcurrency :
+	  std::max(1u, std::thread::hardware_concurrency());
+	workdirPool.reset(new WorkdirPool(copyFiles, linkFiles, pool_root,
+					  pool_size));
+      }
+      if (workdirPool && workdirPool->claim(curWorkdir))
+	wd_created = true;
+      else {
+	// TODO: Create with 0700 mask?
+	wd_created = WorkdirHelper::create_directory(curWorkdir, DIR_PERSIST);
+	// copy/link tolerate empty items
+	WorkdirHelper::copy_items(copyFiles, curWorkdir, templateReplace);
+	WorkdirHelper::link_items(linkFiles, curWorkdir, templateReplace);
+      }
     }
 
     // non-empty createdDir communicates to write_parameters_files that
@@ -880,7 +904,10 @@ file_and_workdir_cleanup(const bfs::path &params_path,
   if (removing_workdir) {
     if (outputLevel > NORMAL_OUTPUT)
       Cout << "Removing work_directory " << workdir_path << std::endl;
-    WorkdirHelper::recursive_remove(workdir_path, FILEOP_ERROR);
+    if (workdirPool) // deferred to the pool's background thread
+      workdirPool->retire(workdir_path);
+    else
+      WorkdirHelper::recursive_remove(workdir_path, FILEOP_ERROR);
   }
 
 }
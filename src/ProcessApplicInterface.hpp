@@ -26,6 +26,7 @@ namespace Dakota {
 
 class ParametersFileWriter;
 class ResultsFileReader;
+class WorkdirPool;
 
 /// Substitute parameters and results file names into driver strings
 String substitute_params_and_results(const String &driver, const String &params, const String &results);
@@ -233,6 +234,11 @@ protected:
   StringArray copyFiles;
   /// whether to replace existing files
   bool templateReplace;
+  /// whether prestaging of work directories was requested
+  bool workdirPrestage;
+  /// prestaged work directories, when requested and each evaluation has
+  /// its own work_directory populated from copy_files/link_files
+  std::unique_ptr<WorkdirPool> workdirPool;
 
 private:
 
@@ -22,6 +22,7 @@ namespace Dakota {
 Pybind11Interface::Pybind11Interface(const ProblemDescDB& problem_db)
   : DirectApplicInterface(problem_db),
     userNumpyFlag(problem_db.get_bool("interface.python.numpy")),
+    batchArraysFlag(problem_db.get_bool("interface.python.batch_arrays")),
     ownPython(false),
     py11Active(false)
 {
@@ -36,6 +37,11 @@ Pybind11Interface::Pybind11Interface(const ProblemDescDB& problem_db)
 	 << "exactly one\nanalysis_driver string\n";
     abort_handler(INTERFACE_ERROR);
   }
+  if (batchArraysFlag && !batchEval) {
+    Cerr << "\nError: interface > python > numpy > batch_arrays requires the "
+	 << "batch option\n";
+    abort_handler(INTERFACE_ERROR);
+  }
 
   if (!Py_IsInitialized()) {
     py::initialize_interpreter();
@@ -69,6 +75,8 @@ Pybind11Interface::Pybind11Interface(const ProblemDescDB& problem_db)
 
 
 Pybind11Interface::~Pybind11Interface() {
+  // release cached Python objects while the interpreter is still alive
+  batchLabels = py::object();
   if (ownPython && Py_IsInitialized()) {
     py::finalize_interpreter();
     if (outputLevel >= NORMAL_OUTPUT)
@@ -121,6 +129,11 @@ void Pybind11Interface::derived_map_asynch(const ParamResponsePair& pair)
 
 void Pybind11Interface::wait_local_evaluations(PRPQueue& prp_queue)
 {
+  if (batchArraysFlag) {
+    wait_local_evaluations_arrays(prp_queue);
+    return;
+  }
+
   // TODO: refactor to avoid passing through local class members for
   // variables and responses (inherit directly from ApplicationInterface)
 
@@ -161,6 +174,202 @@ void Pybind11Interface::test_local_evaluations(PRPQueue& prp_queue)
 }
 
 
+/// NumPy array viewing (not owning) C-contiguous Dakota data; the
+/// non-owning base object keeps pybind11 from copying
+template<typename T>
+static py::array_t<T>
+numpy_view(T* data, const std::vector<py::ssize_t>& shape, bool writeable)
+{
+  py::array_t<T> view(shape, data, py::capsule(data, [](void*) {}));
+  if (!writeable)
+    view.attr("setflags")("write"_a = false);
+  return view;
+}
+
+
+/// copy a result array into buffer, unless Python filled buffer in place
+static void copy_batch_result(const py::dict& py_results, const char* key,
+			      RealMatrix& buffer)
+{
+  if (!py_results.contains(key))
+    return;
+  auto values = py::array_t<Real, py::array::c_style | py::array::forcecast>
+    ::ensure(py_results[key]);
+  if (!values)
+    throw(std::runtime_error(std::string("Pybind11 Direct Interface [\"")
+			     + key + "\"]: result is not a numeric array"));
+  if (values.data() == buffer.values())
+    return;
+  size_t len = buffer.numRows() * buffer.numCols();
+  if (values.size() != len)
+    throw(std::runtime_error(std::string("Pybind11 Direct Interface [\"")
+			     + key + "\"]: incorrect size for batch"));
+  std::copy(values.data(), values.data() + len, buffer.values());
+}
+
+
+/** The batch is passed as a single dictionary holding 2D arrays with
+    one row per evaluation, which view Dakota-owned buffers without
+    copying.  Result arrays of the response dictionary shape plus a
+    leading batch dimension are preallocated under "results"; Python
+    fills them in place and returns None (or the results dictionary),
+    or returns a dictionary of its own like-shaped arrays.  Views are
+    only valid for the duration of the callback. */
+void Pybind11Interface::wait_local_evaluations_arrays(PRPQueue& prp_queue)
+{
+  initialize_driver(analysisDrivers[0]);
+
+  // variable counts and labels are common to all evaluations in the batch
+  const ParamResponsePair& first_prp = *prp_queue.begin();
+  set_local_data(first_prp.variables(), first_prp.active_set(),
+		 first_prp.response());
+  if (!batchLabels || batchVarsId != prevVarsId)
+    cache_batch_labels();
+
+  const size_t num_evals = prp_queue.size(), num_md = metaData.size();
+  size_t i, j, num_derivs = 0;
+  bool hess_flag = false;
+  for (const auto& prp : prp_queue) {
+    const ActiveSet& set = prp.active_set();
+    const ShortArray& asv = set.request_vector();
+    if (expect_derivative(asv, 2) || expect_derivative(asv, 4))
+      num_derivs = std::max(num_derivs, set.derivative_vector().size());
+    if (expect_derivative(asv, 4))
+      hess_flag = true;
+  }
+
+  // shape() zeros result buffers so unrequested entries are well defined
+  batchCV.shapeUninitialized(numACV, num_evals);
+  batchDIV.shapeUninitialized(numADIV, num_evals);
+  batchDRV.shapeUninitialized(numADRV, num_evals);
+  batchASV.shapeUninitialized(numFns, num_evals);
+  batchFns.shape(numFns, num_evals);
+  batchGrads.shape(numFns * num_derivs, num_evals);
+  batchHessians.shape((hess_flag) ? numFns * num_derivs * num_derivs : 0,
+		      num_evals);
+  batchMetadata.shape(num_md, num_evals);
+
+  IntVector eval_ids(num_evals, false);
+  py::list dsv, dvv;
+  j = 0;
+  for (const auto& prp : prp_queue) {
+    const Variables& vars = prp.variables();
+    const RealVector& acv  = vars.all_continuous_variables();
+    const IntVector&  adiv = vars.all_discrete_int_variables();
+    const RealVector& adrv = vars.all_discrete_real_variables();
+    for (i=0; i<numACV; ++i)
+      batchCV(i, j) = acv[i];
+    for (i=0; i<numADIV; ++i)
+      batchDIV(i, j) = adiv[i];
+    for (i=0; i<numADRV; ++i)
+      batchDRV(i, j) = adrv[i];
+    dsv.append(copy_array_to_pybind11<py::list,StringMultiArrayConstView,
+	       String>(vars.all_discrete_string_variables()));
+
+    const ActiveSet& set = prp.active_set();
+    const ShortArray& asv = set.request_vector();
+    for (i=0; i<numFns; ++i)
+      batchASV(i, j) = asv[i];
+    dvv.append(copy_array_to_pybind11<py::array,SizetArray,size_t>
+	       (set.derivative_vector()));
+    eval_ids[j] = prp.eval_id();
+    ++j;
+  }
+
+  const py::ssize_t n = num_evals, nf = numFns, nd = num_derivs;
+  py::dict py_results = py::dict(
+      "fns"_a      = numpy_view(batchFns.values(), {n, nf}, true),
+      "metadata"_a = numpy_view(batchMetadata.values(),
+				{n, (py::ssize_t)num_md}, true));
+  if (num_derivs)
+    py_results["fnGrads"]
+      = numpy_view(batchGrads.values(), {n, nf, nd}, true);
+  if (hess_flag)
+    py_results["fnHessians"]
+      = numpy_view(batchHessians.values(), {n, nf, nd, nd}, true);
+
+  py::dict kwargs = py::dict(
+      "batch"_a                 = num_evals,
+      "variables"_a             = numVars,
+      "functions"_a             = numFns,
+      "metadata"_a              = num_md,
+      "cv"_a                    = numpy_view(batchCV.values(),
+					     {n, (py::ssize_t)numACV}, false),
+      "div"_a                   = numpy_view(batchDIV.values(),
+					     {n, (py::ssize_t)numADIV}, false),
+      "dsv"_a                   = dsv,
+      "drv"_a                   = numpy_view(batchDRV.values(),
+					     {n, (py::ssize_t)numADRV}, false),
+      "asv"_a                   = numpy_view(batchASV.values(), {n, nf},
+					     false),
+      "dvv"_a                   = dvv,
+      "eval_ids"_a              = numpy_view(eval_ids.values(), {n}, false),
+      "results"_a               = py_results);
+  for (auto item : py::reinterpret_borrow<py::dict>(batchLabels))
+    kwargs[item.first] = item.second;
+
+  py::object py_ret = py11CallBack(kwargs);
+  if (!py_ret.is_none()) {
+    py::dict py_responses = py_ret.cast<py::dict>();
+    copy_batch_result(py_responses, "fns",        batchFns);
+    copy_batch_result(py_responses, "fnGrads",    batchGrads);
+    copy_batch_result(py_responses, "fnHessians", batchHessians);
+    copy_batch_result(py_responses, "metadata",   batchMetadata);
+  }
+
+  // responses are updated from views of the batch buffers
+  RealMatrix fn_grads;
+  RealSymMatrixArray fn_hessians(hess_flag ? numFns : 0);
+  j = 0;
+  for (auto& prp : prp_queue) {
+    const ActiveSet& set = prp.active_set();
+    int eval_derivs = set.derivative_vector().size();
+    RealVector fn_vals(Teuchos::View, batchFns[j], numFns);
+    if (num_derivs)
+      fn_grads = RealMatrix(Teuchos::View, batchGrads[j], num_derivs,
+			    eval_derivs, numFns);
+    for (i=0; i<fn_hessians.size(); ++i)
+      fn_hessians[i] = RealSymMatrix(Teuchos::View, false,
+	batchHessians[j] + i * num_derivs * num_derivs, num_derivs,
+	eval_derivs);
+    // shallow copy technically violates const-ness
+    Response resp = prp.response();
+    resp.update(fn_vals, fn_grads, fn_hessians, set);
+    if (num_md) {
+      metaData.assign(batchMetadata[j], batchMetadata[j] + num_md);
+      resp.metadata(metaData);
+    }
+    completionSet.insert(prp.eval_id());
+    ++j;
+  }
+}
+
+
+void Pybind11Interface::cache_batch_labels()
+{
+  batchLabels = py::dict(
+      "variable_labels"_a = copy_array_to_pybind11<py::list,StringArray,
+					String>(xAllLabels),
+      "cv_labels"_a  = copy_array_to_pybind11<py::list,StringMultiArray,
+					String>(xCLabels),
+      "div_labels"_a = copy_array_to_pybind11<py::list,StringMultiArray,
+					String>(xDILabels),
+      "dsv_labels"_a = copy_array_to_pybind11<py::list,StringMultiArray,
+					String>(xDSLabels),
+      "drv_labels"_a = copy_array_to_pybind11<py::list,StringMultiArray,
+					String>(xDRLabels),
+      "function_labels"_a = copy_array_to_pybind11<py::list,StringArray,
+					String>(fnLabels),
+      "metadata_labels"_a = copy_array_to_pybind11<py::list,StringArray,
+					String>(metaDataLabels),
+      "analysis_components"_a = (analysisComponents.size() > 0)
+        ? copy_array_to_pybind11<py::list,StringArray,String>
+	    (analysisComponents[analysisDriverIndex])
+        : py::list());
+  batchVarsId = prevVarsId;
+}
+
+
 void Pybind11Interface::initialize_driver(const String& ac_name)
 {
   // If a python callback has not yet been registered (eg via
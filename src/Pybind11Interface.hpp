@@ -60,11 +60,21 @@ class Pybind11Interface: public DirectApplicInterface
     /// Python supports batch only, not true asynch, so this blocks
     virtual void test_local_evaluations(PRPQueue& prp_queue);
 
+    /// batch evaluation exchanging one NumPy array per quantity for the
+    /// whole batch, viewing Dakota-owned buffers without copying
+    void wait_local_evaluations_arrays(PRPQueue& prp_queue);
+
+    /// (re)build the label lists passed with each batch of arrays
+    void cache_batch_labels();
+
     /// direct interface to Pybind11 via API
     int pybind11_run(const String& ac_name);
 
     /// whether the user requested numpy data structures in the input file
     bool userNumpyFlag;
+    /// whether batch evaluations pass whole-batch numpy arrays rather
+    /// than a list of per-evaluation dictionaries
+    bool batchArraysFlag;
     /// true if this class created the interpreter instance
     bool ownPython;
     /// callback function for analysis driver
@@ -72,6 +82,28 @@ class Pybind11Interface: public DirectApplicInterface
 
     bool py11Active;
 
+    /// batch continuous variables, one column per evaluation
+    RealMatrix batchCV;
+    /// batch discrete integer variables, one column per evaluation
+    IntMatrix batchDIV;
+    /// batch discrete real variables, one column per evaluation
+    RealMatrix batchDRV;
+    /// batch active set request vectors, one column per evaluation
+    IntMatrix batchASV;
+    /// batch function values filled by Python, one column per evaluation
+    RealMatrix batchFns;
+    /// batch gradients filled by Python, one column per evaluation
+    RealMatrix batchGrads;
+    /// batch Hessians filled by Python, one column per evaluation
+    RealMatrix batchHessians;
+    /// batch metadata filled by Python, one column per evaluation
+    RealMatrix batchMetadata;
+
+    /// variables id for which batchLabels was last built
+    String batchVarsId;
+    /// label lists reused across batches of arrays (a dict once built)
+    py::object batchLabels;
+
     /// copy Dakota arrays to pybind11 lists via std::vector<> copy
     template<typename RetT, class ArrayT, typename T>
     RetT copy_array_to_pybind11(const ArrayT & src) const;
@@ -561,21 +561,38 @@ void RecastModel::derived_evaluate_nowait(const ActiveSet& set)
     recastSetMap[recastModelEvalCntr]  = set;
     recastVarsMap[recastModelEvalCntr] = currentVariables.copy();
     if (variablesMapping)
-      subModelVarsMap[recastModelEvalCntr]
-	= subModel.current_variables().copy();
+      subModelVarsMap[recastModelEvalCntr] = sub_model_variables_copy();
   }
 }
 
 
+/** Within a stack of RecastModels, the subModel variables for this
+    evaluation are the recast variables of the subModel, which it has
+    already bookkept if it also maps responses.  In this case, its
+    (immutable) copy is shared rather than deep copying at each level. */
+Variables RecastModel::sub_model_variables_copy()
+{
+  std::shared_ptr<RecastModel> sm_recast
+    = std::dynamic_pointer_cast<RecastModel>(subModel.model_rep());
+  if (sm_recast) {
+    Variables sm_vars
+      = sm_recast->pending_recast_variables(subModel.evaluation_id());
+    if (!sm_vars.is_null())
+      return sm_vars;
+  }
+  return subModel.current_variables().copy();
+}
+
+
 const IntResponseMap& RecastModel::derived_synchronize()
 {
   recastResponseMap.clear();
 
-  if (primaryRespMapping || secondaryRespMapping) {
-    IntResponseMap resp_map_rekey;
-    rekey_synch(subModel, true, recastIdMap, resp_map_rekey);
-    transform_response_map(resp_map_rekey, recastResponseMap);
-  }
+  if (primaryRespMapping || secondaryRespMapping)
+    // rekey and transform in a single traversal of the subModel responses
+    rekey_transform_synch(subModel, true, recastIdMap,
+      [this](int recast_id, const Response& sub_model_resp)
+      { transform_response(recast_id, sub_model_resp, recastResponseMap); });
   else
     rekey_synch(subModel, true, recastIdMap, recastResponseMap);
 
@@ -587,11 +604,10 @@ const IntResponseMap& RecastModel::derived_synchronize_nowait()
 {
   recastResponseMap.clear();
 
-  if (primaryRespMapping || secondaryRespMapping) {
-    IntResponseMap resp_map_rekey;
-    rekey_synch(subModel, false, recastIdMap, resp_map_rekey);
-    transform_response_map(resp_map_rekey, recastResponseMap);
-  }
+  if (primaryRespMapping || secondaryRespMapping)
+    rekey_transform_synch(subModel, false, recastIdMap,
+      [this](int recast_id, const Response& sub_model_resp)
+      { transform_response(recast_id, sub_model_resp, recastResponseMap); });
   else
     rekey_synch(subModel, false, recastIdMap, recastResponseMap);
 
@@ -856,23 +872,29 @@ void RecastModel::
 transform_response_map(const IntResponseMap& old_resp_map,
 		       IntResponseMap& new_resp_map)
 {
-  IntRespMCIter r_cit; IntASMIter s_it; IntVarsMIter v_it, sm_v_it;
-  for (r_cit=old_resp_map.begin(); r_cit!=old_resp_map.end(); ++r_cit) {
-    int native_id = r_cit->first;
-    s_it =  recastSetMap.find(native_id);
-    v_it = recastVarsMap.find(native_id);
-    if (variablesMapping) sm_v_it = subModelVarsMap.find(native_id);
-    else                  sm_v_it = v_it;
-
-    Response new_resp(currentResponse.copy()); // correct size, labels, etc.
-    new_resp.active_set(s_it->second);
-    transform_response(v_it->second, sm_v_it->second, r_cit->second, new_resp);
-    new_resp_map[native_id] = new_resp;
-
-    // cleanup
-    recastSetMap.erase(s_it);  recastVarsMap.erase(v_it);
-    if (variablesMapping) subModelVarsMap.erase(sm_v_it);
-  }
+  for (IntRespMCIter r_cit=old_resp_map.begin(); r_cit!=old_resp_map.end();
+       ++r_cit)
+    transform_response(r_cit->first, r_cit->second, new_resp_map);
+}
+
+
+void RecastModel::
+transform_response(int recast_id, const Response& sub_model_resp,
+		   IntResponseMap& new_resp_map)
+{
+  IntASMIter s_it =  recastSetMap.find(recast_id);
+  IntVarsMIter v_it = recastVarsMap.find(recast_id), sm_v_it
+    = (variablesMapping) ? subModelVarsMap.find(recast_id) : v_it;
+
+  // insert first, then transform in place within the map entry
+  Response& new_resp = new_resp_map[recast_id];
+  new_resp = currentResponse.copy(); // correct size, labels, etc.
+  new_resp.active_set(s_it->second);
+  transform_response(v_it->second, sm_v_it->second, sub_model_resp, new_resp);
+
+  // cleanup
+  recastSetMap.erase(s_it);  recastVarsMap.erase(v_it);
+  if (variablesMapping) subModelVarsMap.erase(sm_v_it);
 }
 
 
@@ -163,6 +163,13 @@ public:
   /// to create new_resp_map
   void transform_response_map(const IntResponseMap& old_resp_map,
 			      IntResponseMap& new_resp_map);
+  /// transform the sub-model response for evaluation recast_id using its
+  /// bookkept set and variables, inserting the result into new_resp_map
+  void transform_response(int recast_id, const Response& sub_model_resp,
+			  IntResponseMap& new_resp_map);
+  /// return the recast variables bookkept for the pending asynchronous
+  /// evaluation recast_id, or an empty envelope if there are none
+  Variables pending_recast_variables(int recast_id) const;
 
   /// perform inverse transformation of Variables (sub-model --> recast)
   void inverse_transform_variables(const Variables& sub_model_vars,
@@ -575,6 +582,9 @@ private:
   /// resize {primary,secondary}MapIndices and nonlinearRespMapping to
   /// synchronize with subModel sizes
   void resize_response_mapping();
+  /// return the subModel variables for the current evaluation for
+  /// bookkeeping, sharing the subModel's own copy when it is a RecastModel
+  Variables sub_model_variables_copy();
 
   //
   //- Heading: Data members
@@ -1153,6 +1163,13 @@ inline int RecastModel::derived_evaluation_id() const
 { return recastModelEvalCntr; }
 
 
+inline Variables RecastModel::pending_recast_variables(int recast_id) const
+{
+  IntVarsMCIter v_cit = recastVarsMap.find(recast_id);
+  return (v_cit == recastVarsMap.end()) ? Variables() : v_cit->second;
+}
+
+
 inline void RecastModel::set_evaluation_reference()
 { subModel.set_evaluation_reference(); }
 
@@ -28,11 +28,11 @@ static const char rcsId[]="@(#) $Id: SNLLBase.cpp 7029 2010-10-22 00:17:02Z msel
 
 namespace Dakota {
 
-Minimizer* SNLLBase::optLSqInstance(NULL);
-bool       SNLLBase::modeOverrideFlag(false);
-EvalType   SNLLBase::lastFnEvalLocn(NO_EVALUATOR);
-int        SNLLBase::lastEvalMode(0);
-RealVector SNLLBase::lastEvalVars;
+thread_local Minimizer* SNLLBase::optLSqInstance(NULL);
+thread_local bool       SNLLBase::modeOverrideFlag(false);
+thread_local EvalType   SNLLBase::lastFnEvalLocn(NO_EVALUATOR);
+thread_local int        SNLLBase::lastEvalMode(0);
+thread_local RealVector SNLLBase::lastEvalVars;
 
 
 SNLLBase::SNLLBase(ProblemDescDB& problem_db):
@@ -211,6 +211,10 @@ snll_initialize_run(OPTPP::NLP0* nlf_objective, OPTPP::NLP* nlp_constraint,
   // any variable reassignment at the strategy layer (after iterator
   // construction) is captured with setX.
 
+  // evaluator state is thread_local and may persist from an earlier run
+  // executed on this thread; don't let it satisfy the first evaluation
+  lastFnEvalLocn = NO_EVALUATOR;
+
   // perform a deep copy to disconnect from Dakota's Teuchos::View
   RealVector x(Teuchos::Copy, init_pt.values(), init_pt.length());
   nlf_objective->setX(x);
@@ -129,7 +129,7 @@ protected:
 
   /// pointer to the active base class object instance used within the static
   /// evaluator functions in order to avoid the need for static data
-  static Minimizer* optLSqInstance; // static only for consistency
+  static thread_local Minimizer* optLSqInstance; // static only for consistency
 
   /// value_based_line_search, gradient_based_line_search,
   /// trust_region, or tr_pds
@@ -154,18 +154,20 @@ protected:
   bool constantASVFlag;
 
   /// flags OPT++ mode override (for combining value, gradient, and
-  /// Hessian requests)
-  static bool modeOverrideFlag;
+  /// Hessian requests); this and the evaluator state below are
+  /// thread_local like optLSqInstance, so concurrent OPT++ instances
+  /// (Minimizer::reentrant()) do not share it
+  static thread_local bool modeOverrideFlag;
 
   /// an enum used to track whether an nlf evaluator or a constraint
   /// evaluator was the last location of a function evaluation
-  static EvalType lastFnEvalLocn;
+  static thread_local EvalType lastFnEvalLocn;
 
   /// copy of mode from constraint evaluators
-  static int lastEvalMode;
+  static thread_local int lastEvalMode;
 
   /// copy of variables from constraint evaluators
-  static RealVector lastEvalVars;
+  static thread_local RealVector lastEvalVars;
 };
 
 
@@ -29,7 +29,7 @@ static const char rcsId[]="@(#) $Id: SNLLLeastSq.cpp 7029 2010-10-22 00:17:02Z m
 namespace Dakota {
 extern PRPCache data_pairs; // global container
 
-SNLLLeastSq* SNLLLeastSq::snllLSqInstance(NULL);
+thread_local SNLLLeastSq* SNLLLeastSq::snllLSqInstance(NULL);
 
 
 SNLLLeastSq::SNLLLeastSq(ProblemDescDB& problem_db, Model& model):
@@ -169,7 +169,7 @@ private:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static SNLLLeastSq* snllLSqInstance;
+  static thread_local SNLLLeastSq* snllLSqInstance;
   /// pointer to the previously active object instance used for
   /// restoration in the case of iterator/model recursion
   SNLLLeastSq* prevSnllLSqInstance;
@@ -34,7 +34,7 @@ static const char rcsId[]="@(#) $Id: SNLLOptimizer.cpp 7029 2010-10-22 00:17:02Z
 
 namespace Dakota {
 
-SNLLOptimizer* SNLLOptimizer::snllOptInstance(NULL);
+thread_local SNLLOptimizer* SNLLOptimizer::snllOptInstance(NULL);
 
 /// a (perhaps arbitrary) definition of large scale; choose a
 /// large-scale algorithm if numVars >= LARGE_SCALE
@@ -306,7 +306,7 @@ private:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static SNLLOptimizer* snllOptInstance;
+  static thread_local SNLLOptimizer* snllOptInstance;
   /// pointer to the previously active object instance used for
   /// restoration in the case of iterator/model recursion
   SNLLOptimizer* prevSnllOptInstance;
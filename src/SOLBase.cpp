@@ -18,8 +18,8 @@ static const char rcsId[]="@(#) $Id: SOLBase.cpp 7004 2010-10-04 17:55:00Z wjboh
 
 namespace Dakota {
 
-SOLBase*   SOLBase::solInstance(NULL);
-Minimizer* SOLBase::optLSqInstance(NULL);
+thread_local SOLBase*   SOLBase::solInstance(NULL);
+thread_local Minimizer* SOLBase::optLSqInstance(NULL);
 
 size_t SOLBase::numInstances = 0;
 
@@ -162,10 +162,10 @@ protected:
 
   /// pointer to the active object instance used within the static evaluator
   /// functions in order to avoid the need for static data
-  static SOLBase* solInstance;
+  static thread_local SOLBase* solInstance;
   /// pointer to the active base class object instance used within the static
   /// evaluator functions in order to avoid the need for static data
-  static Minimizer* optLSqInstance;
+  static thread_local Minimizer* optLSqInstance;
 
   int       realWorkSpaceSize; ///< size of realWorkSpace
   int       intWorkSpaceSize;  ///< size of intWorkSpace
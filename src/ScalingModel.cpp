@@ -32,7 +32,7 @@ enum { DISALLOW, TARGET, BOUNDS };
 
 
 /// initialization of static needed by RecastModel
-ScalingModel* ScalingModel::scaleModelInstance(NULL);
+thread_local ScalingModel* ScalingModel::scaleModelInstance(NULL);
 
 
 /** This constructor computes various indices and mappings, then
@@ -170,7 +170,7 @@ protected:
 			   int start_offset, int num_responses) const;
 
  /// static pointer to this class for use in static callbacks
-  static ScalingModel* scaleModelInstance;
+  static thread_local ScalingModel* scaleModelInstance;
 
   bool       varsScaleFlag;          ///< flag for variables scaling
   bool       primaryRespScaleFlag;   ///< flag for primary response scaling
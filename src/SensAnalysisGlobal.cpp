@@ -845,32 +845,85 @@ void SensAnalysisGlobal::compute_pick_and_freeze_vbd_stats( const size_t
     abort_handler(METHOD_ERROR);
   }
   
-  // BMA: for now copy the data to previous data structure 
-  //      total_fn_vals[respFn][replicate][sample]
-  // This is making the assumption that the responses are ordered as allSamples
+  // responses are assumed ordered by replicate block, as in the
+  // pick-and-freeze design generated by Analyzer
   // BMA TODO: compute statistics on finite samples only
-  boost::multi_array<Real,3> total_fn_vals(boost::extents[numFunctions][num_vars+2][num_samples]); // [k][i][j]
+  initialize_pick_and_freeze(numFunctions, num_vars, num_samples);
   IntRespMCIter r_it = resp_samples.begin();
-  for (size_t i(0); i < (num_vars+2); ++i) {
-    for (size_t j(0); j < num_samples; ++r_it, ++j) {
-      for (size_t k(0); k < numFunctions; ++k) {
-        total_fn_vals[k][i][j] = r_it->second.function_value(k);
-      }
-    }
+  for (size_t i(0); i < (num_vars+2); ++i)
+    accumulate_pick_and_freeze(i, r_it);
+  finalize_pick_and_freeze();
+}
+
+
+void SensAnalysisGlobal::
+initialize_pick_and_freeze(size_t num_fns, size_t num_vars, size_t num_samples)
+{
+  pickFreezeA.shape(num_samples, num_fns);
+  pickFreezeB.shape(num_samples, num_fns);
+  pickFreezeShift.size(num_fns);
+  pickFreezeSumS.shape(num_fns, num_vars);
+  pickFreezeSumD.shape(num_fns, num_vars);
+  pickFreezeSumT.shape(num_fns, num_vars);
+  pickFreezeTotal.size(num_fns);
+}
+
+
+void SensAnalysisGlobal::
+accumulate_pick_and_freeze(size_t replicate, const IntResponseMap& resp_block)
+{
+  if (resp_block.size() != pickFreezeA.numRows()) {
+    Cerr << "\nError in SensAnalysisGlobal::accumulate_pick_and_freeze(): "
+	 << "expected " << pickFreezeA.numRows() << " responses; received "
+	 << resp_block.size() << std::endl;
+    abort_handler(METHOD_ERROR);
   }
+  IntRespMCIter r_it = resp_block.begin();
+  accumulate_pick_and_freeze(replicate, r_it);
+}
 
-#ifdef DEBUG
-  //Cout << "allSamples:\n" << allSamples << '\n';
-  for (size_t k(0); k < numFunctions; ++k) {
-    for (size_t i(0); i < num_vars+2; ++i) {
-      for (size_t j(0); j < num_samples; ++j) {
-        Cout << "Response " << k << " for replicate " << i << ", sample " << j
-             << ": " << total_fn_vals[k][i][j] << '\n';
+
+/** Only the A and B responses are retained; each A_B^i block is
+    reduced to sums over samples of the differences A_B^i - B, so
+    memory is independent of the number of variables. */
+void SensAnalysisGlobal::
+accumulate_pick_and_freeze(size_t replicate, IntRespMCIter& r_it)
+{
+  size_t j, k, num_samples = pickFreezeA.numRows(),
+    num_fns = pickFreezeA.numCols();
+  if (replicate < 2) {
+    RealMatrix& base_vals = (replicate) ? pickFreezeB : pickFreezeA;
+    for (j=0; j<num_samples; ++j, ++r_it) {
+      const RealVector& fn_vals = r_it->second.function_values();
+      for (k=0; k<num_fns; ++k)
+	{ base_vals(j,k) = fn_vals[k]; pickFreezeTotal[k] += fn_vals[k]; }
+    }
+    if (replicate) // shift main effect sums by mean_C to limit cancellation
+      for (k=0; k<num_fns; ++k) {
+	Real sum_AB = 0.;
+	for (j=0; j<num_samples; ++j)
+	  sum_AB += pickFreezeA(j,k) + pickFreezeB(j,k);
+	pickFreezeShift[k] = sum_AB / (2. * num_samples);
       }
+    return;
+  }
+
+  size_t i = replicate - 2;
+  for (j=0; j<num_samples; ++j, ++r_it) {
+    const RealVector& fn_vals = r_it->second.function_values();
+    for (k=0; k<num_fns; ++k) {
+      Real diff = fn_vals[k] - pickFreezeB(j,k);
+      pickFreezeSumS(k,i) += (pickFreezeA(j,k) - pickFreezeShift[k]) * diff;
+      pickFreezeSumD(k,i) += diff;
+      pickFreezeSumT(k,i) += diff * diff;
+      pickFreezeTotal[k]  += fn_vals[k];
     }
   }
-#endif
+}
+
 
+void SensAnalysisGlobal::finalize_pick_and_freeze()
+{
   // We compute variables indexSi and indexTi according to the following paper:
   // - A. Saltelli, P. Annoni, I. Azzini, F. Campolongo, M. Ratto, S. Tarantola,
   //   "Variance based sensitivity analysis of model output. Design and estimator
@@ -883,71 +936,40 @@ void SensAnalysisGlobal::compute_pick_and_freeze_vbd_stats( const size_t
   // - V. Weirs, J. Kamm, L. Swiler, S. Tarantola, M. Ratto, B. Adams, W. Rider,
   //   M. Eldred, "Sensitivity analysis techniques applied to a system of
   //   hyperbolic conservation laws", RESS, 107, pp. 157--170, Nov. 2012.
+  //
+  // Responses are centered by the overall mean over all replicates; since
+  // the A_B^i - B differences are unaffected, centering enters the main
+  // effect sums only through (shift - overall_mean) * sum(A_B^i - B).
 
-  indexSi.resize(numFunctions, RealVector(num_vars));
-  indexTi.resize(numFunctions, RealVector(num_vars));
-
-  boost::multi_array<Real,3> total_norm_vals(boost::extents[numFunctions][num_vars+2][num_samples]); // [k][i][j]
-
+  size_t i, j, k, num_samples = pickFreezeA.numRows(),
+    num_fns = pickFreezeSumS.numRows(), num_vars = pickFreezeSumS.numCols();
   Real dNumSamples( static_cast<Real>(num_samples) );
 
-  // Obtain sensitivity indices for each function
-  for (size_t k(0); k < numFunctions; ++k) {
-    Real mean_C(0.);
-    {
-      Real mean_hatY(0.);
-      for (size_t j(0); j < num_samples; ++j) {
-        mean_hatY += total_fn_vals[k][0][j];
-      }
-      mean_hatY /= dNumSamples;
-
-      Real mean_hatB(0.); 
-      for (size_t j(0); j < num_samples; ++j) {
-        mean_hatB += total_fn_vals[k][1][j];
-      }
-      mean_hatB /= dNumSamples;
-
-      Real overall_mean(0.);
-      for (size_t j(0); j < num_samples; ++j) {
-        for(size_t i(0); i < (num_vars+2); ++i) { 
-          total_norm_vals[k][i][j]  = total_fn_vals[k][i][j];
-          overall_mean             += total_norm_vals[k][i][j];
-        } 
-      }
-      overall_mean /= static_cast<Real>( num_samples * (num_vars+2) );
-      for (size_t j(0); j < num_samples; ++j) {
-        for(size_t i(0); i < (num_vars+2); ++i) {
-          total_norm_vals[k][i][j] -= overall_mean;
-        }
-      }
+  indexSi.resize(num_fns, RealVector(num_vars));
+  indexTi.resize(num_fns, RealVector(num_vars));
 
-      mean_C = (mean_hatB + mean_hatY) / 2.;
-    }
+  // Obtain sensitivity indices for each function
+  for (k=0; k<num_fns; ++k) {
+    Real mean_C = pickFreezeShift[k], overall_mean = pickFreezeTotal[k]
+      / static_cast<Real>( num_samples * (num_vars+2) );
 
     Real var_hatYC(0.);
-    for (size_t j(0); j < num_samples; ++j) {
-      var_hatYC += std::pow(total_fn_vals[k][0][j],2);
-    }
-    for (size_t j(0); j < num_samples; ++j) {
-      var_hatYC += std::pow(total_fn_vals[k][1][j],2);
-    }
-    var_hatYC = var_hatYC / (2. * dNumSamples)
-              - mean_C * mean_C;
+    for (j=0; j<num_samples; ++j)
+      var_hatYC += pickFreezeA(j,k) * pickFreezeA(j,k)
+	        +  pickFreezeB(j,k) * pickFreezeB(j,k);
+    var_hatYC = var_hatYC / (2. * dNumSamples) - mean_C * mean_C;
 
     // calculate first order sensitivity indices and first order total indices
-    for (size_t i(0); i < num_vars; ++i) {
-      Real sum_S(0.);
-      Real sum_T(0.);
-      for (size_t j(0); j < num_samples; ++j) {
-        Real diff(total_norm_vals[k][i+2][j] - total_norm_vals[k][1][j]);
-        sum_S += total_norm_vals[k][0][j] * diff;
-        sum_T += std::pow(diff, 2);
-      }
-
+    for (i=0; i<num_vars; ++i) {
+      Real sum_S = pickFreezeSumS(k,i)
+	+ (mean_C - overall_mean) * pickFreezeSumD(k,i);
       indexSi[k][i] = (sum_S /       dNumSamples ) / var_hatYC;
-      indexTi[k][i] = (sum_T / (2. * dNumSamples)) / var_hatYC;
+      indexTi[k][i] = (pickFreezeSumT(k,i) / (2. * dNumSamples)) / var_hatYC;
     }
   } // for k
+
+  // release the retained replicate responses
+  pickFreezeA.shape(0, 0);  pickFreezeB.shape(0, 0);
 }
 
 void SensAnalysisGlobal::compute_binned_vbd_stats( const int              numBins
@@ -96,6 +96,18 @@ public:
                                      , const IntResponseMap & resp_samples
                                      );
 
+  /// initialize the sums for pick-and-freeze VBD streamed one
+  /// replicate block at a time
+  void initialize_pick_and_freeze(size_t num_fns, size_t num_vars,
+				  size_t num_samples);
+  /// accumulate the responses (in sample order) of one pick-and-freeze
+  /// replicate block: 0 for A, 1 for B, and i+2 for A_B^i; A and B
+  /// must precede the A_B^i
+  void accumulate_pick_and_freeze(size_t replicate,
+				  const IntResponseMap& resp_block);
+  /// compute the VBD indices from the accumulated pick-and-freeze sums
+  void finalize_pick_and_freeze();
+
   /// Printing of VBD results
   void print_sobol_indices( std::ostream      & s
                           , const StringArray & var_labels
@@ -193,6 +205,9 @@ private:
          const size_t &inc_id,
          bool rank) const;
 
+  /// accumulate num_samples responses of a replicate block, advancing r_it
+  void accumulate_pick_and_freeze(size_t replicate, IntRespMCIter& r_it);
+
   void compute_pick_and_freeze_vbd_stats( const size_t           numFunctions
                                         , const size_t           num_vars
                                         , const size_t           num_samples
@@ -273,6 +288,23 @@ private:
   /// flag indicatng whether correlations have been computed
   bool corrComputed;
 
+  /// pick-and-freeze responses of replicate A (samples x fns)
+  RealMatrix pickFreezeA;
+  /// pick-and-freeze responses of replicate B (samples x fns)
+  RealMatrix pickFreezeB;
+  /// per response, the mean of replicates A and B, used to shift the
+  /// main effect sums
+  RealVector pickFreezeShift;
+  /// per response (row) and variable (col), the sum over samples of
+  /// (A - shift) (A_B^i - B)
+  RealMatrix pickFreezeSumS;
+  /// per response and variable, the sum over samples of (A_B^i - B)
+  RealMatrix pickFreezeSumD;
+  /// per response and variable, the sum over samples of (A_B^i - B)^2
+  RealMatrix pickFreezeSumT;
+  /// per response, the sum over all replicates and samples
+  RealVector pickFreezeTotal;
+
 protected:
 
   /// compute binned sobol indices from valid samples (having screened out samples with non-numeric response)
@@ -21,6 +21,8 @@ template< typename T > class SurfpackMatrix;
 
 namespace Dakota {
 
+class SurrogatesGPApprox;
+
 
 /// Derived approximation class for Surfpack approximation classes.
 /// Interface between Surfpack and Dakota.
@@ -145,6 +147,10 @@ private:
   Real percentFold;
   /// whether to perform PRESS
   bool pressFlag;
+
+  /// SurrogatesGPApprox instances sharing this data, in construction
+  /// order, so that one may build a GP jointly for all of their QoIs
+  std::vector<SurrogatesGPApprox*> gpApproximations;
 };
 
 
@@ -32,7 +32,8 @@ namespace Dakota {
 extern PRPCache data_pairs;
 
 // initialization of statics
-SurrBasedLocalMinimizer* SurrBasedLocalMinimizer::sblmInstance(NULL);
+thread_local SurrBasedLocalMinimizer*
+  SurrBasedLocalMinimizer::sblmInstance(NULL);
 
 
 SurrBasedLocalMinimizer::
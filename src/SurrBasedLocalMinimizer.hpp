@@ -239,7 +239,7 @@ protected:
   Real alpha;
 
   /// pointer to SBLM instance used in static member functions
-  static SurrBasedLocalMinimizer* sblmInstance;
+  static thread_local SurrBasedLocalMinimizer* sblmInstance;
 };
 
 
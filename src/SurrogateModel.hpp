@@ -59,6 +59,8 @@ protected:
 
   void trans_U_to_X(const RealVector& u_c_vars, RealVector& x_c_vars);
   void trans_X_to_U(const RealVector& x_c_vars, RealVector& u_c_vars);
+  void trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples);
+  void trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples);
 
   void trans_grad_X_to_U(const RealVector& fn_grad_x, RealVector& fn_grad_u,
 			 const RealVector& x_vars);
@@ -265,6 +267,16 @@ trans_U_to_X(const RealVector& u_c_vars, RealVector& x_c_vars)
 { truth_model().trans_U_to_X(u_c_vars, x_c_vars); }
 
 
+inline void SurrogateModel::
+trans_X_to_U(const RealMatrix& x_samples, RealMatrix& u_samples)
+{ truth_model().trans_X_to_U(x_samples, u_samples); }
+
+
+inline void SurrogateModel::
+trans_U_to_X(const RealMatrix& u_samples, RealMatrix& x_samples)
+{ truth_model().trans_U_to_X(u_samples, x_samples); }
+
+
 inline void SurrogateModel::
 trans_grad_X_to_U(const RealVector& fn_grad_x, RealVector& fn_grad_u,
 		  const RealVector& x_vars)
@@ -368,6 +368,410 @@ int TestDriverInterface::derived_map_ac(const String& ac_name)
 }
 
 
+void TestDriverInterface::init_communicators_checks(int max_eval_concurrency)
+{
+  if (batchEval) { // batch of local evaluations mapped within a single thread
+    bool warn = true;
+    check_multiprocessor_asynchronous(warn, max_eval_concurrency);
+  }
+  else
+    DirectApplicInterface::init_communicators_checks(max_eval_concurrency);
+}
+
+
+void TestDriverInterface::set_communicators_checks(int max_eval_concurrency)
+{
+  if (batchEval) {
+    bool warn = false;
+    if (check_multiprocessor_asynchronous(warn, max_eval_concurrency))
+      abort_handler(-1);
+  }
+  else
+    DirectApplicInterface::set_communicators_checks(max_eval_concurrency);
+}
+
+
+/** For batch evaluation, this is a no-op as all work takes place in
+    wait/test_local_evaluations. */
+void TestDriverInterface::derived_map_asynch(const ParamResponsePair& pair)
+{
+  if (!batchEval)
+    DirectApplicInterface::derived_map_asynch(pair);
+}
+
+
+/** The full batch in prp_queue is mapped in a single pass, either using
+    a vectorized kernel over all evaluations (when the analysis driver
+    supports it) or falling back to derived_map() for each evaluation. */
+void TestDriverInterface::wait_local_evaluations(PRPQueue& prp_queue)
+{
+  if (!batchEval) {
+    DirectApplicInterface::wait_local_evaluations(prp_queue);
+    return;
+  }
+
+  if (batch_vectorizable(prp_queue))
+    batch_evaluate_vectorized(prp_queue);
+  else
+    batch_evaluate_sequential(prp_queue);
+}
+
+
+void TestDriverInterface::test_local_evaluations(PRPQueue& prp_queue)
+{
+  if (batchEval)
+    wait_local_evaluations(prp_queue);
+  else
+    DirectApplicInterface::test_local_evaluations(prp_queue);
+}
+
+
+bool TestDriverInterface::batch_vectorizable(const PRPQueue& prp_queue)
+{
+  if (prp_queue.empty() || numAnalysisDrivers != 1 || iFilterType ||
+      oFilterType || multiProcAnalysisFlag || eaDedMasterFlag ||
+      numAnalysisServers > 1)
+    return false;
+
+  switch (analysisDriverTypes[0]) {
+  case ROSENBROCK: case TEXT_BOOK: case STEEL_COLUMN_COST:
+  case HERBIE:     case SMOOTH_HERBIE: case SHUBERT:
+    break;
+  default:
+    return false;
+  }
+
+  // load sizes and labels from the first evaluation; all others must conform
+  const ParamResponsePair& first_prp = *prp_queue.begin();
+  set_local_data(first_prp.variables(), first_prp.active_set(),
+		 first_prp.response());
+  for (const auto& prp : prp_queue) {
+    const Variables& vars = prp.variables();
+    const ShortArray& asv = prp.active_set().request_vector();
+    if (vars.acv() != numACV || vars.adiv() != numADIV ||
+	vars.adrv() != numADRV || vars.adsv() != numADSV ||
+	asv.size() != numFns)
+      return false;
+    for (size_t i=0; i<numFns; ++i)
+      if (asv[i] & 4) // Hessians are only supported in the scalar drivers
+	return false;
+  }
+
+  // driver-specific restrictions mirror the scalar error checks; violations
+  // are left to the scalar drivers to report
+  switch (analysisDriverTypes[0]) {
+  case ROSENBROCK:
+    return (numACV == 2 && numADIV <= 1 && !numADRV && !numADSV &&
+	    numFns <= 2);
+  case STEEL_COLUMN_COST:
+    return (numVars == 3 && numFns == 1);
+  case TEXT_BOOK:
+    return (!numADIV && !numADRV && !numADSV && numFns <= 3);
+  default: // separable fns
+    return (!numADIV && !numADRV && !numADSV && numFns == 1);
+  }
+}
+
+
+void TestDriverInterface::batch_evaluate_sequential(PRPQueue& prp_queue)
+{
+  for (auto& prp : prp_queue) {
+    int fn_eval_id = prp.eval_id();
+    Response resp = prp.response(); // shallow copy
+    try { derived_map(prp.variables(), prp.active_set(), resp, fn_eval_id); }
+    catch (const FunctionEvalFailure& fneval_except) {
+      manage_failure(prp.variables(), prp.active_set(), resp, fn_eval_id);
+    }
+    completionSet.insert(fn_eval_id);
+  }
+}
+
+
+void TestDriverInterface::batch_evaluate_vectorized(PRPQueue& prp_queue)
+{
+  driver_t driver_type = analysisDriverTypes[0];
+  size_t p, v, f, num_pts = prp_queue.size();
+
+  if (evalCommRank == 0 && !suppressOutput && outputLevel > SILENT_OUTPUT)
+    Cout << "Direct interface: invoking vectorized " << analysisDrivers[0]
+	 << " for batch of " << num_pts << " evaluations." << std::endl;
+
+  // pack continuous variables into a contiguous (points x variables) matrix
+  // so that each kernel streams over points with unit stride
+  RealMatrix x_batch(num_pts, numACV, false);
+  bool grad_flag = false;
+  PRPQueueIter q_it = prp_queue.begin();
+  for (p=0; p<num_pts; ++p, ++q_it) {
+    const RealVector& acv = q_it->variables().all_continuous_variables();
+    for (v=0; v<numACV; ++v)
+      x_batch(p, v) = acv[v];
+    const ShortArray& asv = q_it->active_set().request_vector();
+    for (f=0; f<numFns; ++f)
+      if (asv[f] & 2)
+	grad_flag = true;
+  }
+
+  // values (points x fns) and gradients w.r.t. all continuous variables
+  // (one points x variables matrix per fn)
+  RealMatrix fn_vals(num_pts, numFns); // zero initialized
+  RealMatrixArray fn_grads;
+  if (grad_flag)
+    fn_grads.assign(numFns, RealMatrix(num_pts, numACV));
+  switch (driver_type) {
+  case ROSENBROCK:
+    rosenbrock_batch(x_batch, grad_flag, fn_vals, fn_grads);        break;
+  case TEXT_BOOK:
+    text_book_batch(x_batch, grad_flag, fn_vals, fn_grads);         break;
+  case STEEL_COLUMN_COST:
+    steel_column_cost_batch(x_batch, grad_flag, fn_vals, fn_grads); break;
+  default:
+    separable_batch(driver_type, x_batch, grad_flag, fn_vals, fn_grads);
+    break;
+  }
+
+  // unpack the requested data into each response
+  SizetArray dvv_to_acv;
+  for (p=0, q_it=prp_queue.begin(); q_it!=prp_queue.end(); ++p, ++q_it) {
+    const ActiveSet&  set = q_it->active_set();
+    const ShortArray& asv = set.request_vector();
+    const SizetArray& dvv = set.derivative_vector();
+    Response resp = q_it->response(); // shallow copy
+    for (f=0; f<numFns; ++f)
+      if (asv[f] & 1)
+	resp.function_value(fn_vals(p, f), f);
+    if (grad_flag) {
+      size_t i, num_deriv_vars = dvv.size();
+      SizetMultiArrayConstView acv_ids
+	= q_it->variables().all_continuous_variable_ids();
+      dvv_to_acv.resize(num_deriv_vars);
+      for (i=0; i<num_deriv_vars; ++i)
+	if ( (dvv_to_acv[i] = find_index(acv_ids, dvv[i])) == _NPOS ) {
+	  Cerr << "Error: dvv value " << dvv[i] << " not present in all "
+	       << "continuous variable ids." << std::endl;
+	  abort_handler(INTERFACE_ERROR);
+	}
+      RealMatrix resp_grads = resp.function_gradients_view();
+      for (f=0; f<numFns; ++f)
+	if (asv[f] & 2)
+	  for (i=0; i<num_deriv_vars; ++i)
+	    resp_grads(i, f) = fn_grads[f](p, dvv_to_acv[i]);
+    }
+    completionSet.insert(q_it->eval_id());
+  }
+}
+
+
+size_t TestDriverInterface::batch_variable_index(var_t var_type) const
+{
+  size_t index = find_index(xCMLabels, var_type);
+  if (index == _NPOS) {
+    Cerr << "Error: required variable label not found in batch evaluation "
+	 << "of direct fn." << std::endl;
+    abort_handler(INTERFACE_ERROR);
+  }
+  return index;
+}
+
+
+void TestDriverInterface::
+rosenbrock_batch(const RealMatrix& x_batch, bool grad_flag,
+		 RealMatrix& fn_vals, RealMatrixArray& fn_grads)
+{
+  size_t p, num_pts = x_batch.numRows(),
+    i1 = batch_variable_index(VAR_x1), i2 = batch_variable_index(VAR_x2);
+  const Real *x1 = x_batch[i1], *x2 = x_batch[i2];
+
+  if (numFns > 1) { // least squares residuals
+    Real *r1 = fn_vals[0], *r2 = fn_vals[1];
+    for (p=0; p<num_pts; ++p) {
+      r1[p] = 10.*(x2[p] - x1[p]*x1[p]);
+      r2[p] = 1. - x1[p];
+    }
+    if (grad_flag) {
+      Real *dr1_dx1 = fn_grads[0][i1], *dr1_dx2 = fn_grads[0][i2],
+	   *dr2_dx1 = fn_grads[1][i1];
+      for (p=0; p<num_pts; ++p)
+	{ dr1_dx1[p] = -20.*x1[p]; dr1_dx2[p] = 10.; dr2_dx1[p] = -1.; }
+    }
+  }
+  else {
+    Real *f = fn_vals[0];
+    for (p=0; p<num_pts; ++p) {
+      Real f1 = x2[p] - x1[p]*x1[p], f2 = 1. - x1[p];
+      f[p] = 100.*f1*f1 + f2*f2;
+    }
+    if (grad_flag) {
+      Real *df_dx1 = fn_grads[0][i1], *df_dx2 = fn_grads[0][i2];
+      for (p=0; p<num_pts; ++p) {
+	Real f1 = x2[p] - x1[p]*x1[p], f2 = 1. - x1[p];
+	df_dx1[p] = -400.*f1*x1[p] - 2.*f2;
+	df_dx2[p] =  200.*f1;
+      }
+    }
+  }
+}
+
+
+void TestDriverInterface::
+text_book_batch(const RealMatrix& x_batch, bool grad_flag,
+		RealMatrix& fn_vals, RealMatrixArray& fn_grads)
+{
+  size_t p, v, num_pts = x_batch.numRows();
+
+  // **** f: sum (x[i] - POWVAL)^4 ****
+  Real *f = fn_vals[0];
+  for (v=0; v<numACV; ++v) {
+    const Real* x = x_batch[v];
+    for (p=0; p<num_pts; ++p) {
+      Real t = x[p] - POW_VAL, t_sq = t*t;
+      f[p] += t_sq*t_sq;
+    }
+    if (grad_flag) {
+      Real* df_dx = fn_grads[0][v];
+      for (p=0; p<num_pts; ++p) {
+	Real t = x[p] - POW_VAL;
+	df_dx[p] = 4.*t*t*t;
+      }
+    }
+  }
+  if (numFns < 2)
+    return;
+
+  // **** c1: x[0]*x[0] - 0.5*x[1] ****
+  // **** c2: x[1]*x[1] - 0.5*x[0] ****
+  const Real *x0 = (numACV > 0) ? x_batch[0] : NULL,
+             *x1 = (numACV > 1) ? x_batch[1] : NULL;
+  Real *c1 = fn_vals[1], *c2 = (numFns > 2) ? fn_vals[2] : NULL;
+  if (x0) {
+    for (p=0; p<num_pts; ++p) c1[p] += x0[p]*x0[p];
+    if (c2) for (p=0; p<num_pts; ++p) c2[p] -= 0.5*x0[p];
+  }
+  if (x1) {
+    for (p=0; p<num_pts; ++p) c1[p] -= 0.5*x1[p];
+    if (c2) for (p=0; p<num_pts; ++p) c2[p] += x1[p]*x1[p];
+  }
+  if (grad_flag) {
+    if (x0) {
+      Real *dc1_dx0 = fn_grads[1][0];
+      for (p=0; p<num_pts; ++p) dc1_dx0[p] = 2.*x0[p];
+      if (c2) { Real *dc2_dx0 = fn_grads[2][0];
+		for (p=0; p<num_pts; ++p) dc2_dx0[p] = -0.5; }
+    }
+    if (x1) {
+      Real *dc1_dx1 = fn_grads[1][1];
+      for (p=0; p<num_pts; ++p) dc1_dx1[p] = -0.5;
+      if (c2) { Real *dc2_dx1 = fn_grads[2][1];
+		for (p=0; p<num_pts; ++p) dc2_dx1[p] = 2.*x1[p]; }
+    }
+  }
+}
+
+
+void TestDriverInterface::
+steel_column_cost_batch(const RealMatrix& x_batch, bool grad_flag,
+			RealMatrix& fn_vals, RealMatrixArray& fn_grads)
+{
+  size_t p, num_pts = x_batch.numRows(), ib = batch_variable_index(VAR_b),
+    id = batch_variable_index(VAR_d), ih = batch_variable_index(VAR_h);
+  const Real *b = x_batch[ib], *d = x_batch[id], *h = x_batch[ih];
+
+  // **** f (objective = bd + 5h = cost of column):
+  Real *f = fn_vals[0];
+  for (p=0; p<num_pts; ++p)
+    f[p] = b[p]*d[p] + 5.*h[p];
+
+  // **** df/dx:
+  if (grad_flag) {
+    Real *df_db = fn_grads[0][ib], *df_dd = fn_grads[0][id],
+         *df_dh = fn_grads[0][ih];
+    for (p=0; p<num_pts; ++p)
+      { df_db[p] = d[p]; df_dd[p] = b[p]; df_dh[p] = 5.; }
+  }
+}
+
+
+/** Vectorized counterpart to the 1D component functions and
+    separable_combine(): the product and its leave-one-out products are
+    accumulated with forward/backward sweeps over the variables. */
+void TestDriverInterface::
+separable_batch(driver_t driver_type, const RealMatrix& x_batch,
+		bool grad_flag, RealMatrix& fn_vals, RealMatrixArray& fn_grads)
+{
+  size_t p, v, k, num_pts = x_batch.numRows();
+  Real mult_scale_factor = (driver_type == SHUBERT) ? 1. : -1.;
+
+  // 1D components w(x_v) and dw(x_v)/dx_v for each variable and point
+  RealMatrix w(num_pts, numACV, false), d1w;
+  if (grad_flag)
+    d1w.shapeUninitialized(num_pts, numACV);
+  for (v=0; v<numACV; ++v) {
+    const Real* x = x_batch[v];
+    Real *w_v = w[v], *d1w_v = (grad_flag) ? d1w[v] : NULL;
+    switch (driver_type) {
+    case HERBIE: case SMOOTH_HERBIE: {
+      bool herbie = (driver_type == HERBIE);
+      for (p=0; p<num_pts; ++p) {
+	Real t1 = x[p] - 1., t2 = x[p] + 1., e1 = std::exp(-t1*t1),
+	     e2 = std::exp(-0.8*t2*t2);
+	w_v[p] = e1 + e2;
+	if (herbie) w_v[p] -= 0.05*std::sin(8.*(x[p]+0.1));
+      }
+      if (grad_flag)
+	for (p=0; p<num_pts; ++p) {
+	  Real t1 = x[p] - 1., t2 = x[p] + 1.;
+	  d1w_v[p] = -2.*t1*std::exp(-t1*t1) - 1.6*t2*std::exp(-0.8*t2*t2);
+	  if (herbie) d1w_v[p] -= 0.4*std::cos(8.*(x[p]+0.1));
+	}
+      break;
+    }
+    case SHUBERT:
+      for (p=0; p<num_pts; ++p)
+	w_v[p] = 0.;
+      if (grad_flag)
+	for (p=0; p<num_pts; ++p)
+	  d1w_v[p] = 0.;
+      for (k=1; k<=5; ++k) {
+	Real k_real = static_cast<Real>(k);
+	for (p=0; p<num_pts; ++p)
+	  w_v[p] += k_real*std::cos(x[p]*(k_real+1.)+k_real);
+	if (grad_flag)
+	  for (p=0; p<num_pts; ++p)
+	    d1w_v[p] -= k_real*(k_real+1.)*std::sin(x[p]*(k_real+1.)+k_real);
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  // f = scale * \prod_v w(x_v);  df/dx_v = scale * dw(x_v) \prod_{j!=v} w(x_j)
+  RealVector run_prod(num_pts, false);
+  run_prod = mult_scale_factor;
+  for (v=0; v<numACV; ++v) { // forward sweep: products over j < v
+    const Real *w_v = w[v];
+    if (grad_flag) {
+      Real *df_dx = fn_grads[0][v]; const Real *d1w_v = d1w[v];
+      for (p=0; p<num_pts; ++p)
+	df_dx[p] = run_prod[p] * d1w_v[p];
+    }
+    for (p=0; p<num_pts; ++p)
+      run_prod[p] *= w_v[p];
+  }
+  Real *f = fn_vals[0];
+  for (p=0; p<num_pts; ++p)
+    f[p] = run_prod[p];
+
+  if (grad_flag) { // backward sweep: products over j > v
+    run_prod = 1.;
+    for (v=numACV; v-- > 0; ) {
+      Real *df_dx = fn_grads[0][v]; const Real *w_v = w[v];
+      for (p=0; p<num_pts; ++p)
+	{ df_dx[p] *= run_prod[p]; run_prod[p] *= w_v[p]; }
+    }
+  }
+}
+
+
 // -----------------------------------------
 // Begin direct interfaces to test functions
 // -----------------------------------------
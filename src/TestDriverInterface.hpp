@@ -39,8 +39,56 @@ protected:
   /// execute an analysis code portion of a direct evaluation invocation
   virtual int derived_map_ac(const Dakota::String& ac_name);
 
+  /// relax the base class prohibition on asynch for batch evaluation
+  void init_communicators_checks(int max_eval_concurrency);
+  /// relax the base class prohibition on asynch for batch evaluation
+  void set_communicators_checks(int max_eval_concurrency);
+
+  /// batch evaluation only, not true asynch (this is a no-op)
+  void derived_map_asynch(const ParamResponsePair& pair);
+  /// batch evaluation only, not true asynch (this does the work)
+  void wait_local_evaluations(PRPQueue& prp_queue);
+  /// batch evaluation only, not true asynch, so this blocks
+  void test_local_evaluations(PRPQueue& prp_queue);
+
 private:
 
+  //
+  //- Heading: Batch evaluation helpers
+  //
+
+  /// determine whether the evaluations in prp_queue can be mapped by a
+  /// vectorized batch kernel (single analysis driver, no filters, no
+  /// Hessians, consistent variable and response sizes)
+  bool batch_vectorizable(const PRPQueue& prp_queue);
+  /// evaluate prp_queue one evaluation at a time using derived_map()
+  void batch_evaluate_sequential(PRPQueue& prp_queue);
+  /// evaluate prp_queue using a vectorized kernel over a contiguous
+  /// (points x continuous variables) matrix
+  void batch_evaluate_vectorized(PRPQueue& prp_queue);
+
+  /// return the column of xCMLabels matching var_type (for batch kernels
+  /// on drivers using the VARIABLES_MAP local data view)
+  size_t batch_variable_index(var_t var_type) const;
+
+  /// batch-vectorized rosenbrock(): values and gradients for each row
+  /// of x_batch
+  void rosenbrock_batch(const RealMatrix& x_batch, bool grad_flag,
+			RealMatrix& fn_vals, RealMatrixArray& fn_grads);
+  /// batch-vectorized text_book(): values and gradients for each row
+  /// of x_batch
+  void text_book_batch(const RealMatrix& x_batch, bool grad_flag,
+		       RealMatrix& fn_vals, RealMatrixArray& fn_grads);
+  /// batch-vectorized steel_column_cost(): values and gradients for
+  /// each row of x_batch
+  void steel_column_cost_batch(const RealMatrix& x_batch, bool grad_flag,
+			       RealMatrix& fn_vals, RealMatrixArray& fn_grads);
+  /// batch-vectorized herbie(), smooth_herbie(), and shubert(): values
+  /// and gradients for each row of x_batch
+  void separable_batch(driver_t driver_type, const RealMatrix& x_batch,
+		       bool grad_flag, RealMatrix& fn_vals,
+		       RealMatrixArray& fn_grads);
+
   //
   //- Heading: Simulators and test functions
   //
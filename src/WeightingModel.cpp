@@ -12,7 +12,7 @@
 namespace Dakota {
 
 /// initialization of static needed by RecastModel
-WeightingModel* WeightingModel::weightModelInstance(NULL);
+thread_local WeightingModel* WeightingModel::weightModelInstance(NULL);
 
 
 WeightingModel::WeightingModel(Model& sub_model
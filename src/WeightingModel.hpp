@@ -63,7 +63,7 @@ protected:
 private:
 
   /// static pointer to this class for use in static callbacks
-  static WeightingModel* weightModelInstance;
+  static thread_local WeightingModel* weightModelInstance;
 };
 
 
@@ -25,7 +25,13 @@
 
 #else
   #include <unistd.h>
+  #include <fcntl.h>
   #include <sys/param.h>             // for MAXPATHLEN
+  #include <sys/stat.h>
+  #include <sys/ioctl.h>
+  #ifdef __linux__
+    #include <linux/fs.h>            // for FICLONE
+  #endif
   #define DAK_PATH_ENV_NAME "PATH"
   #define DAK_PATH_SEP ':'
   #define DAK_SLASH '/'
@@ -790,36 +796,7 @@ bool WorkdirHelper::recursive_copy(const bfs::path& src_path,
 				   const bfs::path& dest_dir, bool overwrite)
 {
   try {
-    // precondition: dest exists and is a dir
-    if (!bfs::exists(dest_dir) || !bfs::is_directory(dest_dir)) {
-      Cerr << "\nError: destination directory " << dest_dir 
-	   << " must exist for recursive_copy." << std::endl;
-      abort_handler(IO_ERROR);
-    }
-
-    bfs::path dest_path = dest_dir / src_path.filename();
-  
-    // TODO: gentler overwrite of contents, not top-level paths
-    if (overwrite && bfs::exists(dest_path))
-      bfs::remove_all(dest_path);
-
-    if (!bfs::exists(dest_path)) {
-
-      // non-recursive copy of file or directory or symlink into dest
-      bfs::copy(src_path, dest_path);
-      //bfs::create_directory(dest_path);
-      //bfs::copy_directory(src_path, dest_path);
-
-      if (bfs::is_directory(src_path)) {
-	bfs::directory_iterator dir_it(src_path);
-	bfs::directory_iterator dir_end;
-	for ( ; dir_it != dir_end; ++dir_it) {
-	  bfs::path src_item(dir_it->path());
-	  recursive_copy(src_item, dest_path, overwrite);
-	}
-      }
-    }
-
+    copy_tree(src_path, dest_dir, overwrite, false);
   }
   catch (const bfs::filesystem_error& e) {
     Cerr << "\nError: could not recursive copy " << src_path 
@@ -830,8 +807,108 @@ bool WorkdirHelper::recursive_copy(const bfs::path& src_path,
 }
 
 
-/// prepend the env path with source path if it's a directory or
-/// directory symlink
+/** Read-only regular files cannot be modified in place by an analysis
+    driver, so sharing them by hard link with the staged template is
+    safe; writable files are copied.  Falls back to a copy when the
+    link fails (e.g., across filesystems).  Throws bfs::filesystem_error
+    rather than aborting, so it may be used from a background thread. */
+void WorkdirHelper::stage_copy(const bfs::path& src_path, 
+			       const bfs::path& dest_dir, bool overwrite)
+{ copy_tree(src_path, dest_dir, overwrite, true); }
+
+
+void WorkdirHelper::copy_tree(const bfs::path& src_path,
+			      const bfs::path& dest_dir, bool overwrite,
+			      bool link_read_only)
+{
+  // precondition: dest exists and is a dir
+  if (!bfs::exists(dest_dir) || !bfs::is_directory(dest_dir))
+    throw bfs::filesystem_error("destination directory must exist for "
+      "recursive copy", dest_dir,
+      boost::system::errc::make_error_code
+      (boost::system::errc::not_a_directory));
+
+  bfs::path dest_path = dest_dir / src_path.filename();
+
+  // TODO: gentler overwrite of contents, not top-level paths
+  if (overwrite && bfs::exists(dest_path))
+    bfs::remove_all(dest_path);
+
+  if (bfs::exists(dest_path))
+    return;
+
+  bfs::file_status src_status = bfs::symlink_status(src_path);
+  if (bfs::is_regular_file(src_status)) {
+    const bfs::perms write_perms
+      = bfs::owner_write | bfs::group_write | bfs::others_write;
+    boost::system::error_code ec;
+    if (link_read_only && !(src_status.permissions() & write_perms))
+      bfs::create_hard_link(src_path, dest_path, ec);
+    if (!link_read_only || (src_status.permissions() & write_perms) || ec)
+      copy_file(src_path, dest_path);
+  }
+  else {
+    // non-recursive copy of directory or symlink into dest
+    bfs::copy(src_path, dest_path);
+
+    if (bfs::is_directory(src_status)) {
+      bfs::directory_iterator dir_it(src_path);
+      bfs::directory_iterator dir_end;
+      for ( ; dir_it != dir_end; ++dir_it)
+	copy_tree(dir_it->path(), dest_path, overwrite, link_read_only);
+    }
+  }
+}
+
+
+/** On Linux, first attempt a reflink (FICLONE), which shares extents
+    copy-on-write on filesystems such as Btrfs and XFS, then an
+    in-kernel copy_file_range, which avoids user-space buffers and may
+    be offloaded by NFS or other filesystems.  Any failure (including
+    an unsupported filesystem) falls back to the portable copy, which
+    throws bfs::filesystem_error on error. */
+void WorkdirHelper::copy_file(const bfs::path& src_path,
+			      const bfs::path& dest_path)
+{
+#ifdef __linux__
+  int src_fd = ::open(src_path.c_str(), O_RDONLY);
+  if (src_fd >= 0) {
+    struct stat src_stat;
+    int dest_fd = (::fstat(src_fd, &src_stat) == 0) ?
+      ::open(dest_path.c_str(), O_WRONLY | O_CREAT | O_EXCL,
+	     src_stat.st_mode & 07777) : -1;
+    bool copied = false;
+    if (dest_fd >= 0) {
+#ifdef FICLONE
+      copied = (::ioctl(dest_fd, FICLONE, src_fd) == 0);
+#endif
+#if defined(__GLIBC__) && \
+  (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+      if (!copied) {
+	off_t remaining = src_stat.st_size;
+	while (remaining > 0) {
+	  ssize_t num_copied
+	    = ::copy_file_range(src_fd, NULL, dest_fd, NULL, remaining, 0);
+	  if (num_copied <= 0) break;
+	  remaining -= num_copied;
+	}
+	copied = (remaining == 0);
+      }
+#endif
+      ::close(dest_fd);
+      if (!copied) // partial output: remove and use the portable copy
+	::unlink(dest_path.c_str());
+    }
+    ::close(src_fd);
+    if (copied)
+      return;
+  }
+#endif // __linux__
+
+  bfs::copy_file(src_path, dest_path);
+}
+
+
 bool WorkdirHelper::prepend_path_item(const bfs::path& src_path, 
 				      const bfs::path& dest_dir, bool overwrite)
 {
@@ -225,6 +225,12 @@ public:
   static bool recursive_copy(const bfs::path& src_path, 
 			     const bfs::path& dest_dir, bool overwrite);
  
+  /// Recursive copy of src_path into dest_dir as for recursive_copy,
+  /// except that read-only regular files are hard-linked; used to
+  /// populate work directories from a staged template
+  static void stage_copy(const bfs::path& src_path,
+			 const bfs::path& dest_dir, bool overwrite);
+
   /// prepend the preferred env path with source path if it's a
   /// directory; this will update cached preferred path and manipulate
   /// PATH
@@ -240,6 +246,11 @@ public:
   static bool find_file(const bfs::path& src_path, 
 			const bfs::path& search_file, bool overwrite);
 
+  /// copy a single regular file, using a copy-on-write clone or an
+  /// in-kernel copy where the platform and filesystem support them
+  static void copy_file(const bfs::path& src_path,
+			const bfs::path& dest_path);
+
   /// recursively perform file_op (copy, path adjust, etc.) on a list
   /// of source_paths (files, directories, symlinks), which
   /// potentially include wildcards, w.r.t. destination_dir
@@ -274,6 +285,11 @@ private:
   /// Tokenizes $PATH environment variable into a "list" of directories
   static std::vector<std::string> tokenize_env_path(const std::string& path);
 
+  /// shared implementation of recursive_copy and stage_copy; throws
+  /// bfs::filesystem_error on failure
+  static void copy_tree(const bfs::path& src_path, const bfs::path& dest_dir,
+			bool overwrite, bool link_read_only);
+
   //
   //- Heading: Data
   //
@@ -0,0 +1,209 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "WorkdirPool.hpp"
+#include "dakota_global_defs.hpp"
+
+
+namespace Dakota {
+
+/** Item paths are made absolute w.r.t. the startup directory, since
+    the background thread populates directories while the evaluation
+    thread may have changed into a work directory. */
+WorkdirPool::
+WorkdirPool(const StringArray& copy_items, const StringArray& link_items,
+	    const bfs::path& pool_root, size_t pool_size):
+  poolRoot(pool_root.is_absolute() ? pool_root :
+	   WorkdirHelper::rel_to_abs(pool_root)),
+  poolSize(pool_size), stopWorker(false)
+{
+  for (const String& item : copy_items)
+    copyItems.push_back(bfs::path(item).is_absolute() ? item :
+			WorkdirHelper::rel_to_abs(item).string());
+  for (const String& item : link_items)
+    linkItems.push_back(bfs::path(item).is_absolute() ? item :
+			WorkdirHelper::rel_to_abs(item).string());
+
+  WorkdirHelper::create_directory(poolRoot, DIR_PERSIST);
+  stage_template();
+
+  workerThread = std::thread(&WorkdirPool::run_worker, this);
+}
+
+
+WorkdirPool::~WorkdirPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    stopWorker = true;
+  }
+  poolCondition.notify_one();
+  if (workerThread.joinable())
+    workerThread.join();
+
+  for (const String& warning : workerWarnings)
+    Cerr << "\nWarning: " << warning << std::endl;
+  for (const bfs::path& dir_path : readyDirs)
+    WorkdirHelper::recursive_remove(dir_path, FILEOP_WARN);
+  for (const bfs::path& dir_path : retiredDirs)
+    WorkdirHelper::recursive_remove(dir_path, FILEOP_WARN);
+  if (!stagedTemplate.empty())
+    WorkdirHelper::recursive_remove(stagedTemplate, FILEOP_WARN);
+}
+
+
+bool WorkdirPool::claim(const bfs::path& dest_dir)
+{
+  check_worker();
+
+  // preserve existing DIR_PERSIST semantics for a pre-existing directory
+  boost::system::error_code ec;
+  if (bfs::exists(dest_dir, ec))
+    return false;
+
+  bfs::path dir_path;
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (readyDirs.empty())
+      return false;
+    dir_path = readyDirs.front();
+    readyDirs.pop_front();
+  }
+  poolCondition.notify_one(); // refill
+
+  // fails, e.g., if dest_dir is on a different filesystem than poolRoot
+  bfs::rename(dir_path, dest_dir, ec);
+  if (ec) {
+    retire(dir_path);
+    return false;
+  }
+  return true;
+}
+
+
+void WorkdirPool::retire(const bfs::path& dir_path)
+{
+  check_worker();
+
+  // rename immediately so the name may be reused by a later evaluation
+  bfs::path retired_path
+    = poolRoot / WorkdirHelper::system_tmp_file(".dakota_retired");
+  boost::system::error_code ec;
+  bfs::rename(dir_path, retired_path, ec);
+  if (ec) {
+    WorkdirHelper::recursive_remove(dir_path, FILEOP_WARN);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    retiredDirs.push_back(retired_path);
+  }
+  poolCondition.notify_one();
+}
+
+
+/** The template is staged once per pool under a unique name, such that
+    it reflects the copy_files items at the start of the run and is
+    never shared with (or left behind for) other runs.  Staging and the
+    expansion of link_files wildcards occur on the owning thread, where
+    errors may be reported directly. */
+void WorkdirPool::stage_template()
+{
+  stagedTemplate
+    = poolRoot / WorkdirHelper::system_tmp_file(".dakota_template");
+  WorkdirHelper::create_directory(stagedTemplate, DIR_ERROR);
+  WorkdirHelper::copy_items(copyItems, stagedTemplate, false);
+
+  file_op_function collect_op =
+    [this](const bfs::path& src_path, const bfs::path&, bool) {
+      linkPaths.push_back(src_path);
+      return false;
+    };
+  bfs::path dummy_path;
+  WorkdirHelper::file_op_items(collect_op, linkItems, dummy_path, false);
+}
+
+
+bfs::path WorkdirPool::populate_directory()
+{
+  bfs::path dir_path
+    = poolRoot / WorkdirHelper::system_tmp_file(".dakota_pool");
+  bfs::create_directory(dir_path);
+
+  bfs::directory_iterator dir_it(stagedTemplate), dir_end;
+  for ( ; dir_it != dir_end; ++dir_it)
+    WorkdirHelper::stage_copy(dir_it->path(), dir_path, false);
+  for (const bfs::path& link_path : linkPaths) {
+    bfs::path dest_path = dir_path / link_path.filename();
+    if (bfs::is_directory(link_path))
+      bfs::create_directory_symlink(link_path, dest_path);
+    else
+      bfs::create_symlink(link_path, dest_path);
+  }
+
+  return dir_path;
+}
+
+
+/** Refilling the pool takes priority over removing retired directories,
+    since only the former is on the critical path of an evaluation.
+    After a failure to populate a directory, no further directories are
+    populated (claims then fall back to the synchronous path, once the
+    error has been reported). */
+void WorkdirPool::run_worker()
+{
+  std::unique_lock<std::mutex> lock(poolMutex);
+  while (!stopWorker) {
+    if (readyDirs.size() < poolSize && workerError.empty()) {
+      lock.unlock();
+      bfs::path dir_path; String error;
+      try { dir_path = populate_directory(); }
+      catch (const std::exception& e)
+	{ error = String("could not prestage work directory; ") + e.what(); }
+      lock.lock();
+      if (error.empty()) readyDirs.push_back(dir_path);
+      else               workerError = error;
+    }
+    else if (!retiredDirs.empty()) {
+      bfs::path dir_path = retiredDirs.front();
+      retiredDirs.pop_front();
+      lock.unlock();
+      boost::system::error_code ec;
+      bfs::remove_all(dir_path, ec);
+      lock.lock();
+      if (ec)
+	workerWarnings.push_back("could not remove work directory " +
+				 dir_path.string() + "; " + ec.message());
+    }
+    else
+      poolCondition.wait(lock);
+  }
+}
+
+
+void WorkdirPool::check_worker()
+{
+  String error; StringArray warnings;
+  {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    std::swap(error, workerError);
+    std::swap(warnings, workerWarnings);
+    if (!error.empty()) // retain to suppress further population
+      workerError = error;
+  }
+  for (const String& warning : warnings)
+    Cerr << "\nWarning: " << warning << std::endl;
+  if (!error.empty()) {
+    Cerr << "\nError: " << error << std::endl;
+    abort_handler(IO_ERROR);
+  }
+}
+
+} // namespace Dakota
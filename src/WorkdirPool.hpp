@@ -0,0 +1,133 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef WORKDIR_POOL_H
+#define WORKDIR_POOL_H
+
+#include "WorkdirHelper.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+
+namespace Dakota {
+
+/// Pool of prestaged evaluation work directories
+
+/** WorkdirPool moves work directory setup off the evaluation
+    scheduling thread when requested with the work_directory prestage
+    specification.  The copy_files template is staged once, when the
+    pool is constructed, into a uniquely named directory beneath the
+    pool root that is removed with the pool.  A background thread then
+    keeps a bounded number of directories populated from the staged
+    template, hard-linking read-only files and cloning or copying the
+    rest, together with the link_files symlinks.  Claiming a directory
+    for an evaluation is a rename within the pool root's filesystem.
+    Directories retired after an evaluation are renamed out of the way
+    and removed by the background thread.
+
+    The background thread never calls abort_handler(): filesystem
+    errors are recorded and reported by the owning (evaluation) thread
+    at its next call into the pool. */
+class WorkdirPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// constructor: stages the template and starts the background thread
+  WorkdirPool(const StringArray& copy_items, const StringArray& link_items,
+	      const bfs::path& pool_root, size_t pool_size);
+  /// destructor: stops the background thread and removes the staged
+  /// template and any unclaimed or retired directories
+  ~WorkdirPool();
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// rename a prestaged directory to dest_dir; returns false (leaving
+  /// the caller to create dest_dir) when none is ready or dest_dir exists
+  bool claim(const bfs::path& dest_dir);
+
+  /// hand off a no longer needed work directory for asynchronous removal
+  void retire(const bfs::path& dir_path);
+
+  /// the directory containing the staged template
+  const bfs::path& staged_template() const;
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// stage copyItems into a new stagedTemplate and expand linkItems
+  /// into linkPaths
+  void stage_template();
+
+  /// create and populate a new directory in the pool root; throws
+  /// bfs::filesystem_error rather than aborting
+  bfs::path populate_directory();
+
+  /// background thread: refill readyDirs and remove retiredDirs
+  void run_worker();
+
+  /// report errors and warnings recorded by the background thread;
+  /// called from the owning thread only
+  void check_worker();
+
+  //
+  //- Heading: Data
+  //
+
+  /// template files/directories to be copied into each work directory
+  StringArray copyItems;
+  /// template files/directories to be linked from each work directory
+  StringArray linkItems;
+  /// absolute paths of linkItems, with wildcards expanded
+  std::vector<bfs::path> linkPaths;
+  /// absolute directory holding the staged template and pooled directories
+  bfs::path poolRoot;
+  /// absolute path of the staged copy of copyItems
+  bfs::path stagedTemplate;
+  /// number of directories to keep prestaged
+  size_t poolSize;
+
+  /// populated directories ready to be claimed
+  std::deque<bfs::path> readyDirs;
+  /// directories awaiting removal
+  std::deque<bfs::path> retiredDirs;
+
+  /// first fatal error encountered by the background thread
+  String workerError;
+  /// non-fatal (removal) warnings from the background thread
+  StringArray workerWarnings;
+
+  /// protects readyDirs, retiredDirs, stopWorker, and worker errors
+  std::mutex poolMutex;
+  /// signals the worker that a directory was claimed or retired
+  std::condition_variable poolCondition;
+  /// request for the worker to exit
+  bool stopWorker;
+  /// background thread populating and removing directories
+  std::thread workerThread;
+};
+
+
+inline const bfs::path& WorkdirPool::staged_template() const
+{ return stagedTemplate; }
+
+} // namespace Dakota
+
+#endif // WORKDIR_POOL_H
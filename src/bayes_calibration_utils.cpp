@@ -9,6 +9,7 @@
 
 #include "bayes_calibration_utils.hpp"
 #include "dakota_data_util.hpp"
+#include "dakota_stat_util.hpp"
 #include "Teuchos_SerialDenseHelpers.hpp"
 #include <boost/math/distributions/students_t.hpp>
 using namespace boost::math;
@@ -66,7 +67,7 @@ void batch_means_interval(RealMatrix& mcmc_matrix, RealMatrix& interval_matrix,
   means_matrix = means_matrix_tt;
 
   // Calculate approximate variance
-  Real scale = batch_size/(num_batches - 1);
+  Real scale = (Real)batch_size/(num_batches - 1);
   for (int i = 0; i < num_qoi; i++) {
     approx_var_chain[i] = scale*approx_var_chain[i];
   }
@@ -129,7 +130,7 @@ void batch_means_percentile(RealMatrix& mcmc_matrix, RealMatrix&
   means_matrix = means_matrix_tt;
 
   // Calculate approximate variance
-  Real scale = batch_size/(num_batches - 1);
+  Real scale = (Real)batch_size/(num_batches - 1);
   for (int i = 0; i < num_qoi; i++) {
     approx_var_chain[i] = scale*approx_var_chain[i];
   }
@@ -147,4 +148,105 @@ void batch_means_percentile(RealMatrix& mcmc_matrix, RealMatrix&
   }
 }
 
+
+void ChainAccumulator::initialize(int num_qoi, int chain_length)
+{
+  numQoI = num_qoi;
+  batchSize = std::max((int)std::sqrt((Real)chain_length), 1);
+  numBatches = chain_length/batchSize;
+  numSamples = batchCount = completedBatches = 0;
+  chainSums.shape(4, numQoI);
+  batchSums.shape(2, numQoI);
+  batchMeans.shape(numBatches, numQoI);
+  batchVariances.shape(numBatches, numQoI);
+}
+
+
+void ChainAccumulator::accumulate(const Real* sample)
+{
+  int i;
+  for (i=0; i<numQoI; ++i)
+    accumulate_central_sums(sample[i], numSamples, chainSums[i]);
+  ++numSamples;
+
+  // samples past the last complete batch contribute to the chain sums only
+  if (completedBatches == numBatches)
+    return;
+  for (i=0; i<numQoI; ++i) {
+    Real* batch_sums = batchSums[i];
+    Real delta = sample[i] - batch_sums[0];
+    batch_sums[0] += delta / (batchCount + 1);
+    batch_sums[1] += delta * (sample[i] - batch_sums[0]);
+  }
+  if (++batchCount == batchSize) {
+    for (i=0; i<numQoI; ++i) {
+      batchMeans(completedBatches, i) = batchSums(0, i);
+      batchVariances(completedBatches, i) = (batchSize > 1) ?
+	batchSums(1, i) / (batchSize - 1) : 0.;
+      batchSums(0, i) = batchSums(1, i) = 0.;
+    }
+    batchCount = 0;
+    ++completedBatches;
+  }
+}
+
+
+void ChainAccumulator::moments(RealMatrix& moment_stats) const
+{
+  moment_stats.shapeUninitialized(4, numQoI);
+  for (int i=0; i<numQoI; ++i)
+    central_sums_to_moments(chainSums[i], numSamples, true, moment_stats[i]);
+}
+
+
+void ChainAccumulator::
+batch_means_interval(RealMatrix& interval_matrix, RealMatrix& means_matrix,
+		     int moment, Real alpha) const
+{
+  if (completedBatches < 2) {
+    Cerr << "\nError: batch means intervals require at least two complete "
+	 << "batches; " << completedBatches << " completed." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+
+  const RealMatrix& batch_stats = (moment == 1) ? batchMeans : batchVariances;
+  means_matrix.reshape(completedBatches, numQoI);
+  interval_matrix.reshape(2, numQoI);
+  Real scale = (Real)batchSize/(completedBatches - 1);
+  boost::math::students_t t_dist(numSamples-1);
+  Real t_star = quantile(complement(t_dist, (1-alpha)/2));
+  for (int i=0; i<numQoI; ++i) {
+    const Real* sums = chainSums[i];
+    Real func_totalchain = (moment == 1) ? sums[0] : sums[1]/(numSamples-1),
+      approx_var_chain = 0.;
+    for (int j=0; j<completedBatches; ++j) {
+      Real func_subchain = batch_stats(j, i);
+      means_matrix(j, i) = func_subchain;
+      approx_var_chain += std::pow(func_subchain - func_totalchain, 2);
+    }
+    Real half_width = t_star*std::sqrt(scale*approx_var_chain/numSamples);
+    interval_matrix(0, i) = func_totalchain - half_width;
+    if (moment == 2 && interval_matrix(0, i) < 0)
+      interval_matrix(0, i) = 0; // variance must be positive
+    interval_matrix(1, i) = func_totalchain + half_width;
+  }
+}
+
+
+void ChainAccumulator::effective_sample_size(RealVector& ess) const
+{
+  ess.sizeUninitialized(numQoI);
+  for (int i=0; i<numQoI; ++i) {
+    // batch means estimate of the asymptotic variance, batchSize * Var[ybar_k]
+    Real mean = chainSums(0, i), sum_sq = 0.;
+    for (int j=0; j<completedBatches; ++j)
+      sum_sq += std::pow(batchMeans(j, i) - mean, 2);
+    Real var = (numSamples > 1) ? chainSums(1, i)/(numSamples - 1) : 0.,
+      asymp_var = (completedBatches > 1) ?
+        batchSize * sum_sq / (completedBatches - 1) : 0.;
+    ess[i] = (asymp_var > 0.) ? numSamples * var / asymp_var
+      : (Real)numSamples;
+  }
+}
+
 } // namespace Dakota
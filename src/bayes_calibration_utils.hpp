@@ -7,6 +7,9 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#ifndef BAYES_CALIBRATION_UTILS_H
+#define BAYES_CALIBRATION_UTILS_H
+
 #include "dakota_data_types.hpp"
 
 namespace Dakota {
@@ -17,4 +20,99 @@ void batch_means_percentile(RealMatrix& mcmc_matrix, RealMatrix&
                             interval_matrix, RealMatrix& means_matrix, Real 
                             percentile, Real alpha);
 
+
+/// One-pass statistics of an MCMC chain of known length
+
+/** Samples are accumulated in chain order without being retained.
+    Running central sums give the moments of the whole chain, and the
+    means and variances of consecutive batches of floor(sqrt(length))
+    samples give the same batch means intervals as
+    batch_means_interval() along with effective sample sizes.
+    NonDBayesCalibration feeds it the retained acceptance chain after
+    sampling completes, as a single pass replacing the per-moment scans
+    of chain_diagnostics; the chain itself is still held in memory. */
+class ChainAccumulator
+{
+public:
+
+  /// default constructor
+  ChainAccumulator();
+  /// constructor for num_qoi quantities over chain_length samples
+  ChainAccumulator(int num_qoi, int chain_length);
+
+  /// reset for num_qoi quantities over chain_length samples
+  void initialize(int num_qoi, int chain_length);
+
+  /// add the next chain sample of num_qoi values
+  void accumulate(const Real* sample);
+  /// add each column of chain in order
+  void accumulate(const RealMatrix& chain);
+
+  /// number of samples accumulated
+  int count() const;
+
+  /// mean, standard deviation, skewness, and excess kurtosis of each
+  /// quantity over the accumulated samples
+  void moments(RealMatrix& moment_stats) const;
+
+  /// confidence intervals for the mean (moment = 1) or variance
+  /// (moment = 2) from the completed batches, as for batch_means_interval()
+  void batch_means_interval(RealMatrix& interval_matrix,
+			    RealMatrix& means_matrix, int moment,
+			    Real alpha) const;
+
+  /// effective sample size of each quantity, from the ratio of its
+  /// variance to the batch means estimate of the variance of its mean
+  void effective_sample_size(RealVector& ess) const;
+
+private:
+
+  /// number of quantities per sample
+  int numQoI;
+  /// samples per batch
+  int batchSize;
+  /// number of batches in a chain of the initialized length
+  int numBatches;
+  /// number of samples accumulated
+  int numSamples;
+
+  /// running mean and central sums of each quantity (4 x numQoI)
+  RealMatrix chainSums;
+  /// running mean and second central sum of the batch in progress
+  /// (2 x numQoI)
+  RealMatrix batchSums;
+  /// number of samples in the batch in progress
+  int batchCount;
+  /// number of completed batches
+  int completedBatches;
+  /// means of the completed batches (numBatches x numQoI)
+  RealMatrix batchMeans;
+  /// variances of the completed batches (numBatches x numQoI)
+  RealMatrix batchVariances;
+};
+
+
+inline ChainAccumulator::ChainAccumulator():
+  numQoI(0), batchSize(1), numBatches(0), numSamples(0), batchCount(0),
+  completedBatches(0)
+{ }
+
+
+inline ChainAccumulator::ChainAccumulator(int num_qoi, int chain_length)
+{ initialize(num_qoi, chain_length); }
+
+
+inline void ChainAccumulator::accumulate(const RealMatrix& chain)
+{
+  int i, num_samples = chain.numCols();
+  for (i=0; i<num_samples; ++i)
+    accumulate(chain[i]);
+}
+
+
+inline int ChainAccumulator::count() const
+{ return numSamples; }
+
 } // namespace Dakota
+
+#endif
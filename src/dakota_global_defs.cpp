@@ -7,6 +7,8 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#include <mutex>
+#include <shared_mutex>
 #include <system_error>
 #include <boost/math/constants/constants.hpp>
 #include "dakota_global_defs.hpp"
@@ -55,7 +57,14 @@ std::ostream* dakota_cout = &std::cout; ///< DAKOTA stdout initially points to
 std::ostream* dakota_cerr = &std::cerr; ///< DAKOTA stderr initially points to
   ///< std::cerr, but may be redirected to a tagged ofstream if there are
   ///< concurrent iterators.
+thread_local std::ostream* dakota_thread_cout = NULL; ///< when non-null,
+  ///< overrides dakota_cout for the calling thread (e.g., to buffer the
+  ///< output of threaded sub-iterators); other threads share dakota_cout
+thread_local std::ostream* dakota_thread_cerr = NULL; ///< when non-null,
+  ///< overrides dakota_cerr for the calling thread
 PRPCache data_pairs;          ///< contains all parameter/response pairs.
+std::shared_timed_mutex data_pairs_mutex; ///< serializes data_pairs updates
+  ///< among threaded sub-iterators; exact lookups share the lock
 
 /// Global results database for iterator results
 ResultsManager iterator_results_db;
@@ -34,9 +34,12 @@ extern double HALF_LOG_2PI;
 // Global objects
 // --------------
 
-// define Cout/Cerr, use them to dereference dakota_cout/dakota_cerr
-#define Cout (*Dakota::dakota_cout)
-#define Cerr (*Dakota::dakota_cerr)
+// define Cout/Cerr, use them to dereference dakota_cout/dakota_cerr, unless
+// overridden for the calling thread (see dakota_thread_cout/dakota_thread_cerr)
+#define Cout (Dakota::dakota_thread_cout ? *Dakota::dakota_thread_cout : \
+	      *Dakota::dakota_cout)
+#define Cerr (Dakota::dakota_thread_cerr ? *Dakota::dakota_thread_cerr : \
+	      *Dakota::dakota_cerr)
 
 // externs
 // Note: Dakota class externs are declared elsewhere in order to maintain a
@@ -128,6 +131,8 @@ public:
 
 extern std::ostream* dakota_cout;
 extern std::ostream* dakota_cerr;
+extern thread_local std::ostream* dakota_thread_cout;
+extern thread_local std::ostream* dakota_thread_cerr;
 extern int write_precision;
 
 /// options for tabular columns
@@ -0,0 +1,563 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+/** \file dakota_perf.cpp
+    \brief benchmark driver measuring the per-evaluation framework
+    overhead of the Dakota evaluation pipeline */
+
+#include "LibraryEnvironment.hpp"
+#include "ProblemDescDB.hpp"
+#include "DakotaModel.hpp"
+#include "DakotaInterface.hpp"
+#include "DirectApplicInterface.hpp"
+#include "ParamResponsePair.hpp"
+#include "PRPMultiIndex.hpp"
+#include <boost/archive/binary_oarchive.hpp>
+#include <nlohmann/json.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <new>
+#include <sstream>
+#include <vector>
+#ifdef _WIN32
+#include <malloc.h> // _aligned_malloc
+#endif
+
+using json = nlohmann::json;
+
+
+// ------------------------------------------------------------
+// Allocation counting: replace the global allocation functions
+// for this executable only (array forms forward to these)
+// ------------------------------------------------------------
+
+/// total number of calls to global operator new
+static std::atomic<unsigned long long> perfAllocCount(0);
+
+void* operator new(std::size_t size)
+{
+  ++perfAllocCount;
+  if (void* ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  ++perfAllocCount;
+  return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* ptr) noexcept
+{ std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept
+{ std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{ std::free(ptr); }
+
+#ifdef __cpp_aligned_new
+// over-aligned types (e.g., SIMD-aligned Eigen members) use these overloads
+
+static void* perf_aligned_alloc(std::size_t size, std::align_val_t align)
+{
+  ++perfAllocCount;
+  std::size_t alignment = std::max(static_cast<std::size_t>(align),
+				   sizeof(void*));
+#ifdef _WIN32
+  return _aligned_malloc(size ? size : 1, alignment);
+#else
+  void* ptr = NULL;
+  return (posix_memalign(&ptr, alignment, size ? size : 1)) ? NULL : ptr;
+#endif
+}
+
+static void perf_aligned_free(void* ptr)
+{
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+  if (void* ptr = perf_aligned_alloc(size, align))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align,
+		   const std::nothrow_t&) noexcept
+{ return perf_aligned_alloc(size, align); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{ perf_aligned_free(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{ perf_aligned_free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t,
+		     const std::nothrow_t&) noexcept
+{ perf_aligned_free(ptr); }
+#endif // __cpp_aligned_new
+
+
+namespace {
+
+/// Options for a dakota_perf study
+struct PerfOptions {
+  size_t numEvals = 10000;  ///< number of evaluations per stage
+  size_t numVars  = 2;      ///< number of continuous design variables
+  size_t numFns   = 1;      ///< number of response functions
+  bool   gradients = false; ///< request analytic gradients
+  bool   cache    = true;   ///< evaluation cache active
+  bool   restart  = true;   ///< restart file active
+  bool   hdf5     = false;  ///< HDF5 results output active
+  bool   tabular  = false;  ///< tabular data output active
+  int    concurrency = 1;   ///< batch size for local evaluation concurrency
+  Dakota::String jsonFile;  ///< JSON output file (stdout if empty)
+  double maxUsPerEval = 0.; ///< if > 0, fail when the study exceeds this
+  size_t numRequests = 0;   ///< repeated-study requests for latency stages
+};
+
+
+/// Direct interface plug-in with a negligible analysis driver, such
+/// that timings reflect only the evaluation pipeline
+class PerfNoOpInterface: public Dakota::DirectApplicInterface
+{
+public:
+
+  /// constructor
+  PerfNoOpInterface(const Dakota::ProblemDescDB& problem_db):
+    Dakota::DirectApplicInterface(problem_db), driverSeconds(0.)
+  { }
+
+  /// accumulated time spent in the analysis driver
+  double driver_seconds() const
+  { return driverSeconds; }
+  /// reset the accumulated driver time
+  void reset_driver_seconds()
+  { driverSeconds = 0.; }
+
+protected:
+
+  /// f_i = sum_j x_j with unit gradients
+  int derived_map_ac(const Dakota::String& ac_name)
+  {
+    auto start = std::chrono::steady_clock::now();
+    Dakota::Real sum = 0.;
+    for (size_t j=0; j<numACV; ++j)
+      sum += xC[j];
+    for (size_t i=0; i<numFns; ++i) {
+      if (directFnASV[i] & 1)
+	fnVals[i] = sum;
+      if (directFnASV[i] & 2)
+	for (size_t j=0; j<numDerivVars; ++j)
+	  fnGrads(j, i) = 1.;
+    }
+    driverSeconds += std::chrono::duration<double>
+      (std::chrono::steady_clock::now() - start).count();
+    return 0;
+  }
+
+  /// no-op hides base error; job batching occurs within
+  /// wait_local_evaluations()
+  void derived_map_asynch(const Dakota::ParamResponsePair& pair)
+  { }
+
+  /// evaluate the batch of jobs contained in prp_queue
+  void wait_local_evaluations(Dakota::PRPQueue& prp_queue)
+  {
+    for (Dakota::PRPQueueIter prp_iter = prp_queue.begin();
+	 prp_iter != prp_queue.end(); ++prp_iter) {
+      Dakota::Response resp = prp_iter->response(); // shared rep
+      derived_map(prp_iter->variables(), prp_iter->active_set(), resp,
+		  prp_iter->eval_id());
+      completionSet.insert(prp_iter->eval_id());
+    }
+  }
+
+  /// invokes wait_local_evaluations() (no special nowait support)
+  void test_local_evaluations(Dakota::PRPQueue& prp_queue)
+  { wait_local_evaluations(prp_queue); }
+
+  /// no-op hides default run-time error checks at DirectApplicInterface level
+  void init_communicators_checks(int max_eval_concurrency)
+  { }
+  /// no-op hides default run-time error checks at DirectApplicInterface level
+  void set_communicators_checks(int max_eval_concurrency)
+  { }
+
+private:
+
+  double driverSeconds; ///< accumulated analysis driver time
+};
+
+
+/// Timing and allocation counts for a benchmark stage
+class StageTimer
+{
+public:
+
+  /// start timing a stage
+  StageTimer():
+    startAllocs(perfAllocCount.load()),
+    startTime(std::chrono::steady_clock::now())
+  { }
+
+  /// record the stage, normalized by num_evals, into results
+  void record(json& results, const Dakota::String& stage, size_t num_evals,
+	      double driver_seconds = -1.) const
+  {
+    double seconds = std::chrono::duration<double>
+      (std::chrono::steady_clock::now() - startTime).count();
+    unsigned long long allocs = perfAllocCount.load() - startAllocs;
+    json& entry = results[stage];
+    entry["evaluations"]     = num_evals;
+    entry["seconds"]         = seconds;
+    entry["us_per_eval"]     = 1.e+6 * seconds / num_evals;
+    entry["allocations"]     = allocs;
+    entry["allocs_per_eval"] = (double)allocs / num_evals;
+    if (driver_seconds >= 0.) {
+      entry["driver_seconds"]        = driver_seconds;
+      entry["overhead_us_per_eval"]
+	= 1.e+6 * (seconds - driver_seconds) / num_evals;
+    }
+  }
+
+private:
+
+  unsigned long long startAllocs; ///< allocation count at stage start
+  std::chrono::steady_clock::time_point startTime; ///< stage start time
+};
+
+
+/// Print usage for dakota_perf
+void print_usage(std::ostream& s)
+{
+  s << "Usage: dakota_perf [options]\n"
+    << "  --evals N           evaluations per stage (default 10000)\n"
+    << "  --vars N            continuous variables (default 2)\n"
+    << "  --responses N       response functions (default 1)\n"
+    << "  --gradients         request analytic gradients\n"
+    << "  --cache on|off      evaluation cache (default on)\n"
+    << "  --restart on|off    restart file (default on)\n"
+    << "  --hdf5 on|off       HDF5 results output (default off)\n"
+    << "  --tabular on|off    tabular data output (default off)\n"
+    << "  --concurrency N     local batch evaluation size (default 1)\n"
+    << "  --json FILE         write results to FILE (default stdout)\n"
+    << "  --max-us-per-eval X fail if the study exceeds X us/evaluation\n"
+    << "  --requests N        time N repeated studies, constructing a new\n"
+    << "                      environment per request vs. rerunning one\n"
+    << "                      (default 0: skip)\n";
+}
+
+
+/// Parse on|off flags, returning false on error
+bool parse_flag(const char* arg, bool& flag)
+{
+  if      (!std::strcmp(arg, "on"))  flag = true;
+  else if (!std::strcmp(arg, "off")) flag = false;
+  else return false;
+  return true;
+}
+
+
+/// Parse command line into opts, returning false on error
+bool parse_options(int argc, char* argv[], PerfOptions& opts)
+{
+  for (int i=1; i<argc; ++i) {
+    const char* arg = argv[i];
+    bool has_val = (i+1 < argc);
+    if (!std::strcmp(arg, "--gradients"))
+      opts.gradients = true;
+    else if (!has_val)
+      return false;
+    else if (!std::strcmp(arg, "--evals"))
+      opts.numEvals = std::strtoul(argv[++i], NULL, 10);
+    else if (!std::strcmp(arg, "--vars"))
+      opts.numVars = std::strtoul(argv[++i], NULL, 10);
+    else if (!std::strcmp(arg, "--responses"))
+      opts.numFns = std::strtoul(argv[++i], NULL, 10);
+    else if (!std::strcmp(arg, "--concurrency"))
+      opts.concurrency = std::atoi(argv[++i]);
+    else if (!std::strcmp(arg, "--json"))
+      opts.jsonFile = argv[++i];
+    else if (!std::strcmp(arg, "--max-us-per-eval"))
+      opts.maxUsPerEval = std::atof(argv[++i]);
+    else if (!std::strcmp(arg, "--requests"))
+      opts.numRequests = std::strtoul(argv[++i], NULL, 10);
+    else if (!std::strcmp(arg, "--cache")) {
+      if (!parse_flag(argv[++i], opts.cache))   return false; }
+    else if (!std::strcmp(arg, "--restart")) {
+      if (!parse_flag(argv[++i], opts.restart)) return false; }
+    else if (!std::strcmp(arg, "--hdf5")) {
+      if (!parse_flag(argv[++i], opts.hdf5))    return false; }
+    else if (!std::strcmp(arg, "--tabular")) {
+      if (!parse_flag(argv[++i], opts.tabular)) return false; }
+    else
+      return false;
+  }
+  return (opts.numEvals > 0 && opts.numVars > 0 && opts.numFns > 0 &&
+	  opts.concurrency > 0);
+}
+
+
+/// Generate the Dakota input for a vector parameter study of
+/// opts.numEvals evaluations against the no-op driver
+Dakota::String perf_input(const PerfOptions& opts)
+{
+  std::ostringstream input;
+  input << "environment\n";
+  if (opts.tabular)
+    input << "  tabular_data tabular_data_file 'dakota_perf.dat'\n";
+  if (opts.hdf5)
+    input << "  results_output hdf5 results_output_file 'dakota_perf'\n";
+  input << "method\n  output silent\n  vector_parameter_study\n"
+	<< "    num_steps = " << opts.numEvals - 1 << "\n    final_point =";
+  for (size_t j=0; j<opts.numVars; ++j)
+    input << " 1.";
+  input << "\nvariables\n  continuous_design = " << opts.numVars
+	<< "\n    initial_point =";
+  for (size_t j=0; j<opts.numVars; ++j)
+    input << " 0.";
+  input << "\ninterface\n  direct\n    analysis_driver = 'perf_noop'\n";
+  if (!opts.cache || !opts.restart) {
+    input << "  deactivate";
+    if (!opts.cache)   input << " evaluation_cache";
+    if (!opts.restart) input << " restart_file";
+    input << '\n';
+  }
+  if (opts.concurrency > 1)
+    input << "  batch size = " << opts.concurrency << '\n';
+  input << "responses\n  response_functions = " << opts.numFns << '\n'
+	<< ( (opts.gradients) ? "  analytic_gradients\n" : "  no_gradients\n" )
+	<< "  no_hessians\n";
+  return input.str();
+}
+
+
+/// Plug a PerfNoOpInterface into the perf_noop model of env
+std::shared_ptr<PerfNoOpInterface>
+plugin_noop_interface(Dakota::LibraryEnvironment& env)
+{
+  Dakota::ModelList filt_models
+    = env.filtered_model_list("simulation", "direct", "perf_noop");
+  if (filt_models.empty()) {
+    Cerr << "Error: no perf_noop interface available for plugin."
+	 << std::endl;
+    Dakota::abort_handler(-1);
+  }
+  Dakota::ProblemDescDB& problem_db = env.problem_description_db();
+  size_t model_index = problem_db.get_db_model_node(); // for restoration
+  Dakota::Model& model = filt_models.front();
+  problem_db.set_db_model_nodes(model.model_id());
+  std::shared_ptr<PerfNoOpInterface> noop_iface
+    = std::make_shared<PerfNoOpInterface>(problem_db);
+  model.derived_interface().assign_rep(noop_iface);
+  problem_db.set_db_model_nodes(model_index);
+  return noop_iface;
+}
+
+
+/// Record the distribution of per-request latencies into results
+void record_latency(json& results, const Dakota::String& stage,
+		    std::vector<double>& seconds)
+{
+  std::sort(seconds.begin(), seconds.end());
+  size_t num_req = seconds.size();
+  double total = 0.;
+  for (double s : seconds)
+    total += s;
+  json& entry = results[stage];
+  entry["requests"]       = num_req;
+  entry["us_per_request"] = 1.e+6 * total / num_req;
+  entry["us_p50"]         = 1.e+6 * seconds[num_req / 2];
+  entry["us_p99"]         = 1.e+6 * seconds[(99 * (num_req - 1)) / 100];
+  entry["us_max"]         = 1.e+6 * seconds.back();
+}
+
+} // anonymous namespace
+
+
+/// Benchmark of per-evaluation overhead in the evaluation pipeline.
+
+/** Usage: dakota_perf [options] (see --help)
+
+    Runs a synthetic vector parameter study against a no-op direct
+    driver and times: (1) the end-to-end study (Iterator, Model,
+    ApplicationInterface::map(), duplicate detection, restart,
+    evaluation store, tabular output); (2) Model::evaluate() in
+    isolation; and (3) the hot-path components ParamResponsePair
+    construction, PRPMultiIndexCache insertion and lookup, and restart
+    serialization.  Time and allocations per evaluation for each stage
+    are reported as JSON.  With --requests, the latency of repeated
+    studies is also reported, comparing LibraryEnvironment::rerun() of
+    the persistent environment against constructing a new environment
+    per request. */
+int main(int argc, char* argv[])
+{
+  PerfOptions perf_opts;
+  if (!parse_options(argc, argv, perf_opts)) {
+    print_usage(std::cerr);
+    return 1;
+  }
+
+  Dakota::ProgramOptions opts;
+  opts.input_string(perf_input(perf_opts));
+  opts.output_file("dakota_perf.out");
+  if (perf_opts.restart)
+    opts.write_restart_file("dakota_perf.rst");
+
+  json results;
+  results["config"] = {
+    {"evaluations", perf_opts.numEvals}, {"variables", perf_opts.numVars},
+    {"responses", perf_opts.numFns},     {"gradients", perf_opts.gradients},
+    {"cache", perf_opts.cache},          {"restart", perf_opts.restart},
+    {"hdf5", perf_opts.hdf5},            {"tabular", perf_opts.tabular},
+    {"concurrency", perf_opts.concurrency},
+    {"requests", perf_opts.numRequests} };
+  json& stages = results["stages"];
+  size_t i, num_evals = perf_opts.numEvals;
+  bool study_ok = true;
+  {
+    // ----------------------------------
+    // Construction of the environment
+    // ----------------------------------
+    StageTimer construct_timer;
+    Dakota::LibraryEnvironment env(opts);
+    construct_timer.record(stages, "construct", 1);
+
+    std::shared_ptr<PerfNoOpInterface> noop_iface = plugin_noop_interface(env);
+    Dakota::Model model = env.filtered_model_list
+      ("simulation", "direct", "perf_noop").front(); // shared rep
+
+    // ----------------------------------
+    // End-to-end study
+    // ----------------------------------
+    StageTimer study_timer;
+    env.execute();
+    study_timer.record(stages, "study", num_evals,
+		       noop_iface->driver_seconds());
+
+    // ----------------------------------
+    // Model::evaluate() in isolation (values offset from the study to
+    // avoid cache hits)
+    // ----------------------------------
+    noop_iface->reset_driver_seconds();
+    StageTimer eval_timer;
+    for (i=0; i<num_evals; ++i) {
+      model.continuous_variable(2. + (Dakota::Real)i, 0);
+      model.evaluate();
+    }
+    eval_timer.record(stages, "model_evaluate", num_evals,
+		      noop_iface->driver_seconds());
+
+    // ----------------------------------
+    // Hot-path components
+    // ----------------------------------
+    Dakota::Variables vars = model.current_variables().copy();
+    const Dakota::Response& resp = model.current_response();
+    const Dakota::String& iface_id = model.interface_id();
+
+    StageTimer vars_timer;
+    for (i=0; i<num_evals; ++i)
+      Dakota::Variables vars_copy = vars.copy();
+    vars_timer.record(stages, "variables_copy", num_evals);
+
+    StageTimer resp_timer;
+    for (i=0; i<num_evals; ++i)
+      Dakota::Response resp_copy = resp.copy();
+    resp_timer.record(stages, "response_copy", num_evals);
+
+    Dakota::PRPArray prps; prps.reserve(num_evals);
+    StageTimer prp_timer;
+    for (i=0; i<num_evals; ++i) {
+      vars.continuous_variable(-1. - (Dakota::Real)i, 0); // distinct cache keys
+      prps.push_back(Dakota::ParamResponsePair(vars, iface_id, resp, i+1));
+    }
+    prp_timer.record(stages, "prp_construct", num_evals);
+
+    Dakota::PRPCache cache;
+    StageTimer insert_timer;
+    for (i=0; i<num_evals; ++i)
+      cache.insert(prps[i]);
+    insert_timer.record(stages, "cache_insert", num_evals);
+
+    size_t num_found = 0;
+    StageTimer lookup_timer;
+    for (i=0; i<num_evals; ++i)
+      if (Dakota::lookup_by_val(cache, prps[i]) != cache.get<Dakota::hashed>().end())
+	++num_found;
+    lookup_timer.record(stages, "cache_lookup", num_evals);
+    if (num_found != num_evals)
+      study_ok = false;
+
+    std::ostringstream rst_stream;
+    {
+      boost::archive::binary_oarchive rst_archive(rst_stream);
+      StageTimer restart_timer;
+      for (i=0; i<num_evals; ++i)
+	rst_archive & prps[i];
+      restart_timer.record(stages, "restart_write", num_evals);
+    }
+
+    // ----------------------------------
+    // Per-request latency of a repeated study: rerun of the persistent
+    // environment (cache and counters reset) ...
+    // ----------------------------------
+    if (perf_opts.numRequests) {
+      std::vector<double> req_seconds(perf_opts.numRequests);
+      for (i=0; i<perf_opts.numRequests; ++i) {
+	auto start = std::chrono::steady_clock::now();
+	env.rerun();
+	req_seconds[i] = std::chrono::duration<double>
+	  (std::chrono::steady_clock::now() - start).count();
+      }
+      record_latency(stages, "request_rerun", req_seconds);
+    }
+  }
+
+  // ----------------------------------
+  // ... vs. construction of a new environment per request
+  // ----------------------------------
+  if (perf_opts.numRequests) {
+    std::vector<double> req_seconds(perf_opts.numRequests);
+    for (i=0; i<perf_opts.numRequests; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      Dakota::LibraryEnvironment req_env(opts);
+      plugin_noop_interface(req_env);
+      req_env.execute();
+      req_seconds[i] = std::chrono::duration<double>
+	(std::chrono::steady_clock::now() - start).count();
+    }
+    record_latency(stages, "request_construct", req_seconds);
+  }
+
+  double study_us = stages["study"]["us_per_eval"].get<double>();
+  if (perf_opts.maxUsPerEval > 0. && study_us > perf_opts.maxUsPerEval)
+    study_ok = false;
+  results["pass"] = study_ok;
+
+  if (perf_opts.jsonFile.empty())
+    std::cout << results.dump(2) << std::endl;
+  else {
+    std::ofstream json_stream(perf_opts.jsonFile);
+    json_stream << results.dump(2) << std::endl;
+  }
+
+  return (study_ok) ? 0 : 1;
+}
@@ -37,6 +37,39 @@ int generate_system_seed()
   return seed;
 }
 
+//----------------------------------------------------------------
+
+/** Applies the same bias corrections for estimated means as the
+    conversion of accumulated sums in NonDEnsembleSampling.  A zero
+    variance retains the central moments, as for centered_to_standard(). */
+void central_sums_to_moments(const Real* sums, size_t num_samp,
+			     bool standardize, Real* moments)
+{
+  Real ns = (Real)num_samp, cm1 = sums[0], cm2 = sums[1] / ns,
+    cm3 = sums[2] / ns, cm4 = sums[3] / ns;
+  if (num_samp > 3) {
+    Real nm1 = ns - 1., nm2 = ns - 2., n_sq = ns * ns;
+    cm2 *= ns / nm1;
+    cm3 *= n_sq / (nm1 * nm2);
+    cm4 = ( n_sq * ns * cm4 / nm1 - (6. * ns - 9.) * (n_sq - ns)
+	    / (n_sq - 2. * ns + 3) * cm2 * cm2 )
+        / ( (n_sq - 3. * ns + 3.) - (6. * ns - 9.) * (n_sq - ns)
+	    / (ns * (n_sq - 2. * ns + 3.)) );
+  }
+
+  moments[0] = cm1;
+  if (!standardize)
+    { moments[1] = cm2; moments[2] = cm3; moments[3] = cm4; }
+  else if (cm2 > 0.) {
+    Real sd = std::sqrt(cm2);
+    moments[1] = sd;
+    moments[2] = cm3 / (cm2 * sd);
+    moments[3] = cm4 / (cm2 * cm2) - 3.;
+  }
+  else
+    { moments[1] = 0.; moments[2] = cm3; moments[3] = cm4; }
+}
+
 #ifdef HAVE_DAKOTA_SURROGATES
 //----------------------------------------------------------------
 
@@ -150,6 +150,28 @@ inline void average(const Sizet2DArray& N_2D, RealVector& N_1D)
     N_1D[i] = average(N_2D[i]);
 }
 
+
+/// one-pass update (Pebay, 2008) of the running mean sums[0] and the
+/// second through fourth central sums sums[1..3] with the next sample,
+/// given the number of samples already accumulated
+inline void accumulate_central_sums(Real sample, size_t num_prev, Real* sums)
+{
+  Real n1 = (Real)num_prev, n = n1 + 1.,
+    delta = sample - sums[0], delta_n = delta / n,
+    delta_n2 = delta_n * delta_n, term1 = delta * delta_n * n1;
+  sums[0] += delta_n;
+  sums[3] += term1 * delta_n2 * (n * n - 3. * n + 3.)
+    + 6. * delta_n2 * sums[1] - 4. * delta_n * sums[2];
+  sums[2] += term1 * delta_n * (n - 2.) - 3. * delta_n * sums[1];
+  sums[1] += term1;
+}
+
+/// convert running sums from accumulate_central_sums() over num_samp
+/// samples into the mean and unbiased central moments, or into the mean,
+/// standard deviation, skewness, and excess kurtosis if standardize
+void central_sums_to_moments(const Real* sums, size_t num_samp,
+			     bool standardize, Real* moments);
+
 } // namespace Dakota
 
 #endif // DAKOTA_STAT_UTIL_H
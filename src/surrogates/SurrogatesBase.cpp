@@ -9,9 +9,14 @@
 
 #include "SurrogatesBase.hpp"
 
+#include "util_common.hpp"
 #include "util_math_tools.hpp"
 #include "util_metrics.hpp"
 
+#include <atomic>
+#include <exception>
+#include <thread>
+
 namespace dakota {
 namespace surrogates {
 
@@ -73,14 +78,13 @@ std::shared_ptr<Surrogate> Surrogate::load(const std::string& infile,
 
 VectorXd Surrogate::evaluate_metrics(const StringArray& mnames,
                                      const MatrixXd& points,
-                                     const MatrixXd& ref_values) {
+                                     const MatrixXd& ref_values,
+                                     const int qoi) {
   const int num_metrics = mnames.size();
-  /* Assuming numQOI = 1 */
-  VectorXd surr_values(ref_values.size());
   VectorXd metrics(num_metrics);
 
+  const VectorXd surr_values = this->value(points, qoi);
   for (int m = 0; m < num_metrics; m++) {
-    surr_values = this->value(points);
     metrics(m) =
         util::compute_metric(surr_values, ref_values.col(0), mnames[m]);
   }
@@ -92,52 +96,78 @@ VectorXd Surrogate::cross_validate(const MatrixXd& samples,
                                    const StringArray& mnames,
                                    const int num_folds, const int seed) {
   const int num_metrics = mnames.size();
-  VectorXd cv_results = VectorXd::Zero(num_metrics);
-  VectorXd metrics_values(num_metrics);
-
   const int num_samples = samples.rows();
-  const int num_features = samples.cols();
   std::vector<VectorXi> cv_folds;
-  VectorXi fold_indices;
-  MatrixXd train_samples, train_response;
-  MatrixXd val_samples, val_response;
-
-  int num_train_samples, num_val_samples;
-  int samples_index, train_index;
 
   util::create_cv_folds(num_folds, num_samples, cv_folds, seed);
 
   // clone the surrogate's configuration so CV doesn't invalidate *this
   std::shared_ptr<Surrogate> cv_surrogate = this->clone();
-  // ParameterList cv_surrogate_options;
-  // cv_surrogate->get_options(cv_surrogate_options);
-  // int verbosity_level = cv_surrogate_options.get<int>("verbosity");
   int verbosity_level = configOptions.get<int>("verbosity");
 
-  for (int i = 0; i < num_folds; i++) {
+  /* metrics for each fold, averaged in fold order */
+  MatrixXd fold_metrics(num_metrics, num_folds);
+
+  VectorXd cv_predictions;
+  if (cv_surrogate->cross_validation_predictions(samples, response, cv_folds,
+                                                 cv_predictions)) {
     if (verbosity_level > 0) {
-      std::cout << "\nCross-validation fold " << i + 1 << "/" << num_folds
-                << "\n\n";
+      std::cout << "\nCross-validation for " << num_folds
+                << " folds in closed form\n\n";
+    }
+    VectorXd val_predictions, val_response;
+    for (int i = 0; i < num_folds; i++) {
+      const VectorXi& fold_indices = cv_folds[i];
+      const int num_val_samples = fold_indices.size();
+      val_predictions.resize(num_val_samples);
+      val_response.resize(num_val_samples);
+      for (int j = 0; j < num_val_samples; j++) {
+        val_predictions(j) = cv_predictions(fold_indices(j));
+        val_response(j) = response(fold_indices(j), 0);
+      }
+      for (int m = 0; m < num_metrics; m++)
+        fold_metrics(m, i) =
+            util::compute_metric(val_predictions, val_response, mnames[m]);
     }
+    return fold_metrics.rowwise().sum() / double(num_folds);
+  }
+
+  /* one clone per fold, so that folds may be built concurrently */
+  std::vector<std::shared_ptr<Surrogate>> fold_surrogates(num_folds);
+  fold_surrogates[0] = cv_surrogate;
+  for (int i = 1; i < num_folds; i++) fold_surrogates[i] = this->clone();
+
+  /* fold threads share the available threads with any threads started by
+     the fold builds, which are given an equal share */
+  int num_threads = 1, threads_per_fold = util::available_threads();
+  if (cv_surrogate->concurrent_builds()) {
+    num_threads = std::min(threads_per_fold, num_folds);
+    threads_per_fold = std::max(threads_per_fold / num_threads, 1);
+  }
+
+  auto run_fold = [&](const int i) {
+    const int num_features = samples.cols();
+    int samples_index;
+
     /* validation samples */
-    fold_indices = cv_folds[i];
-    num_val_samples = fold_indices.size();
-    val_samples.resize(num_val_samples, num_features);
-    val_response.resize(num_val_samples, 1);
+    const VectorXi& val_indices = cv_folds[i];
+    const int num_val_samples = val_indices.size();
+    MatrixXd val_samples(num_val_samples, num_features);
+    MatrixXd val_response(num_val_samples, 1);
     for (int j = 0; j < num_val_samples; j++) {
-      samples_index = fold_indices(j);
+      samples_index = val_indices(j);
       val_samples.row(j) = samples.row(samples_index);
       val_response(j, 0) = response(samples_index, 0);
     }
 
     /* training samples */
-    num_train_samples = num_samples - num_val_samples;
-    train_samples.resize(num_train_samples, num_features);
-    train_response.resize(num_train_samples, 1);
-    train_index = 0;
+    const int num_train_samples = num_samples - num_val_samples;
+    MatrixXd train_samples(num_train_samples, num_features);
+    MatrixXd train_response(num_train_samples, 1);
+    int train_index = 0;
     for (int k = 0; k < num_folds; k++) {
       if (k != i) {
-        fold_indices = cv_folds[k];
+        const VectorXi& fold_indices = cv_folds[k];
         for (int j = 0; j < fold_indices.size(); j++) {
           samples_index = fold_indices(j);
           train_samples.row(train_index) = samples.row(samples_index);
@@ -147,16 +177,60 @@ VectorXd Surrogate::cross_validate(const MatrixXd& samples,
       }
     }
 
-    cv_surrogate->build(train_samples, train_response);
-    metrics_values =
-        cv_surrogate->evaluate_metrics(mnames, val_samples, val_response);
-    cv_results += metrics_values;
+    fold_surrogates[i]->build(train_samples, train_response);
+    fold_metrics.col(i) =
+        fold_surrogates[i]->evaluate_metrics(mnames, val_samples, val_response);
+  };
+
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_folds; i++) {
+      if (verbosity_level > 0) {
+        std::cout << "\nCross-validation fold " << i + 1 << "/" << num_folds
+                  << "\n\n";
+      }
+      run_fold(i);
+    }
+  } else {
+    if (verbosity_level > 0) {
+      std::cout << "\nCross-validation for " << num_folds << " folds on "
+                << num_threads << " threads\n\n";
+    }
+    /* concurrent fold builds would interleave their console output */
+    for (auto& fold_surrogate : fold_surrogates)
+      fold_surrogate->configOptions.set("verbosity", 0);
+
+    /* folds are claimed dynamically; the first error is rethrown */
+    std::atomic<int> next_fold(0);
+    std::vector<std::exception_ptr> fold_errors(num_folds);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < num_threads; t++) {
+      workers.emplace_back([&]() {
+        util::ThreadBudget fold_budget(threads_per_fold);
+        for (int i = next_fold++; i < num_folds; i = next_fold++) {
+          try {
+            run_fold(i);
+          } catch (...) {
+            fold_errors[i] = std::current_exception();
+          }
+        }
+      });
+    }
+    for (std::thread& worker : workers) worker.join();
+    for (const std::exception_ptr& error : fold_errors)
+      if (error) std::rethrow_exception(error);
   }
 
-  cv_results /= double(num_folds);
-  return cv_results;
+  return fold_metrics.rowwise().sum() / double(num_folds);
 }
 
+bool Surrogate::cross_validation_predictions(
+    const MatrixXd& samples, const MatrixXd& response,
+    const std::vector<VectorXi>& cv_folds, VectorXd& cv_predictions) {
+  return false;
+}
+
+bool Surrogate::concurrent_builds() const { return true; }
+
 }  // namespace surrogates
 }  // namespace dakota
 
@@ -205,9 +205,10 @@ class Surrogate {
   // also demo load via ctor
   //  Surrogate(infile, binary)
 
-  /// Evalute metrics at specified points (within surrogates)
+  /// Evalute metrics at specified points (within surrogates), comparing
+  /// the predictions of QoI qoi with the first column of ref_values
   VectorXd evaluate_metrics(const StringArray& mnames, const MatrixXd& points,
-                            const MatrixXd& ref_values);
+                            const MatrixXd& ref_values, const int qoi = 0);
 
   /// Perform K-folds cross-validation (within surrogates)
   VectorXd cross_validate(const MatrixXd& samples, const MatrixXd& response,
@@ -238,6 +239,26 @@ class Surrogate {
   /// clone derived Surrogate class for use in cross-validation
   virtual std::shared_ptr<Surrogate> clone() const = 0;
 
+  /**
+   *  \brief Compute cross-validation predictions without a build per
+   *  fold, when the surrogate type and configuration admit a closed
+   *  form. The default implementation does not.
+   *  \param[in] samples Matrix of sample points - (num_samples by
+   *  num_features).
+   *  \param[in] response Matrix of responses - (num_samples by num_qoi).
+   *  \param[in] cv_folds Indices of the samples in each fold.
+   *  \param[out] cv_predictions Prediction at each sample by the surrogate
+   *  built without that sample's fold - (num_samples).
+   *  \returns Whether cv_predictions were computed.
+   */
+  virtual bool cross_validation_predictions(
+      const MatrixXd& samples, const MatrixXd& response,
+      const std::vector<VectorXi>& cv_folds, VectorXd& cv_predictions);
+
+  /// Whether distinct instances of this surrogate type may be built
+  /// concurrently on separate threads.
+  virtual bool concurrent_builds() const;
+
  private:
   /// Allow serializers access to private class data
   friend class boost::serialization::access;
@@ -9,49 +9,223 @@
 
 #include "SurrogatesGPKernels.hpp"
 
+#include "util_common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace dakota {
 namespace surrogates {
 
+namespace {
+
+/// Points per side of a tile of point pairs. Two tiles of points with up
+/// to ~50 features stay resident in L2 cache during assembly.
+const int tile_size = 64;
+
+/// Minimum number of tiles for which assembly is threaded.
+const int min_parallel_tiles = 4;
+
+/// A block of point pairs (rows of one point set by rows of another).
+struct Tile {
+  int row, col, num_rows, num_cols;
+};
+
+/// Partition num_a by num_b point pairs into tiles; if symmetric, only
+/// tiles on or above the block diagonal are formed.
+std::vector<Tile> make_tiles(const int num_a, const int num_b,
+                             const bool symmetric) {
+  std::vector<Tile> tiles;
+  for (int i = 0; i < num_a; i += tile_size) {
+    for (int j = symmetric ? i : 0; j < num_b; j += tile_size)
+      tiles.push_back({i, j, std::min(tile_size, num_a - i),
+                       std::min(tile_size, num_b - j)});
+  }
+  return tiles;
+}
+
+/// Apply tile_fn(tile_index) to all tiles, handing tiles out dynamically
+/// to a set of threads (within the calling thread's util::ThreadBudget)
+/// when there are enough of them.
+template <typename TileFn>
+void for_each_tile(const std::vector<Tile>& tiles, TileFn tile_fn) {
+  const int num_tiles = tiles.size();
+  const int num_threads = std::min(util::available_threads(), num_tiles);
+  if (num_tiles < min_parallel_tiles || num_threads <= 1) {
+    for (int t = 0; t < num_tiles; ++t) tile_fn(t);
+    return;
+  }
+
+  std::atomic<int> next_tile(0);
+  auto worker = [&]() {
+    for (int t = next_tile++; t < num_tiles; t = next_tile++) tile_fn(t);
+  };
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) threads.emplace_back(worker);
+  worker();
+  for (auto& thread : threads) thread.join();
+}
+
+/// Transpose the points and scale each component by exp(-theta_k), so
+/// that a scaled squared distance is the squared norm of a difference of
+/// (contiguous) columns.
+MatrixXd scale_points(const MatrixXd& pts, const VectorXd& theta_values) {
+  const VectorXd inv_length_scales =
+      (-theta_values.tail(pts.cols())).array().exp();
+  return inv_length_scales.asDiagonal() * pts.transpose();
+}
+
+/// Scaled squared distances for one tile of point pairs.
+void compute_tile_dists2(const MatrixXd& scaled_pts_a,
+                         const MatrixXd& scaled_pts_b, const Tile& tile,
+                         Eigen::ArrayXXd& dbar2) {
+  dbar2.resize(tile.num_rows, tile.num_cols);
+  for (int j = 0; j < tile.num_cols; ++j) {
+    for (int i = 0; i < tile.num_rows; ++i) {
+      dbar2(i, j) = (scaled_pts_a.col(tile.row + i) -
+                     scaled_pts_b.col(tile.col + j))
+                        .squaredNorm();
+    }
+  }
+}
+
+}  // namespace
+
 Kernel::Kernel() {}
 Kernel::~Kernel() {}
 
+void Kernel::compute_gram(const MatrixXd& pts, const VectorXd& theta_values,
+                          MatrixXd& gram, MatrixXd* deriv_factors) {
+  const int num_pts = pts.rows();
+  const double sig2 = exp(2.0 * theta_values(0));
+  const MatrixXd scaled_pts = scale_points(pts, theta_values);
+  gram.resize(num_pts, num_pts);
+  if (deriv_factors) deriv_factors->resize(num_pts, num_pts);
+
+  const std::vector<Tile> tiles = make_tiles(num_pts, num_pts, true);
+  for_each_tile(tiles, [&](const int t) {
+    const Tile& tile = tiles[t];
+    Eigen::ArrayXXd dbar2, values, factors;
+    compute_tile_dists2(scaled_pts, scaled_pts, tile, dbar2);
+    compute_tile(dbar2, sig2, values, deriv_factors ? &factors : nullptr);
+    gram.block(tile.row, tile.col, tile.num_rows, tile.num_cols) = values;
+    if (tile.row != tile.col)
+      gram.block(tile.col, tile.row, tile.num_cols, tile.num_rows) =
+          values.transpose();
+    if (deriv_factors) {
+      deriv_factors->block(tile.row, tile.col, tile.num_rows, tile.num_cols) =
+          factors;
+      if (tile.row != tile.col)
+        deriv_factors->block(tile.col, tile.row, tile.num_cols,
+                             tile.num_rows) = factors.transpose();
+    }
+  });
+}
+
+void Kernel::compute_gram(const MatrixXd& pts_a, const MatrixXd& pts_b,
+                          const VectorXd& theta_values, MatrixXd& gram) {
+  const double sig2 = exp(2.0 * theta_values(0));
+  const MatrixXd scaled_pts_a = scale_points(pts_a, theta_values);
+  const MatrixXd scaled_pts_b = scale_points(pts_b, theta_values);
+  gram.resize(pts_a.rows(), pts_b.rows());
+
+  const std::vector<Tile> tiles = make_tiles(pts_a.rows(), pts_b.rows(), false);
+  for_each_tile(tiles, [&](const int t) {
+    const Tile& tile = tiles[t];
+    Eigen::ArrayXXd dbar2, values;
+    compute_tile_dists2(scaled_pts_a, scaled_pts_b, tile, dbar2);
+    compute_tile(dbar2, sig2, values, nullptr);
+    gram.block(tile.row, tile.col, tile.num_rows, tile.num_cols) = values;
+  });
+}
+
+void Kernel::compute_gram_derivs_contraction(const MatrixXd& pts,
+                                             const MatrixXd& deriv_factors,
+                                             const MatrixXd& weights,
+                                             const VectorXd& theta_values,
+                                             VectorXd& contraction) {
+  const int num_pts = pts.rows();
+  const int num_variables = pts.cols();
+  const MatrixXd scaled_pts = scale_points(pts, theta_values);
+
+  /* Sums are accumulated per tile and reduced in tile order, so the
+   * result does not depend on the thread schedule. */
+  const std::vector<Tile> tiles = make_tiles(num_pts, num_pts, true);
+  MatrixXd tile_sums(num_variables, tiles.size());
+  for_each_tile(tiles, [&](const int t) {
+    const Tile& tile = tiles[t];
+    VectorXd sums = VectorXd::Zero(num_variables);
+    for (int j = 0; j < tile.num_cols; ++j) {
+      const int col = tile.col + j;
+      for (int i = 0; i < tile.num_rows; ++i) {
+        const int row = tile.row + i;
+        sums.array() += deriv_factors(row, col) * weights(row, col) *
+                        (scaled_pts.col(row) - scaled_pts.col(col))
+                            .array()
+                            .square();
+      }
+    }
+    /* account for the mirrored tile below the block diagonal */
+    if (tile.row != tile.col) sums *= 2.0;
+    tile_sums.col(t) = sums;
+  });
+  contraction = tile_sums.rowwise().sum();
+}
+
+void Kernel::compute_Dbar(const MatrixXd& pts_a, const MatrixXd& pts_b,
+                          const VectorXd& theta_values, bool take_sqrt) {
+  const MatrixXd scaled_pts_a = scale_points(pts_a, theta_values);
+  const MatrixXd scaled_pts_b = scale_points(pts_b, theta_values);
+  Dbar2.resize(pts_a.rows(), pts_b.rows());
+
+  const std::vector<Tile> tiles = make_tiles(pts_a.rows(), pts_b.rows(), false);
+  for_each_tile(tiles, [&](const int t) {
+    const Tile& tile = tiles[t];
+    Eigen::ArrayXXd dbar2;
+    compute_tile_dists2(scaled_pts_a, scaled_pts_b, tile, dbar2);
+    Dbar2.block(tile.row, tile.col, tile.num_rows, tile.num_cols) = dbar2;
+  });
+  if (take_sqrt) Dbar = Dbar2.cwiseSqrt();
+}
+
 SquaredExponentialKernel::SquaredExponentialKernel() {}
 SquaredExponentialKernel::~SquaredExponentialKernel() {}
 
-void SquaredExponentialKernel::compute_gram(const std::vector<MatrixXd>& dists2,
-                                            const VectorXd& theta_values,
-                                            MatrixXd& gram) {
-  compute_Dbar(dists2, theta_values, false);
-  gram = exp(2.0 * theta_values(0)) * (-0.5 * Dbar2.array()).exp();
-}
-
-void SquaredExponentialKernel::compute_gram_derivs(
-    const MatrixXd& gram, const std::vector<MatrixXd>& dists2,
-    const VectorXd& theta_values, std::vector<MatrixXd>& gram_derivs) {
-  const int num_derivs = dists2.size() + 1;
-  gram_derivs[0] = 2.0 * gram;
-  for (int k = 1; k < num_derivs; k++) {
-    gram_derivs[k] =
-        gram.cwiseProduct(dists2[k - 1]) * exp(-2.0 * theta_values(k));
-  }
+void SquaredExponentialKernel::compute_tile(
+    const Eigen::ArrayXXd& dbar2, const double sig2, Eigen::ArrayXXd& values,
+    Eigen::ArrayXXd* deriv_factors) const {
+  values = sig2 * (-0.5 * dbar2).exp();
+  if (deriv_factors) *deriv_factors = values;
+}
+
+void SquaredExponentialKernel::compute_values(
+    const Eigen::ArrayXd& dbar2, const double sig2, Eigen::ArrayXd& values,
+    Eigen::ArrayXd& deriv_factors) const {
+  values = sig2 * (-0.5 * dbar2).exp();
+  deriv_factors = values;
 }
 
 MatrixXd SquaredExponentialKernel::compute_first_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index) {
-  MatrixXd first_deriv_pred_gram = -pred_gram.cwiseProduct(mixed_dists[index]) *
-                                   exp(-2.0 * theta_values(index + 1));
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index) {
+  MatrixXd first_deriv_pred_gram =
+      -pred_gram.cwiseProduct(compute_cw_dists(pred_pts, build_pts, index)) *
+      exp(-2.0 * theta_values(index + 1));
   return first_deriv_pred_gram;
 }
 
 MatrixXd SquaredExponentialKernel::compute_second_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index_i, const int index_j) {
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index_i,
+    const int index_j) {
   double delta_ij = 0.0;
   if (index_i == index_j) delta_ij = 1.0;
+  const MatrixXd mixed_dists_i = compute_cw_dists(pred_pts, build_pts, index_i);
+  const MatrixXd mixed_dists_j = compute_cw_dists(pred_pts, build_pts, index_j);
   MatrixXd second_deriv_pred_gram =
       pred_gram.array() * exp(-2.0 * theta_values(index_i + 1)) *
-      ((mixed_dists[index_i].cwiseProduct(mixed_dists[index_j])).array() *
+      ((mixed_dists_i.cwiseProduct(mixed_dists_j)).array() *
            exp(-2.0 * theta_values(index_j + 1)) -
        delta_ij);
   return second_deriv_pred_gram;
@@ -60,50 +234,46 @@ MatrixXd SquaredExponentialKernel::compute_second_deriv_pred_gram(
 Matern32Kernel::Matern32Kernel() {}
 Matern32Kernel::~Matern32Kernel() {}
 
-void Matern32Kernel::compute_gram(const std::vector<MatrixXd>& dists2,
-                                  const VectorXd& theta_values,
-                                  MatrixXd& gram) {
-  compute_Dbar(dists2, theta_values);
-  Dbar *= sqrt3;
-  gram = exp(2.0 * theta_values(0)) *
-         (1.0 + Dbar.array()).cwiseProduct((-Dbar).array().exp());
+void Matern32Kernel::compute_tile(const Eigen::ArrayXXd& dbar2,
+                                  const double sig2, Eigen::ArrayXXd& values,
+                                  Eigen::ArrayXXd* deriv_factors) const {
+  const Eigen::ArrayXXd r = sqrt3 * dbar2.sqrt();
+  const Eigen::ArrayXXd exp_r = (-r).exp();
+  values = sig2 * (1.0 + r) * exp_r;
+  if (deriv_factors) *deriv_factors = sig2 * 3.0 * exp_r;
 }
 
-void Matern32Kernel::compute_gram_derivs(const MatrixXd& gram,
-                                         const std::vector<MatrixXd>& dists2,
-                                         const VectorXd& theta_values,
-                                         std::vector<MatrixXd>& gram_derivs) {
-  const int num_derivs = dists2.size() + 1;
-  const double sig2 = exp(2.0 * theta_values(0));
-  compute_Dbar(dists2, theta_values);
-  Dbar *= sqrt3;
-  gram_derivs[0] = 2.0 * gram;
-  for (int k = 1; k < num_derivs; k++) {
-    gram_derivs[k] = sig2 * 3.0 * exp(-2.0 * theta_values(k)) *
-                     (-Dbar).array().exp() * dists2[k - 1].array();
-  }
+void Matern32Kernel::compute_values(const Eigen::ArrayXd& dbar2,
+                                    const double sig2, Eigen::ArrayXd& values,
+                                    Eigen::ArrayXd& deriv_factors) const {
+  /* deriv_factors holds exp(-r) until the final scaling */
+  deriv_factors = (-sqrt3 * dbar2.sqrt()).exp();
+  values = sig2 * (1.0 + sqrt3 * dbar2.sqrt()) * deriv_factors;
+  deriv_factors *= sig2 * 3.0;
 }
 
 MatrixXd Matern32Kernel::compute_first_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index) {
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index) {
   silence_unused_args(pred_gram);
   const double sig2 = exp(2.0 * theta_values(0));
   MatrixXd first_deriv_pred_gram;
-  std::vector<MatrixXd> mixed_dists2 = compute_cw_dists_squared(mixed_dists);
-  compute_Dbar(mixed_dists2, theta_values);
-  first_deriv_pred_gram = -3.0 * sig2 *
-                          ((-sqrt3 * Dbar).array().exp())
-                              .matrix()
-                              .cwiseProduct(mixed_dists[index]) *
-                          exp(-2.0 * theta_values(index + 1));
+  compute_Dbar(pred_pts, build_pts, theta_values);
+  first_deriv_pred_gram =
+      -3.0 * sig2 *
+      ((-sqrt3 * Dbar).array().exp())
+          .matrix()
+          .cwiseProduct(compute_cw_dists(pred_pts, build_pts, index)) *
+      exp(-2.0 * theta_values(index + 1));
   return first_deriv_pred_gram;
 }
 
 MatrixXd Matern32Kernel::compute_second_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index_i, const int index_j) {
-  silence_unused_args(pred_gram, mixed_dists, theta_values, index_i, index_j);
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index_i,
+    const int index_j) {
+  silence_unused_args(pred_gram, pred_pts, build_pts, theta_values, index_i,
+                      index_j);
   MatrixXd second_deriv_pred_gram;
   throw("Error: Matern 3/2 kernel does not have a Hessian.");
   return second_deriv_pred_gram;
@@ -112,60 +282,53 @@ MatrixXd Matern32Kernel::compute_second_deriv_pred_gram(
 Matern52Kernel::Matern52Kernel() {}
 Matern52Kernel::~Matern52Kernel() {}
 
-void Matern52Kernel::compute_gram(const std::vector<MatrixXd>& dists2,
-                                  const VectorXd& theta_values,
-                                  MatrixXd& gram) {
-  compute_Dbar(dists2, theta_values);
-  Dbar *= sqrt5;
-  gram = exp(2.0 * theta_values(0)) *
-         (1.0 + Dbar.array() + Dbar.array().square() / 3.0)
-             .cwiseProduct((-Dbar).array().exp());
-}
-
-void Matern52Kernel::compute_gram_derivs(const MatrixXd& gram,
-                                         const std::vector<MatrixXd>& dists2,
-                                         const VectorXd& theta_values,
-                                         std::vector<MatrixXd>& gram_derivs) {
-  const int num_derivs = dists2.size() + 1;
-  const double sig2 = exp(2.0 * theta_values(0));
-  compute_Dbar(dists2, theta_values);
-  Dbar *= sqrt5;
-  gram_derivs[0] = 2.0 * gram;
-  for (int k = 1; k < num_derivs; k++) {
-    gram_derivs[k] = sig2 * 5.0 / 3.0 * exp(-2.0 * theta_values(k)) *
-                     (1.0 + Dbar.array()) * ((-Dbar).array()).exp() *
-                     dists2[k - 1].array();
-  }
+void Matern52Kernel::compute_tile(const Eigen::ArrayXXd& dbar2,
+                                  const double sig2, Eigen::ArrayXXd& values,
+                                  Eigen::ArrayXXd* deriv_factors) const {
+  const Eigen::ArrayXXd r = sqrt5 * dbar2.sqrt();
+  const Eigen::ArrayXXd exp_r = (-r).exp();
+  values = sig2 * (1.0 + r + r.square() / 3.0) * exp_r;
+  if (deriv_factors) *deriv_factors = sig2 * 5.0 / 3.0 * (1.0 + r) * exp_r;
+}
+
+void Matern52Kernel::compute_values(const Eigen::ArrayXd& dbar2,
+                                    const double sig2, Eigen::ArrayXd& values,
+                                    Eigen::ArrayXd& deriv_factors) const {
+  /* deriv_factors holds exp(-r) until the final scaling */
+  deriv_factors = (-sqrt5 * dbar2.sqrt()).exp();
+  values = sig2 * (1.0 + sqrt5 * dbar2.sqrt() + 5.0 / 3.0 * dbar2) *
+           deriv_factors;
+  deriv_factors *= sig2 * 5.0 / 3.0 * (1.0 + sqrt5 * dbar2.sqrt());
 }
 
 MatrixXd Matern52Kernel::compute_first_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index) {
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index) {
   silence_unused_args(pred_gram);
 
   const double sig2 = exp(2.0 * theta_values(0));
   MatrixXd first_deriv_pred_gram;
-  std::vector<MatrixXd> mixed_dists2 = compute_cw_dists_squared(mixed_dists);
-  compute_Dbar(mixed_dists2, theta_values);
-  first_deriv_pred_gram = -5.0 / 3.0 * sig2 *
-                          exp(-2.0 * theta_values(index + 1)) *
-                          ((-sqrt5 * Dbar).array().exp())
-                              .matrix()
-                              .cwiseProduct(sqrt5 * Dbar2 + Dbar)
-                              .cwiseProduct(mixed_dists[index])
-                              .cwiseQuotient(Dbar);
+  compute_Dbar(pred_pts, build_pts, theta_values);
+  first_deriv_pred_gram =
+      -5.0 / 3.0 * sig2 * exp(-2.0 * theta_values(index + 1)) *
+      ((-sqrt5 * Dbar).array().exp())
+          .matrix()
+          .cwiseProduct(sqrt5 * Dbar2 + Dbar)
+          .cwiseProduct(compute_cw_dists(pred_pts, build_pts, index))
+          .cwiseQuotient(Dbar);
   return first_deriv_pred_gram;
 }
 
 MatrixXd Matern52Kernel::compute_second_deriv_pred_gram(
-    const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-    const VectorXd& theta_values, const int index_i, const int index_j) {
+    const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+    const MatrixXd& build_pts, const VectorXd& theta_values, const int index_i,
+    const int index_j) {
   silence_unused_args(pred_gram);
 
   const double sig2 = exp(2.0 * theta_values(0));
   MatrixXd second_deriv_pred_gram;
-  std::vector<MatrixXd> mixed_dists2 = compute_cw_dists_squared(mixed_dists);
-  compute_Dbar(mixed_dists2, theta_values);
+  const MatrixXd mixed_dists_i = compute_cw_dists(pred_pts, build_pts, index_i);
+  compute_Dbar(pred_pts, build_pts, theta_values);
   if (index_i == index_j) {
     const double exp_ls = exp(-2.0 * theta_values(index_i + 1));
     second_deriv_pred_gram =
@@ -173,8 +336,8 @@ MatrixXd Matern52Kernel::compute_second_deriv_pred_gram(
         ((-sqrt5 * Dbar).array().exp())
             .matrix()
             .cwiseProduct(Dbar + sqrt5 * Dbar2 -
-                          5.0 *
-                              Dbar.cwiseProduct(exp_ls * mixed_dists2[index_i]))
+                          5.0 * Dbar.cwiseProduct(
+                                    exp_ls * mixed_dists_i.cwiseAbs2()))
             .cwiseQuotient(Dbar);
   } else {
     second_deriv_pred_gram =
@@ -182,37 +345,16 @@ MatrixXd Matern52Kernel::compute_second_deriv_pred_gram(
         exp(-2.0 * (theta_values(index_i + 1) + theta_values(index_j + 1))) *
         ((-sqrt5 * Dbar).array().exp())
             .matrix()
-            .cwiseProduct(mixed_dists[index_i])
-            .cwiseProduct(mixed_dists[index_j]);
+            .cwiseProduct(mixed_dists_i)
+            .cwiseProduct(compute_cw_dists(pred_pts, build_pts, index_j));
   }
   return second_deriv_pred_gram;
 }
 
-std::vector<MatrixXd> compute_cw_dists_squared(
-    const std::vector<MatrixXd>& cw_dists) {
-  const int num_variables = cw_dists.size();
-  std::vector<MatrixXd> D2(num_variables);
-  for (int k = 0; k < num_variables; k++) {
-    D2[k] = cw_dists[k].array().square();
-  }
-  return D2;
-}
-
-void Kernel::compute_Dbar(const std::vector<MatrixXd>& dists2,
-                          const VectorXd& theta_values, bool take_sqrt) {
-  const int num_rows = dists2[0].rows();
-  const int num_cols = dists2[0].cols();
-  const int num_variables = dists2.size();
-  Dbar2.resize(num_rows, num_cols);
-  Dbar.resize(num_rows, num_cols);
-
-  for (int k = 0; k < num_variables; k++) {
-    if (k == 0)
-      Dbar2 = dists2[k] * exp(-2.0 * theta_values(k + 1));
-    else
-      Dbar2 += dists2[k] * exp(-2.0 * theta_values(k + 1));
-  }
-  if (take_sqrt) Dbar = Dbar2.cwiseSqrt();
+MatrixXd compute_cw_dists(const MatrixXd& pts_a, const MatrixXd& pts_b,
+                          const int index) {
+  return pts_a.col(index).replicate(1, pts_b.rows()) -
+         pts_b.col(index).transpose().replicate(pts_a.rows(), 1);
 }
 
 std::shared_ptr<Kernel> kernel_factory(const std::string& kernel_type) {
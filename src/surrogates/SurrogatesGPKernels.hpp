@@ -18,6 +18,13 @@ namespace dakota {
 namespace surrogates {
 
 /// Kernel functions for the Gaussian Process surrogate.
+/**
+ *  Gram matrices and their hyperparameter derivatives are assembled from
+ *  the (scaled) points directly, in cache-sized tiles of point pairs
+ *  distributed over threads, so that no component-wise distance matrices
+ *  are stored. Derived kernels supply the elementwise kernel values as a
+ *  function of the hyperparameter-scaled squared distance.
+ */
 class Kernel {
  public:
   Kernel();
@@ -25,53 +32,67 @@ class Kernel {
   virtual ~Kernel();
 
   /**
-   *  \brief Compute a Gram matrix given a vector of squared distances and
-   *  kernel hyperparameters.
-   *  \param[in] dists2 Vector of squared distance matrices.
+   *  \brief Compute the Gram matrix for a set of points.
+   *  \param[in] pts Matrix of points - (num_points by num_features).
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[out] gram Gram matrix - (num_points by num_points).
+   *  \param[out] deriv_factors If non-null, the factors h such that the
+   *  derivative of the Gram matrix w.r.t. the length-scale hyperparameter
+   *  theta_k is h * (x_k - x'_k)^2 * exp(-2 theta_k).
+   */
+  void compute_gram(const MatrixXd& pts, const VectorXd& theta_values,
+                    MatrixXd& gram, MatrixXd* deriv_factors = nullptr);
+
+  /**
+   *  \brief Compute the rectangular Gram matrix between two sets of points.
+   *  \param[in] pts_a Matrix of points - (num_a by num_features).
+   *  \param[in] pts_b Matrix of points - (num_b by num_features).
    *  \param[in] theta_values Vector of hyperparameters.
-   *  \param[inout] gram Gram matrix.
-   *  \returns Gram matrix.
+   *  \param[out] gram Gram matrix - (num_a by num_b).
    */
-  virtual void compute_gram(const std::vector<MatrixXd>& dists2,
-                            const VectorXd& theta_values, MatrixXd& gram) = 0;
+  void compute_gram(const MatrixXd& pts_a, const MatrixXd& pts_b,
+                    const VectorXd& theta_values, MatrixXd& gram);
 
   /**
-   *  \brief Compute the derivatives of the Gram matrix with respect to the
-   *  kernel hyperparameters.
-   *  \param[in] gram Gram Matrix
-   *  \param[in] dists2 Vector of squared distance matrices.
+   *  \brief Contract the derivatives of the Gram matrix w.r.t. the
+   *  length-scale hyperparameters with a symmetric weight matrix.
+   *  \param[in] pts Matrix of points - (num_points by num_features).
+   *  \param[in] deriv_factors Derivative factors from compute_gram().
+   *  \param[in] weights Symmetric weight matrix - (num_points by num_points).
    *  \param[in] theta_values Vector of hyperparameters.
-   *  \param[inout] gram_derivs Vector of Gram matrix derivatives.
-   *  \returns Derivatives of the Gram matrix w.r.t. the hyperparameters.
+   *  \param[out] contraction Sum over all entries of each Gram matrix
+   *  derivative times the weights - (num_features).
    */
-  virtual void compute_gram_derivs(const MatrixXd& gram,
-                                   const std::vector<MatrixXd>& dists2,
-                                   const VectorXd& theta_values,
-                                   std::vector<MatrixXd>& gram_derivs) = 0;
+  void compute_gram_derivs_contraction(const MatrixXd& pts,
+                                       const MatrixXd& deriv_factors,
+                                       const MatrixXd& weights,
+                                       const VectorXd& theta_values,
+                                       VectorXd& contraction);
 
   /**
    *  \brief Compute the first derivatve of the prediction matrix for a given
    *  component.
    *  \param[in] pred_gram Prediction Gram matrix - Rectangular matrix
    *  of kernel evaluations between the surrogate and prediction points.
-   *  \param[in] mixed_dists Component-wise signed distances between the
-   *  prediction and build points.
+   *  \param[in] pred_pts Matrix of prediction points.
+   *  \param[in] build_pts Matrix of build points.
    *  \param[in] theta_values Vector of hyperparameters.
    *  \param[in] index Specifies the component of the derivative.
    *  \returns first_deriv_pred_gram First derivative of the prediction
    *  Gram matrix for a given component.
    */
   virtual MatrixXd compute_first_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index) = 0;
+      const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+      const MatrixXd& build_pts, const VectorXd& theta_values,
+      const int index) = 0;
 
   /**
    *  \brief Compute the second derivatve of the prediction matrix for a pair of
    *  components.
    *  \param[in] pred_gram Prediction Gram matrix - Rectangular
    *  matrix of kernel evaluations between the surrogate and prediction points.
-   *  \param[in] mixed_dists Component-wise signed distances between the
-   *  prediction and build points.
+   *  \param[in] pred_pts Matrix of prediction points.
+   *  \param[in] build_pts Matrix of build points.
    *  \param[in] theta_values Vector of hyperparameters.
    *  \param[in] index_i Specifies the first component of the second derivative.
    *  \param[in] index_j Specifies the second component of the second
@@ -80,18 +101,46 @@ class Kernel {
    *  prediction matrix for a pair of components.
    */
   virtual MatrixXd compute_second_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index_i, const int index_j) = 0;
+      const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+      const MatrixXd& build_pts, const VectorXd& theta_values,
+      const int index_i, const int index_j) = 0;
+
+  /**
+   *  \brief Evaluate the kernel elementwise for a vector of scaled squared
+   *  distances, without temporaries (for single-point prediction).
+   *  \param[in] dbar2 Vector of hyperparameter-scaled squared distances.
+   *  \param[in] sig2 Squared scale hyperparameter.
+   *  \param[out] values Vector of kernel values (sized as dbar2).
+   *  \param[out] deriv_factors Vector of length-scale derivative factors
+   *  (see compute_gram(); sized as dbar2).
+   */
+  virtual void compute_values(const Eigen::ArrayXd& dbar2, const double sig2,
+                              Eigen::ArrayXd& values,
+                              Eigen::ArrayXd& deriv_factors) const = 0;
 
  protected:
+  /**
+   *  \brief Evaluate the kernel elementwise for a tile of scaled squared
+   *  distances.
+   *  \param[in] dbar2 Tile of hyperparameter-scaled squared distances.
+   *  \param[in] sig2 Squared scale hyperparameter.
+   *  \param[out] values Tile of kernel values.
+   *  \param[out] deriv_factors If non-null, tile of length-scale
+   *  derivative factors (see compute_gram()).
+   */
+  virtual void compute_tile(const Eigen::ArrayXXd& dbar2, const double sig2,
+                            Eigen::ArrayXXd& values,
+                            Eigen::ArrayXXd* deriv_factors) const = 0;
+
   /**
    *  \brief Compute the ``Dbar'' matrices of scaled distances
-   *  \param[in] cw_dists2 Vector of component-wise squared distance matrices.
+   *  \param[in] pts_a Matrix of points - (num_a by num_features).
+   *  \param[in] pts_b Matrix of points - (num_b by num_features).
    *  \param[in] theta_values Vector of hyperparameters.
    *  \param[in] take_sqrt Flag for computing the square root of Dbar2.
    *  \returns Matrix of hyperparameter-scaled distances.
    */
-  void compute_Dbar(const std::vector<MatrixXd>& cw_dists2,
+  void compute_Dbar(const MatrixXd& pts_a, const MatrixXd& pts_b,
                     const VectorXd& theta_values, bool take_sqrt = true);
 
   MatrixXd Dbar, Dbar2;
@@ -104,22 +153,25 @@ class SquaredExponentialKernel : public Kernel {
 
   ~SquaredExponentialKernel();
 
-  void compute_gram(const std::vector<MatrixXd>& dists2,
-                    const VectorXd& theta_values, MatrixXd& gram) override;
+  MatrixXd compute_first_deriv_pred_gram(const MatrixXd& pred_gram,
+                                         const MatrixXd& pred_pts,
+                                         const MatrixXd& build_pts,
+                                         const VectorXd& theta_values,
+                                         const int index) override;
 
-  void compute_gram_derivs(const MatrixXd& gram,
-                           const std::vector<MatrixXd>& dists2,
-                           const VectorXd& theta_values,
-                           std::vector<MatrixXd>& gram_derivs) override;
+  MatrixXd compute_second_deriv_pred_gram(
+      const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+      const MatrixXd& build_pts, const VectorXd& theta_values,
+      const int index_i, const int index_j) override;
 
-  MatrixXd compute_first_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index) override;
+  void compute_values(const Eigen::ArrayXd& dbar2, const double sig2,
+                      Eigen::ArrayXd& values,
+                      Eigen::ArrayXd& deriv_factors) const override;
 
-  MatrixXd compute_second_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index_i,
-      const int index_j) override;
+ protected:
+  void compute_tile(const Eigen::ArrayXXd& dbar2, const double sig2,
+                    Eigen::ArrayXXd& values,
+                    Eigen::ArrayXXd* deriv_factors) const override;
 };
 
 /// Stationary kernel with C^1 smooth realizations.
@@ -129,22 +181,25 @@ class Matern32Kernel : public Kernel {
 
   ~Matern32Kernel();
 
-  void compute_gram(const std::vector<MatrixXd>& dists2,
-                    const VectorXd& theta_values, MatrixXd& gram) override;
+  MatrixXd compute_first_deriv_pred_gram(const MatrixXd& pred_gram,
+                                         const MatrixXd& pred_pts,
+                                         const MatrixXd& build_pts,
+                                         const VectorXd& theta_values,
+                                         const int index) override;
 
-  void compute_gram_derivs(const MatrixXd& gram,
-                           const std::vector<MatrixXd>& dists2,
-                           const VectorXd& theta_values,
-                           std::vector<MatrixXd>& gram_derivs) override;
+  MatrixXd compute_second_deriv_pred_gram(
+      const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+      const MatrixXd& build_pts, const VectorXd& theta_values,
+      const int index_i, const int index_j) override;
 
-  MatrixXd compute_first_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index) override;
+  void compute_values(const Eigen::ArrayXd& dbar2, const double sig2,
+                      Eigen::ArrayXd& values,
+                      Eigen::ArrayXd& deriv_factors) const override;
 
-  MatrixXd compute_second_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index_i,
-      const int index_j) override;
+ protected:
+  void compute_tile(const Eigen::ArrayXXd& dbar2, const double sig2,
+                    Eigen::ArrayXXd& values,
+                    Eigen::ArrayXXd* deriv_factors) const override;
 
  private:
   const double sqrt3 = sqrt(3.);
@@ -157,35 +212,40 @@ class Matern52Kernel : public Kernel {
 
   ~Matern52Kernel();
 
-  void compute_gram(const std::vector<MatrixXd>& dists2,
-                    const VectorXd& theta_values, MatrixXd& gram) override;
+  MatrixXd compute_first_deriv_pred_gram(const MatrixXd& pred_gram,
+                                         const MatrixXd& pred_pts,
+                                         const MatrixXd& build_pts,
+                                         const VectorXd& theta_values,
+                                         const int index) override;
 
-  void compute_gram_derivs(const MatrixXd& gram,
-                           const std::vector<MatrixXd>& dists2,
-                           const VectorXd& theta_values,
-                           std::vector<MatrixXd>& gram_derivs) override;
+  MatrixXd compute_second_deriv_pred_gram(
+      const MatrixXd& pred_gram, const MatrixXd& pred_pts,
+      const MatrixXd& build_pts, const VectorXd& theta_values,
+      const int index_i, const int index_j) override;
 
-  MatrixXd compute_first_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index) override;
+  void compute_values(const Eigen::ArrayXd& dbar2, const double sig2,
+                      Eigen::ArrayXd& values,
+                      Eigen::ArrayXd& deriv_factors) const override;
 
-  MatrixXd compute_second_deriv_pred_gram(
-      const MatrixXd& pred_gram, const std::vector<MatrixXd>& mixed_dists,
-      const VectorXd& theta_values, const int index_i,
-      const int index_j) override;
+ protected:
+  void compute_tile(const Eigen::ArrayXXd& dbar2, const double sig2,
+                    Eigen::ArrayXXd& values,
+                    Eigen::ArrayXXd* deriv_factors) const override;
 
  private:
   const double sqrt5 = sqrt(5.);
 };
 
 /**
- *  \brief Compute a vector of component-wise squared distances from a vector of
- *  component-wise signed distances.
- *  \param[in] dists2 Vector of signed component-wise distances.
- *  \returns Vector of squared distances.
+ *  \brief Compute the component-wise signed distances between two sets of
+ *  points for one component.
+ *  \param[in] pts_a Matrix of points - (num_a by num_features).
+ *  \param[in] pts_b Matrix of points - (num_b by num_features).
+ *  \param[in] index Component of the distances.
+ *  \returns Matrix of signed distances - (num_a by num_b).
  */
-std::vector<MatrixXd> compute_cw_dists_squared(
-    const std::vector<MatrixXd>& cw_dists);
+MatrixXd compute_cw_dists(const MatrixXd& pts_a, const MatrixXd& pts_b,
+                          const int index);
 
 /**
  *  \brief Creates a derived Kernel class.
@@ -0,0 +1,252 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "SurrogatesGPPredictor.hpp"
+
+#include "SurrogatesGaussianProcess.hpp"
+
+namespace dakota {
+namespace surrogates {
+
+namespace {
+
+/// x^n for a (small) nonnegative integer power n
+inline double int_pow(const double x, int n) {
+  double val = 1.0;
+  for (; n > 0; --n) val *= x;
+  return val;
+}
+
+}  // namespace
+
+GPPredictor::Workspace::Workspace(const GPPredictor& predictor)
+    : scaledPoint(predictor.numVariables),
+      lengthScaledPoint(predictor.numVariables),
+      dbar2(predictor.numSamples),
+      kernelValues(predictor.numSamples),
+      derivFactors(predictor.numSamples),
+      solution(predictor.numSamples),
+      trendBasis(predictor.numTrendTerms),
+      gradientTerms(predictor.numVariables) {}
+
+GPPredictor::GPPredictor(GaussianProcess& gp)
+    : numVariables(gp.numVariables),
+      numSamples(gp.numSamples),
+      numTrendTerms(gp.estimateTrend ? gp.numPolyTerms : 0),
+      numQOI(gp.numQOI),
+      responseScaleFactors(gp.responseScaleFactors),
+      responseOffsets(gp.responseOffsets),
+      kernel(gp.kernel) {
+  /* a GP built in QoI groups delegates to a predictor per group, which all
+     share the build points and hence the Workspace sizes */
+  if (gp.qoiGroups.size() > 0) {
+    for (auto& group_model : gp.groupModels)
+      groupPredictors.emplace_back(new GPPredictor(*group_model));
+    qoiGroups = gp.qoiGroups;
+    qoiGroupIndices = gp.qoiGroupIndices;
+    numSamples = groupPredictors[0]->numSamples;
+    numTrendTerms = groupPredictors[0]->numTrendTerms;
+    return;
+  }
+
+  /* a loaded GP factors its Gram matrix on first use */
+  gp.factor_gram();
+
+  scalerOffsets = gp.dataScaler.get_scaler_features_offsets().transpose();
+  const VectorXd& scale_factors =
+      gp.dataScaler.get_scaler_features_scale_factors();
+  scalerInvScaleFactors.resize(numVariables);
+  for (int j = 0; j < numVariables; ++j)
+    scalerInvScaleFactors(j) = (std::abs(scale_factors(j)) < near_zero)
+                                   ? 1.0
+                                   : 1.0 / scale_factors(j);
+
+  const VectorXd& theta_values = gp.thetaValues;
+  sig2 = exp(2.0 * theta_values(0));
+  invLengthScales =
+      (-theta_values.tail(numVariables)).array().exp().matrix().transpose();
+  lengthScaledBuildPoints =
+      gp.scaledBuildPoints * invLengthScales.asDiagonal();
+
+  priorVariance = sig2 + gp.fixedNuggetValue;
+  if (gp.estimateNugget) priorVariance += exp(2.0 * gp.estimatedNuggetValue);
+
+  /* the GP's solve with the shared factorization for all QoIs */
+  alpha = gp.GramResidualSolution;
+
+  gramFactorL = gp.CholFact.matrixL();
+  gramFactorD = gp.CholFact.vectorD();
+  gramFactorP = gp.CholFact.transpositionsP();
+
+  if (numTrendTerms > 0) {
+    trendBasisIndices = gp.polyRegression->get_basis_indices();
+    beta = gp.betaValues;
+    gramSolveBasis = gp.CholFact.solve(gp.basisMatrix);
+    trendGramInverse = (gp.basisMatrix.transpose() * gramSolveBasis)
+                           .ldlt()
+                           .solve(MatrixXd::Identity(numTrendTerms,
+                                                     numTrendTerms));
+  }
+}
+
+GPPredictor::~GPPredictor() {}
+
+double GPPredictor::value(const PointRef& point, Workspace& ws,
+                          const int qoi) const {
+  check_qoi(qoi);
+  if (!groupPredictors.empty())
+    return groupPredictors[qoiGroups(qoi)]->value(point, ws,
+                                                  qoiGroupIndices(qoi));
+  compute_kernel_values(point, ws);
+  return responseScaleFactors(qoi) * compute_mean(ws, qoi) +
+         responseOffsets(qoi);
+}
+
+double GPPredictor::variance(const PointRef& point, Workspace& ws,
+                             const int qoi) const {
+  check_qoi(qoi);
+  if (!groupPredictors.empty())
+    return groupPredictors[qoiGroups(qoi)]->variance(point, ws,
+                                                     qoiGroupIndices(qoi));
+  compute_kernel_values(point, ws);
+  return responseScaleFactors(qoi) * responseScaleFactors(qoi) *
+         compute_variance(ws);
+}
+
+void GPPredictor::value_and_variance(const PointRef& point, double& mean,
+                                     double& variance, Workspace& ws,
+                                     const int qoi) const {
+  check_qoi(qoi);
+  if (!groupPredictors.empty()) {
+    groupPredictors[qoiGroups(qoi)]->value_and_variance(
+        point, mean, variance, ws, qoiGroupIndices(qoi));
+    return;
+  }
+  compute_kernel_values(point, ws);
+  /* the mean uses the trend basis that the variance overwrites */
+  mean = responseScaleFactors(qoi) * compute_mean(ws, qoi) +
+         responseOffsets(qoi);
+  variance = responseScaleFactors(qoi) * responseScaleFactors(qoi) *
+             compute_variance(ws);
+}
+
+double GPPredictor::value_and_gradient(const PointRef& point,
+                                       GradientRef gradient, Workspace& ws,
+                                       const int qoi) const {
+  check_qoi(qoi);
+  if (!groupPredictors.empty())
+    return groupPredictors[qoiGroups(qoi)]->value_and_gradient(
+        point, gradient, ws, qoiGroupIndices(qoi));
+  compute_kernel_values(point, ws);
+  const double mean = compute_mean(ws, qoi);
+
+  /* d k_j / d x_i = -h_j (x_i - b_ji) exp(-2 theta_i), with the
+     derivative factors h_j, summed with the weights alpha_j */
+  ws.solution = ws.derivFactors.matrix().cwiseProduct(alpha.col(qoi));
+  const double weight_sum = ws.solution.sum();
+  ws.gradientTerms.noalias() =
+      ws.solution.transpose() * lengthScaledBuildPoints;
+  gradient = (ws.gradientTerms - weight_sum * ws.lengthScaledPoint)
+                 .cwiseProduct(invLengthScales);
+
+  for (int t = 0; t < numTrendTerms; ++t) {
+    for (int i = 0; i < numVariables; ++i) {
+      const int power_i = trendBasisIndices(i, t);
+      if (power_i == 0) continue;
+      double deriv = power_i * int_pow(ws.scaledPoint(i), power_i - 1);
+      for (int d = 0; d < numVariables; ++d)
+        if (d != i)
+          deriv *= int_pow(ws.scaledPoint(d), trendBasisIndices(d, t));
+      gradient(i) += beta(t, qoi) * deriv;
+    }
+  }
+
+  gradient *= responseScaleFactors(qoi);
+  return responseScaleFactors(qoi) * mean + responseOffsets(qoi);
+}
+
+void GPPredictor::value(const MatrixXd& points, VectorXd& values,
+                        Workspace& ws, const int qoi) const {
+  values.resize(points.rows());
+  for (int i = 0; i < points.rows(); ++i)
+    values(i) = value(points.row(i), ws, qoi);
+}
+
+void GPPredictor::variance(const MatrixXd& points, VectorXd& variances,
+                           Workspace& ws, const int qoi) const {
+  variances.resize(points.rows());
+  for (int i = 0; i < points.rows(); ++i)
+    variances(i) = variance(points.row(i), ws, qoi);
+}
+
+void GPPredictor::check_qoi(const int qoi) const {
+  if (qoi < 0 || qoi >= numQOI) {
+    throw(std::runtime_error(
+        "GPPredictor QoI index is out of range for the number of "
+        "responses."));
+  }
+}
+
+void GPPredictor::compute_kernel_values(const PointRef& point,
+                                        Workspace& ws) const {
+  if (point.size() != numVariables) {
+    throw(std::runtime_error(
+        "GPPredictor evaluation point has the wrong dimension."));
+  }
+  ws.scaledPoint = (point - scalerOffsets).cwiseProduct(scalerInvScaleFactors);
+  ws.lengthScaledPoint = ws.scaledPoint.cwiseProduct(invLengthScales);
+
+  /* squared distances to the build points, one component at a time so that
+     the inner loops run contiguously over the build points */
+  ws.dbar2.setZero();
+  for (int d = 0; d < numVariables; ++d)
+    ws.dbar2 +=
+        (lengthScaledBuildPoints.col(d).array() - ws.lengthScaledPoint(d))
+            .square();
+  kernel->compute_values(ws.dbar2, sig2, ws.kernelValues, ws.derivFactors);
+
+  for (int t = 0; t < numTrendTerms; ++t) {
+    double term = 1.0;
+    for (int d = 0; d < numVariables; ++d)
+      term *= int_pow(ws.scaledPoint(d), trendBasisIndices(d, t));
+    ws.trendBasis(t) = term;
+  }
+}
+
+double GPPredictor::compute_mean(Workspace& ws, const int qoi) const {
+  double mean = ws.kernelValues.matrix().dot(alpha.col(qoi));
+  if (numTrendTerms > 0) mean += ws.trendBasis.dot(beta.col(qoi));
+  return mean;
+}
+
+double GPPredictor::compute_variance(Workspace& ws) const {
+  /* k^T K^{-1} k = || D^{-1/2} L^{-1} P k ||^2 */
+  ws.solution = ws.kernelValues.matrix();
+  ws.solution = gramFactorP * ws.solution;
+  gramFactorL.triangularView<Eigen::UnitLower>().solveInPlace(ws.solution);
+  double variance =
+      priorVariance -
+      (ws.solution.array().square() / gramFactorD.array()).sum();
+
+  if (numTrendTerms > 0) {
+    /* r^T (B^T K^{-1} B)^{-1} r with r = p - B^T K^{-1} k */
+    ws.trendBasis.noalias() -=
+        gramSolveBasis.transpose() * ws.kernelValues.matrix();
+    for (int i = 0; i < numTrendTerms; ++i)
+      for (int j = 0; j < numTrendTerms; ++j)
+        variance +=
+            ws.trendBasis(i) * trendGramInverse(i, j) * ws.trendBasis(j);
+  }
+
+  if (variance < 0.0 || std::isnan(variance)) variance = 0.0;
+  return variance;
+}
+
+}  // namespace surrogates
+}  // namespace dakota
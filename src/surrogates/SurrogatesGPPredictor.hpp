@@ -0,0 +1,237 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#ifndef DAKOTA_SURROGATES_GP_PREDICTOR_HPP
+#define DAKOTA_SURROGATES_GP_PREDICTOR_HPP
+
+#include "SurrogatesGPKernels.hpp"
+#include "util_data_types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace dakota {
+namespace surrogates {
+
+class GaussianProcess;
+
+/**
+ *  \brief The GPPredictor evaluates the mean, variance and gradient of a
+ *  built GaussianProcess at single points with precomputed data.
+ *
+ *  Construction precomputes the weights alpha = K^{-1}(y - B beta), the
+ *  LDL^T factors of the Gram matrix K, the length-scaled build points and,
+ *  for a GP with a trend, K^{-1}B and (B^T K^{-1} B)^{-1}. A prediction is
+ *  then a single pass over the build points, with all scratch storage in a
+ *  caller-owned Workspace, so that no memory is allocated per prediction.
+ *
+ *  The predictor does not refer back to the GaussianProcess and is not
+ *  updated if the GP is rebuilt. Its member functions are const, so one
+ *  predictor may be shared by threads that each own a Workspace.
+ *  Predictions agree with GaussianProcess::value(), variance() and
+ *  gradient(); gradients are likewise w.r.t. the scaled variables.
+ *  For a GP with several QoIs the weights of all QoIs come from one
+ *  solve with the shared factorization, and a GP built in QoI groups
+ *  gets a predictor per group; a Workspace serves all QoIs.
+ */
+class GPPredictor {
+ public:
+  /// Point to evaluate, possibly a row of a column-major matrix.
+  using PointRef = Eigen::Ref<const RowVectorXd, 0, Eigen::InnerStride<>>;
+  /// Output gradient, possibly a row of a column-major matrix.
+  using GradientRef = Eigen::Ref<RowVectorXd, 0, Eigen::InnerStride<>>;
+
+  /// Scratch storage for the predictions of one thread.
+  class Workspace {
+   public:
+    /// Allocate storage sized for the predictor.
+    explicit Workspace(const GPPredictor& predictor);
+
+   private:
+    friend class GPPredictor;
+
+    /// Prediction point after data scaling.
+    RowVectorXd scaledPoint;
+    /// Prediction point after data and length-scale scaling.
+    RowVectorXd lengthScaledPoint;
+    /// Scaled squared distances to the build points.
+    Eigen::ArrayXd dbar2;
+    /// Kernel values between the point and the build points.
+    Eigen::ArrayXd kernelValues;
+    /// Length-scale derivative factors of the kernel values.
+    Eigen::ArrayXd derivFactors;
+    /// Solve with the Gram factors, or gradient weights.
+    VectorXd solution;
+    /// Trend basis at the point, then the variance's trend residual.
+    VectorXd trendBasis;
+    /// Build point components weighted for the gradient.
+    RowVectorXd gradientTerms;
+  };
+
+  /**
+   *  \brief Precompute the prediction data of a built GaussianProcess.
+   *  \param[in] gp Built GaussianProcess (its Gram matrix is factored if a
+   *  loaded GP has not done so yet).
+   */
+  explicit GPPredictor(GaussianProcess& gp);
+
+  /// Default destructor
+  ~GPPredictor();
+
+  /**
+   *  \brief Evaluate the mean of the GP at a point.
+   *  \param[in] point Prediction point - (num_features).
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   *  \returns Mean of the GP at the point.
+   */
+  double value(const PointRef& point, Workspace& ws, const int qoi = 0) const;
+
+  /**
+   *  \brief Evaluate the variance of the GP at a point.
+   *  \param[in] point Prediction point - (num_features).
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   *  \returns Variance of the GP at the point.
+   */
+  double variance(const PointRef& point, Workspace& ws,
+                  const int qoi = 0) const;
+
+  /**
+   *  \brief Evaluate the mean and variance of the GP at a point, sharing
+   *  the kernel evaluations.
+   *  \param[in] point Prediction point - (num_features).
+   *  \param[out] mean Mean of the GP at the point.
+   *  \param[out] variance Variance of the GP at the point.
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   */
+  void value_and_variance(const PointRef& point, double& mean,
+                          double& variance, Workspace& ws,
+                          const int qoi = 0) const;
+
+  /**
+   *  \brief Evaluate the mean of the GP and its gradient w.r.t. the scaled
+   *  variables at a point.
+   *  \param[in] point Prediction point - (num_features).
+   *  \param[out] gradient Gradient of the mean - (num_features).
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   *  \returns Mean of the GP at the point.
+   */
+  double value_and_gradient(const PointRef& point, GradientRef gradient,
+                            Workspace& ws, const int qoi = 0) const;
+
+  /**
+   *  \brief Evaluate the mean of the GP at a (small) batch of points.
+   *  \param[in] points Prediction points - (num_points by num_features).
+   *  \param[out] values Means of the GP - (num_points).
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   */
+  void value(const MatrixXd& points, VectorXd& values, Workspace& ws,
+             const int qoi = 0) const;
+
+  /**
+   *  \brief Evaluate the variance of the GP at a (small) batch of points.
+   *  \param[in] points Prediction points - (num_points by num_features).
+   *  \param[out] variances Variances of the GP - (num_points).
+   *  \param[in] ws Workspace for this thread.
+   *  \param[in] qoi Index of response/QoI.
+   */
+  void variance(const MatrixXd& points, VectorXd& variances, Workspace& ws,
+                const int qoi = 0) const;
+
+  /// Get the number of features/variables.
+  int num_variables() const;
+
+  /// Get the number of responses/QoIs.
+  int num_qoi() const;
+
+ private:
+  /// Scale the point and evaluate the kernel against the build points.
+  void compute_kernel_values(const PointRef& point, Workspace& ws) const;
+
+  /// Check a QoI index against the number of QoIs.
+  void check_qoi(const int qoi) const;
+
+  /// Mean of a QoI, unscaled, from the kernel values and trend basis in ws.
+  double compute_mean(Workspace& ws, const int qoi) const;
+
+  /// Variance, unscaled, from the kernel values and trend basis in ws.
+  double compute_variance(Workspace& ws) const;
+
+  /// Number of features/variables.
+  int numVariables;
+  /// Number of build points.
+  int numSamples;
+  /// Number of terms in the polynomial trend (0 without a trend).
+  int numTrendTerms;
+  /// Number of responses/QoIs.
+  int numQOI;
+
+  /// Offsets of the data scaler.
+  RowVectorXd scalerOffsets;
+  /// Inverse scale factors of the data scaler (1 for zero scale factors).
+  RowVectorXd scalerInvScaleFactors;
+  /// Inverse length scales exp(-theta_k).
+  RowVectorXd invLengthScales;
+  /// Build points after data and length-scale scaling - (numSamples by
+  /// numVariables).
+  MatrixXd lengthScaledBuildPoints;
+
+  /// Squared scale hyperparameter.
+  double sig2;
+  /// Prior variance at a point, i.e. sig2 plus the nugget.
+  double priorVariance;
+  /// Weights K^{-1}(y - B beta) of the kernel values in the mean - (numSamples
+  /// by numQOI).
+  MatrixXd alpha;
+
+  /// Unit lower triangular factor L of P K P^T = L D L^T.
+  MatrixXd gramFactorL;
+  /// Diagonal factor D of the Gram matrix.
+  VectorXd gramFactorD;
+  /// Pivoting P of the Gram matrix factorization.
+  Eigen::Transpositions<Eigen::Dynamic> gramFactorP;
+
+  /// Powers of each variable in each trend term - (numVariables by
+  /// numTrendTerms).
+  MatrixXi trendBasisIndices;
+  /// Trend coefficients - (numTrendTerms by numQOI).
+  MatrixXd beta;
+  /// K^{-1} B for the trend basis matrix B - (numSamples by numTrendTerms).
+  MatrixXd gramSolveBasis;
+  /// Inverse of B^T K^{-1} B.
+  MatrixXd trendGramInverse;
+
+  /// Scale factor of each response.
+  VectorXd responseScaleFactors;
+  /// Offset of each response.
+  VectorXd responseOffsets;
+
+  /// Kernel of the GP.
+  std::shared_ptr<const Kernel> kernel;
+
+  /// Predictors of the QoI groups of a GP built in groups, otherwise empty.
+  std::vector<std::unique_ptr<GPPredictor>> groupPredictors;
+  /// Group of each QoI.
+  VectorXi qoiGroups;
+  /// Index of each QoI within its group's predictor.
+  VectorXi qoiGroupIndices;
+};
+
+inline int GPPredictor::num_variables() const { return numVariables; }
+
+inline int GPPredictor::num_qoi() const { return numQOI; }
+
+}  // namespace surrogates
+}  // namespace dakota
+
+#endif  // include guard
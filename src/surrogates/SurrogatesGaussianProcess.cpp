@@ -73,21 +73,37 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
           "Invalid verbosity int for GaussianProcess surrogate"));
   }
 
-  /* Standardize the response */
+  numQOI = response.cols();
+  numSamples = samples.rows();
+  numVariables = samples.cols();
+
+  /* QoIs with dissimilar responses get their own hyperparameters */
+  const int num_groups =
+      std::min(configOptions.get<int>("num QoI groups"), numQOI);
+  qoiGroups.resize(0);
+  qoiGroupIndices.resize(0);
+  groupModels.clear();
+  if (num_groups > 1) {
+    build_qoi_groups(samples, response, num_groups);
+    return;
+  }
+
+  /* Standardize the response, each QoI separately */
   bool standardize_response = configOptions.get<bool>("standardize response");
   if (standardize_response) {
     auto responseScaler = util::scaler_factory(
         util::DataScaler::scaler_type("standardization"), response);
     targetValues = responseScaler->scale_samples(response);
-    responseOffset = responseScaler->get_scaler_features_offsets()(0);
-    responseScaleFactor =
-        responseScaler->get_scaler_features_scale_factors()(0);
-  } else
+    responseOffsets = responseScaler->get_scaler_features_offsets();
+    responseScaleFactors = responseScaler->get_scaler_features_scale_factors();
+  } else {
     targetValues = response;
+    responseOffsets = VectorXd::Zero(numQOI);
+    responseScaleFactors = VectorXd::Ones(numQOI);
+  }
+  responseOffset = responseOffsets(0);
+  responseScaleFactor = responseScaleFactors(0);
 
-  numQOI = response.cols();
-  numSamples = samples.rows();
-  numVariables = samples.cols();
   eyeMatrix = MatrixXd::Identity(numSamples, numSamples);
   hasBestCholFact = false;
   kernel_type = configOptions.get<std::string>("kernel type");
@@ -101,23 +117,23 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   setup_hyperparameter_bounds(sigma_bounds, length_scale_bounds, nugget_bounds);
   const int num_restarts = configOptions.get<int>("num restarts");
 
-  /* Scale the data and compute build squared distances */
+  /* Scale the data; Gram matrices are assembled from the scaled points */
   dataScaler =
       *(util::scaler_factory(util::DataScaler::scaler_type(
                                  configOptions.get<std::string>("scaler name")),
                              samples));
   dataScaler.scale_samples(samples, scaledBuildPoints);
-  compute_build_dists();
 
   MatrixXd beta_bounds;
   estimateTrend = configOptions.sublist("Trend").get<bool>("estimate trend");
   if (estimateTrend) {
     polyRegression = std::make_shared<PolynomialRegression>(
-        scaledBuildPoints, targetValues,
+        scaledBuildPoints, targetValues.col(0),
         configOptions.sublist("Trend").sublist("Options"));
     numPolyTerms = polyRegression->get_num_terms();
     polyRegression->compute_basis_matrix(scaledBuildPoints, basisMatrix);
-    beta_bounds = MatrixXd::Ones(numPolyTerms, 2);
+    /* each QoI has its own trend coefficients */
+    beta_bounds = MatrixXd::Ones(numPolyTerms * numQOI, 2);
     beta_bounds.col(0) *= -betaBound;
     beta_bounds.col(1) *= betaBound;
   }
@@ -125,14 +141,11 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   /* size of thetaValues for squared exponential kernel and one QoI */
   thetaValues.resize(numVariables + 1);
   bestThetaValues.resize(numVariables + 1);
-  betaValues.resize(numPolyTerms);
-  bestBetaValues.resize(numPolyTerms);
-  /* set the size of the GramMatrix and its derivatives */
+  betaValues.resize(numPolyTerms, numQOI);
+  bestBetaValues.resize(numPolyTerms, numQOI);
+  /* set the size of the GramMatrix and its derivative factors */
   GramMatrix.resize(numSamples, numSamples);
-  GramMatrixDerivs.resize(numVariables + 1);
-  for (int k = 0; k < numVariables + 1; k++) {
-    GramMatrixDerivs[k].resize(numSamples, numSamples);
-  }
+  GramDerivFactors.resize(numSamples, numSamples);
 
   /* DTS: if the nugget is being estimated, should the fixed value be set to
    * zero? */
@@ -167,7 +180,8 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   setup_default_optimization_params(gp_mle_rol_params);
 
   auto gp_objective = std::make_shared<GP_Objective>(*this);
-  int dim = numVariables + 1 + numPolyTerms + numNuggetTerms;
+  const int num_beta = numPolyTerms * numQOI;
+  int dim = numVariables + 1 + num_beta + numNuggetTerms;
 
   // Define algorithm
   ROL::Ptr<ROL::Step<double>> step =
@@ -199,7 +213,7 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
     }
   }
   if (estimateTrend) {
-    for (int i = 0; i < numPolyTerms; i++) {
+    for (int i = 0; i < num_beta; i++) {
       (*lo_ptr)[numVariables + 1 + i] = beta_bounds(i, 0);
       (*hi_ptr)[numVariables + 1 + i] = beta_bounds(i, 1);
     }
@@ -233,12 +247,11 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
       (thetaValues)(j) = (*x_ptr)[j];
     }
     if (estimateTrend) {
-      for (int j = 0; j < numPolyTerms; ++j) {
-        betaValues(j) = (*x_ptr)[numVariables + 1 + j];
-      }
+      betaValues = Eigen::Map<const MatrixXd>(
+          x_ptr->data() + numVariables + 1, numPolyTerms, numQOI);
     }
     if (estimateNugget) {
-      estimatedNuggetValue = (*x_ptr)[numVariables + 1 + numPolyTerms];
+      estimatedNuggetValue = (*x_ptr)[numVariables + 1 + num_beta];
     }
     /* get the final objective function value and gradient */
     negative_marginal_log_likelihood(true, true, final_obj_value,
@@ -253,7 +266,8 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
     objectiveGradientHistory.row(i) = final_obj_gradient;
     thetaHistory.row(i).head(numVariables + 1) = thetaValues;
     if (estimateTrend)
-      thetaHistory.row(i).segment(numVariables + 1, numPolyTerms) = betaValues;
+      thetaHistory.row(i).segment(numVariables + 1, num_beta) =
+          Eigen::Map<const RowVectorXd>(betaValues.data(), num_beta);
     if (estimateNugget) thetaHistory.row(i).tail(1)(0) = estimatedNuggetValue;
     algo.reset();
   }
@@ -262,14 +276,13 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   if (estimateTrend) {
     betaValues = bestBetaValues;
     /* set the betas in the polynomialRegression class */
-    polyRegression->set_polynomial_coeffs(bestBetaValues);
+    polyRegression->set_polynomial_coeffs(bestBetaValues.col(0));
   }
   if (estimateNugget) estimatedNuggetValue = bestEstimatedNuggetValue;
 
   /* compute and store best Cholesky factorization */
-  compute_gram(cwiseDists2, true, false, GramMatrix);
-  CholFact.compute(GramMatrix);
-  hasBestCholFact = true;
+  hasBestCholFact = false;
+  factor_gram();
 
   /* Useful info for debugging */
   /*
@@ -284,9 +297,10 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
 }
 
 VectorXd GaussianProcess::value(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (qoiGroups.size() > 0)
+    return groupModels[qoiGroups(qoi)]->value(eval_points,
+                                              qoiGroupIndices(qoi));
 
   if (eval_points.cols() != numVariables) {
     throw(
@@ -299,37 +313,28 @@ VectorXd GaussianProcess::value(const MatrixXd& eval_points, const int qoi) {
 
   /* scale the eval_points (prediction points) */
   const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
-  compute_pred_dists(scaled_pred_points);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  factor_gram();
 
-  VectorXd resid, chol_solve_resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-
-  if (estimateTrend) {
-    resid = targetValues - basisMatrix * betaValues;
-  } else
-    resid = targetValues;
+  kernel->compute_gram(scaled_pred_points, scaledBuildPoints, thetaValues,
+                       predMixedGramMatrix);
 
-  chol_solve_resid = CholFact.solve(resid);
-  approx_values = predMixedGramMatrix * chol_solve_resid;
+  approx_values = predMixedGramMatrix * GramResidualSolution.col(qoi);
 
   if (estimateTrend) {
     polyRegression->compute_basis_matrix(scaled_pred_points, predBasisMatrix);
-    MatrixXd z = CholFact.solve(basisMatrix);
-    approx_values += predBasisMatrix * betaValues;
+    approx_values += predBasisMatrix * betaValues.col(qoi);
   }
-  return responseScaleFactor * approx_values.array() + responseOffset;
+  return responseScaleFactors(qoi) * approx_values.array() +
+         responseOffsets(qoi);
 }
 
 MatrixXd GaussianProcess::gradient(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (qoiGroups.size() > 0)
+    return groupModels[qoiGroups(qoi)]->gradient(eval_points,
+                                                 qoiGroupIndices(qoi));
 
   if (eval_points.cols() != numVariables) {
     throw(std::runtime_error(
@@ -345,39 +350,35 @@ MatrixXd GaussianProcess::gradient(const MatrixXd& eval_points, const int qoi) {
   /* scale the eval_points (prediction points) */
   MatrixXd scaled_pred_pts;
   dataScaler.scale_samples(eval_points, scaled_pred_pts);
-  compute_pred_dists(scaled_pred_pts);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  factor_gram();
 
-  MatrixXd chol_solve_resid, first_deriv_pred_gram, grad_components, resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-  resid = targetValues;
-  if (estimateTrend) resid -= basisMatrix * betaValues;
-  chol_solve_resid = CholFact.solve(resid);
+  MatrixXd first_deriv_pred_gram, grad_components;
+  kernel->compute_gram(scaled_pred_pts, scaledBuildPoints, thetaValues,
+                       predMixedGramMatrix);
+  const auto chol_solve_resid = GramResidualSolution.col(qoi);
 
   for (int i = 0; i < numVariables; i++) {
     first_deriv_pred_gram = kernel->compute_first_deriv_pred_gram(
-        predMixedGramMatrix, cwiseMixedDists, thetaValues, i);
+        predMixedGramMatrix, scaled_pred_pts, scaledBuildPoints, thetaValues,
+        i);
     grad_components = first_deriv_pred_gram * chol_solve_resid;
     gradient.col(i) = grad_components.col(0);
   }
 
   /* extra terms for GP with a trend */
-  if (estimateTrend) {
-    MatrixXd poly_grad_pred_pts;
-    gradient += polyRegression->gradient(scaled_pred_pts);
-  }
-  return responseScaleFactor * gradient;
+  if (estimateTrend)
+    gradient += polyRegression->gradient_with_coeffs(scaled_pred_pts,
+                                                     betaValues.col(qoi));
+  return responseScaleFactors(qoi) * gradient;
 }
 
 MatrixXd GaussianProcess::hessian(const MatrixXd& eval_point, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (qoiGroups.size() > 0)
+    return groupModels[qoiGroups(qoi)]->hessian(eval_point,
+                                                qoiGroupIndices(qoi));
 
   if (eval_point.rows() != 1) {
     throw(std::runtime_error(
@@ -390,43 +391,39 @@ MatrixXd GaussianProcess::hessian(const MatrixXd& eval_point, const int qoi) {
   /* scale the eval_point (prediction points) */
   MatrixXd scaled_pred_point;
   dataScaler.scale_samples(eval_point, scaled_pred_point);
-  compute_pred_dists(scaled_pred_point);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  factor_gram();
 
-  MatrixXd chol_solve_resid, second_deriv_pred_gram, resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-  resid = targetValues;
-  if (estimateTrend) resid -= basisMatrix * betaValues;
-  chol_solve_resid = CholFact.solve(resid);
+  MatrixXd second_deriv_pred_gram;
+  kernel->compute_gram(scaled_pred_point, scaledBuildPoints, thetaValues,
+                       predMixedGramMatrix);
+  const auto chol_solve_resid = GramResidualSolution.col(qoi);
 
   /* Hessian */
   for (int i = 0; i < numVariables; i++) {
     for (int j = i; j < numVariables; j++) {
       second_deriv_pred_gram = kernel->compute_second_deriv_pred_gram(
-          predMixedGramMatrix, cwiseMixedDists, thetaValues, i, j);
+          predMixedGramMatrix, scaled_pred_point, scaledBuildPoints,
+          thetaValues, i, j);
       hessian(i, j) = (second_deriv_pred_gram * chol_solve_resid)(0, 0);
       if (i != j) hessian(j, i) = hessian(i, j);
     }
   }
 
-  if (estimateTrend) {
-    MatrixXd poly_hessian_pred_pt;
-    hessian += polyRegression->hessian(scaled_pred_point);
-  }
+  if (estimateTrend)
+    hessian += polyRegression->hessian_with_coeffs(scaled_pred_point,
+                                                   betaValues.col(qoi));
 
-  return responseScaleFactor * hessian;
+  return responseScaleFactors(qoi) * hessian;
 }
 
 MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
                                      const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (qoiGroups.size() > 0)
+    return groupModels[qoiGroups(qoi)]->covariance(eval_points,
+                                                   qoiGroupIndices(qoi));
 
   if (eval_points.cols() != numVariables) {
     throw(std::runtime_error(
@@ -438,30 +435,20 @@ MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
   predCovariance.resize(num_eval_points, num_eval_points);
   /* scale the eval_points (prediction points) */
   const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
-  compute_pred_dists(scaled_pred_points);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  factor_gram();
 
-  VectorXd resid;
   MatrixXd chol_solve_pred_mat;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-
-  if (estimateTrend)
-    resid = targetValues - basisMatrix * betaValues;
-  else
-    resid = targetValues;
+  kernel->compute_gram(scaled_pred_points, scaledBuildPoints, thetaValues,
+                       predMixedGramMatrix);
 
   chol_solve_pred_mat = CholFact.solve(predMixedGramMatrix.transpose());
 
-  compute_gram(cwisePredDists2, true, false, predGramMatrix);
+  compute_gram(scaled_pred_points, true, false, predGramMatrix);
   predCovariance = predGramMatrix - predMixedGramMatrix * chol_solve_pred_mat;
 
   if (estimateTrend) {
-    MatrixXd chol_solve_resid = CholFact.solve(resid);
     polyRegression->compute_basis_matrix(scaled_pred_points, predBasisMatrix);
     MatrixXd z = CholFact.solve(basisMatrix);
     MatrixXd R_mat = predBasisMatrix - predMixedGramMatrix * (z);
@@ -469,15 +456,12 @@ MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
     predCovariance += R_mat * (h_mat.ldlt().solve(R_mat.transpose()));
   }
 
-  return pow(responseScaleFactor, 2) * predCovariance;
+  /* the covariance only depends on the QoI through its scaling */
+  return pow(responseScaleFactors(qoi), 2) * predCovariance;
 }
 
 VectorXd GaussianProcess::variance(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
-
-  VectorXd variance = covariance(eval_points).diagonal();
+  VectorXd variance = covariance(eval_points, qoi).diagonal();
 
   for (int i = 0; i < variance.size(); i++) {
     if (variance(i) < 0.0 || std::isnan(variance(i))) {
@@ -493,34 +477,46 @@ void GaussianProcess::negative_marginal_log_likelihood(bool compute_grad,
                                                        double& obj_value,
                                                        VectorXd& obj_gradient) {
   if (form_gram) {
-    compute_gram(cwiseDists2, true, true, GramMatrix);
+    compute_gram(scaledBuildPoints, true, true, GramMatrix);
     CholFact.compute(GramMatrix);
     trendTargetResidual = targetValues;
     if (estimateTrend) trendTargetResidual -= basisMatrix * betaValues;
     GramResidualSolution = CholFact.solve(trendTargetResidual);
   }
 
+  /* the QoIs are independent given the shared hyperparameters, so their
+     likelihoods add and share the log-determinant of the Gram matrix */
   obj_value =
-      0.5 * log(CholFact.vectorD().array()).matrix().sum() +
-      0.5 * (trendTargetResidual.transpose() * GramResidualSolution)(0, 0) +
-      static_cast<double>(numSamples) / 2.0 * log(2.0 * PI);
+      0.5 * numQOI * log(CholFact.vectorD().array()).matrix().sum() +
+      0.5 * trendTargetResidual.cwiseProduct(GramResidualSolution).sum() +
+      static_cast<double>(numQOI * numSamples) / 2.0 * log(2.0 * PI);
 
   if (compute_grad) {
     /* DTS: This Cholesky solve is much more expensive than the factorization!
      */
     MatrixXd Q =
         -0.5 * (GramResidualSolution * GramResidualSolution.transpose() -
-                CholFact.solve(eyeMatrix));
+                numQOI * CholFact.solve(eyeMatrix));
     if (estimateTrend) {
-      obj_gradient.segment(numVariables + 1, numPolyTerms) =
+      Eigen::Map<MatrixXd>(obj_gradient.data() + numVariables + 1,
+                           numPolyTerms, numQOI) =
           -basisMatrix.transpose() * GramResidualSolution;
     }
 
-    for (int k = 0; k < numVariables + 1; k++)
-      obj_gradient(k) = (GramMatrixDerivs[k].cwiseProduct(Q)).sum();
+    /* The sigma derivative of the Gram matrix is twice the kernel part of
+     * GramMatrix (i.e. without the nugget). */
+    double nugget = fixedNuggetValue;
+    if (estimateNugget) nugget += exp(2.0 * estimatedNuggetValue);
+    obj_gradient(0) =
+        2.0 * ((GramMatrix.cwiseProduct(Q)).sum() - nugget * Q.trace());
+
+    VectorXd length_scale_grad;
+    kernel->compute_gram_derivs_contraction(
+        scaledBuildPoints, GramDerivFactors, Q, thetaValues, length_scale_grad);
+    obj_gradient.segment(1, numVariables) = length_scale_grad;
 
     if (estimateNugget) {
-      obj_gradient(numVariables + 1 + numPolyTerms) =
+      obj_gradient(numVariables + 1 + numPolyTerms * numQOI) =
           2.0 * exp(2.0 * estimatedNuggetValue) * Q.trace();
     }
   }
@@ -559,7 +555,7 @@ void GaussianProcess::setup_hyperparameter_bounds(VectorXd& sigma_bounds,
 }
 
 int GaussianProcess::get_num_opt_variables() {
-  return numVariables + 1 + numPolyTerms + numNuggetTerms;
+  return numVariables + 1 + numPolyTerms * numQOI + numNuggetTerms;
 }
 
 int GaussianProcess::get_num_variables() const { return numVariables; }
@@ -568,12 +564,162 @@ void GaussianProcess::set_opt_params(const std::vector<double>& opt_params) {
   for (int i = 0; i < numVariables + 1; i++) thetaValues(i) = opt_params[i];
 
   if (estimateTrend) {
-    for (int i = 0; i < numPolyTerms; i++)
-      betaValues(i) = opt_params[numVariables + 1 + i];
+    betaValues = Eigen::Map<const MatrixXd>(
+        opt_params.data() + numVariables + 1, numPolyTerms, numQOI);
   }
 
   if (estimateNugget)
-    estimatedNuggetValue = opt_params[numVariables + 1 + numPolyTerms];
+    estimatedNuggetValue =
+        opt_params[numVariables + 1 + numPolyTerms * numQOI];
+}
+
+bool GaussianProcess::cross_validation_predictions(
+    const MatrixXd& samples, const MatrixXd& response,
+    const std::vector<VectorXi>& cv_folds, VectorXd& cv_predictions) {
+  configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
+  if (!configOptions.get<bool>("fixed hyperparameter cross validation"))
+    return false;
+  /* QoI groups each have their own Gram matrix */
+  if (configOptions.get<int>("num QoI groups") > 1 && response.cols() > 1)
+    return false;
+
+  build(samples, response);
+
+  MatrixXd resid = targetValues;
+  if (estimateTrend) resid -= basisMatrix * betaValues;
+  const MatrixXd gram_inv = CholFact.solve(eyeMatrix);
+  const VectorXd gram_inv_resid = gram_inv * resid.col(0);
+
+  cv_predictions.resize(numSamples);
+  for (const VectorXi& fold_indices : cv_folds) {
+    const int num_val_samples = fold_indices.size();
+    MatrixXd gram_inv_fold(num_val_samples, num_val_samples);
+    VectorXd gram_inv_resid_fold(num_val_samples);
+    for (int i = 0; i < num_val_samples; ++i) {
+      gram_inv_resid_fold(i) = gram_inv_resid(fold_indices(i));
+      for (int j = 0; j < num_val_samples; ++j)
+        gram_inv_fold(i, j) = gram_inv(fold_indices(i), fold_indices(j));
+    }
+    const VectorXd fold_resid = gram_inv_fold.ldlt().solve(gram_inv_resid_fold);
+    for (int i = 0; i < num_val_samples; ++i)
+      cv_predictions(fold_indices(i)) =
+          response(fold_indices(i), 0) - responseScaleFactors(0) * fold_resid(i);
+  }
+  return true;
+}
+
+void GaussianProcess::build_qoi_groups(const MatrixXd& samples,
+                                       const MatrixXd& response,
+                                       const int num_groups) {
+  /* Centered, unit-norm response columns: the distance between two QoIs
+   * measures how differently they vary over the build samples. */
+  MatrixXd features = response.rowwise() - response.colwise().mean();
+  for (int q = 0; q < numQOI; ++q) {
+    const double norm = features.col(q).norm();
+    if (norm > near_zero) features.col(q) /= norm;
+  }
+
+  /* k-means, initialized deterministically with farthest-point centers */
+  MatrixXd centroids(numSamples, num_groups);
+  centroids.col(0) = features.col(0);
+  VectorXd min_dist2 = (features.colwise() - centroids.col(0))
+                           .colwise()
+                           .squaredNorm()
+                           .transpose();
+  for (int g = 1; g < num_groups; ++g) {
+    int farthest;
+    min_dist2.maxCoeff(&farthest);
+    centroids.col(g) = features.col(farthest);
+    min_dist2 = min_dist2.cwiseMin((features.colwise() - centroids.col(g))
+                                       .colwise()
+                                       .squaredNorm()
+                                       .transpose());
+  }
+
+  const int max_iterations = 100;
+  VectorXi assignment = VectorXi::Constant(numQOI, -1);
+  for (int iter = 0; iter < max_iterations; ++iter) {
+    bool changed = false;
+    for (int q = 0; q < numQOI; ++q) {
+      int nearest;
+      (centroids.colwise() - features.col(q))
+          .colwise()
+          .squaredNorm()
+          .minCoeff(&nearest);
+      if (nearest != assignment(q)) {
+        assignment(q) = nearest;
+        changed = true;
+      }
+    }
+    if (!changed) break;
+    for (int g = 0; g < num_groups; ++g) {
+      VectorXd sum = VectorXd::Zero(numSamples);
+      int count = 0;
+      for (int q = 0; q < numQOI; ++q)
+        if (assignment(q) == g) {
+          sum += features.col(q);
+          ++count;
+        }
+      if (count > 0) centroids.col(g) = sum / count;
+    }
+  }
+
+  /* Build a GP for each nonempty group; the groups are numbered in order of
+   * their first QoI. */
+  ParameterList group_options = configOptions;
+  group_options.set("num QoI groups", 1);
+  qoiGroups = VectorXi::Constant(numQOI, -1);
+  qoiGroupIndices.resize(numQOI);
+  responseOffsets.resize(numQOI);
+  responseScaleFactors.resize(numQOI);
+  for (int q = 0; q < numQOI; ++q) {
+    if (qoiGroups(q) >= 0) continue;
+    std::vector<int> members;
+    for (int r = q; r < numQOI; ++r)
+      if (assignment(r) == assignment(q)) members.push_back(r);
+    MatrixXd group_response(numSamples, members.size());
+    for (size_t k = 0; k < members.size(); ++k) {
+      group_response.col(k) = response.col(members[k]);
+      qoiGroups(members[k]) = groupModels.size();
+      qoiGroupIndices(members[k]) = k;
+    }
+    auto group_model = std::make_shared<GaussianProcess>(
+        samples, group_response, group_options);
+    for (size_t k = 0; k < members.size(); ++k) {
+      responseOffsets(members[k]) = group_model->responseOffsets(k);
+      responseScaleFactors(members[k]) = group_model->responseScaleFactors(k);
+    }
+    groupModels.push_back(group_model);
+  }
+  responseOffset = responseOffsets(0);
+  responseScaleFactor = responseScaleFactors(0);
+
+  /* This GP only delegates to the groups' GPs. */
+  dataScaler = groupModels[0]->dataScaler;
+  kernel_type = groupModels[0]->kernel_type;
+  kernel = groupModels[0]->kernel;
+  fixedNuggetValue = groupModels[0]->fixedNuggetValue;
+  estimateNugget = false;
+  estimatedNuggetValue = 0.0;
+  estimateTrend = false;
+  polyRegression.reset();
+  hasBestCholFact = false;
+  thetaValues.resize(0);
+  betaValues.resize(0, 0);
+  scaledBuildPoints.resize(0, 0);
+  targetValues.resize(0, 0);
+  basisMatrix.resize(0, 0);
+  objectiveFunctionHistory.resize(0);
+  objectiveGradientHistory.resize(0, 0);
+  thetaHistory.resize(0, 0);
+}
+
+void GaussianProcess::check_qoi(const int qoi) const {
+  if (qoi < 0 || qoi >= numQOI) {
+    throw(std::runtime_error(
+        "Gaussian Process QoI index is out of range for the number of "
+        "responses the GP was built with."));
+  }
 }
 
 void GaussianProcess::default_options() {
@@ -627,6 +773,15 @@ void GaussianProcess::default_options() {
                            "random seed for initial iterate generation");
   defaultConfigOptions.set("standardize response", true,
                            "Make the response zero mean and unit variance");
+  defaultConfigOptions.set(
+      "num QoI groups", 1,
+      "number of groups of similar QoIs with their own hyperparameters");
+  defaultConfigOptions.set(
+      "joint QoI build", false,
+      "build one GP for all of an approximation interface's QoIs");
+  defaultConfigOptions.set(
+      "fixed hyperparameter cross validation", false,
+      "cross-validate with the full build's hyperparameters (no refits)");
   /* Verbosity levels
      2 - maximum level: print out config options and building notification
      1 - minimum level: print out building notification
@@ -658,55 +813,11 @@ void GaussianProcess::default_options() {
       "verbosity", 1, "console output verbosity");
 }
 
-void GaussianProcess::compute_build_dists() {
-  cwiseDists2.resize(numVariables);
-
-  for (int k = 0; k < numVariables; k++) {
-    cwiseDists2[k].resize(numSamples, numSamples);
-    for (int i = 0; i < numSamples; i++) {
-      for (int j = i; j < numSamples; j++) {
-        cwiseDists2[k](i, j) =
-            pow(scaledBuildPoints(i, k) - scaledBuildPoints(j, k), 2);
-        if (i != j) cwiseDists2[k](j, i) = cwiseDists2[k](i, j);
-      }
-    }
-  }
-}
-
-void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts) {
-  const int num_pred_pts = scaled_pred_pts.rows();
-  cwiseMixedDists.resize(numVariables);
-  cwiseMixedDists2.resize(numVariables);
-  cwisePredDists2.resize(numVariables);
-
-  for (int k = 0; k < numVariables; k++) {
-    cwiseMixedDists[k].resize(num_pred_pts, numSamples);
-    cwisePredDists2[k].resize(num_pred_pts, num_pred_pts);
-    for (int i = 0; i < num_pred_pts; i++) {
-      for (int j = 0; j < numSamples; j++) {
-        cwiseMixedDists[k](i, j) =
-            scaled_pred_pts(i, k) - scaledBuildPoints(j, k);
-      }
-      for (int j = i; j < num_pred_pts; j++) {
-        cwisePredDists2[k](i, j) =
-            pow(scaled_pred_pts(i, k) - scaled_pred_pts(j, k), 2);
-        if (i != j) cwisePredDists2[k](j, i) = cwisePredDists2[k](i, j);
-      }
-    }
-    cwiseMixedDists2[k] = cwiseMixedDists[k].array().square();
-  }
-}
-
-void GaussianProcess::compute_gram(const std::vector<MatrixXd>& dists2,
+void GaussianProcess::compute_gram(const MatrixXd& scaled_pts,
                                    bool add_nugget, bool compute_derivs,
                                    MatrixXd& gram) {
-  const int num_rows = dists2[0].rows();
-  const int num_cols = dists2[0].cols();
-  gram.resize(num_rows, num_cols);
-  kernel->compute_gram(dists2, thetaValues, gram);
-
-  if (compute_derivs)
-    kernel->compute_gram_derivs(gram, dists2, thetaValues, GramMatrixDerivs);
+  kernel->compute_gram(scaled_pts, thetaValues, gram,
+                       compute_derivs ? &GramDerivFactors : nullptr);
 
   if (add_nugget) {
     /* add in the fixed nugget */
@@ -717,12 +828,25 @@ void GaussianProcess::compute_gram(const std::vector<MatrixXd>& dists2,
   }
 }
 
+/* The Gram matrix is shared by all QoIs, so it is formed and factored
+ * once, and the solves for all QoIs are done together. */
+void GaussianProcess::factor_gram() {
+  if (hasBestCholFact) return;
+  compute_gram(scaledBuildPoints, true, false, GramMatrix);
+  CholFact.compute(GramMatrix);
+  trendTargetResidual = targetValues;
+  if (estimateTrend) trendTargetResidual -= basisMatrix * betaValues;
+  GramResidualSolution = CholFact.solve(trendTargetResidual);
+  hasBestCholFact = true;
+}
+
 void GaussianProcess::generate_initial_guesses(
     const VectorXd& sigma_bounds, const MatrixXd& length_scale_bounds,
     const VectorXd& nugget_bounds, const int num_restarts, const int seed,
     MatrixXd& initial_guesses) {
   initial_guesses = util::create_uniform_random_double_matrix(
-      num_restarts, numVariables + 1 + numPolyTerms + numNuggetTerms, seed,
+      num_restarts, numVariables + 1 + numPolyTerms * numQOI + numNuggetTerms,
+      seed,
       true, -1.0, 1.0);
 
   double mean, span;
@@ -751,13 +875,13 @@ void GaussianProcess::generate_initial_guesses(
   if (estimateTrend) {
     int index_offset = numVariables + 1;
     for (int i = 0; i < num_restarts; ++i) {
-      for (int j = 0; j < numPolyTerms; j++) {
+      for (int j = 0; j < numPolyTerms * numQOI; j++) {
         initial_guesses(i, index_offset + j) = 0.0;
       }
     }
   }
   if (estimateNugget) {
-    int index_offset = numVariables + 1 + numPolyTerms;
+    int index_offset = numVariables + 1 + numPolyTerms * numQOI;
     span = 0.5 * (log(nugget_bounds(1)) - log(nugget_bounds(0)));
     mean = 0.5 * (log(nugget_bounds(1)) + log(nugget_bounds(0)));
     for (int i = 0; i < num_restarts; ++i) {
@@ -18,6 +18,7 @@
 
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
 
 namespace dakota {
 
@@ -45,6 +46,13 @@ namespace surrogates {
  *  Once the GP is constructed its mean, variance,
  *  and covariance matrix can be computed for a set of prediction
  *  points. Gradients and Hessians are available.
+ *
+ *  Multiple QoIs (response columns) share the kernel hyperparameters
+ *  and nugget, so that one factorization of the Gram matrix serves all
+ *  of them as multiple right-hand sides; each QoI has its own response
+ *  scaling and trend coefficients. With "num QoI groups" greater than
+ *  one, the QoIs are clustered by the similarity of their standardized
+ *  responses and each group is built as a separate GP.
  */
 class GaussianProcess : public Surrogate {
  public:
@@ -74,9 +82,8 @@ class GaussianProcess : public Surrogate {
    *        and builds the GP.
    * \param[in] samples Matrix of data for surrogate construction - (num_samples
    * by num_features) \param[in] response Vector of targets for surrogate
-   * construction - (num_samples by num_qoi = 1; only 1 response is supported
-   * currently). \param[in] param_list List that overrides entries in
-   * defaultConfigOptions
+   * construction - (num_samples by num_qoi). \param[in] param_list List that
+   * overrides entries in defaultConfigOptions
    */
   GaussianProcess(const MatrixXd& samples, const MatrixXd& response,
                   const ParameterList& param_list);
@@ -87,8 +94,8 @@ class GaussianProcess : public Surrogate {
    *
    * \param[in] samples Matrix of data for surrogate construction - (num_samples
    * by num_features) \param[in] response Vector of targets for surrogate
-   * construction - (num_samples by num_qoi = 1; only 1 response is supported
-   * currently). \param[in] param_list_yaml_filename A ParameterList file
+   * construction - (num_samples by num_qoi). \param[in]
+   * param_list_yaml_filename A ParameterList file
    * (relative to the location of the Dakota input file) that overrides entries
    * in defaultConfigOptions.
    */
@@ -103,9 +110,8 @@ class GaussianProcess : public Surrogate {
   /**
    * \brief Build the GP using specified build data.
    * \param[in] eval_points Matrix of data for surrogate construction -
-   * (num_samples by num_features) \param[in] response Vector of targets for
-   * surrogate construction - (num_samples by num_qoi = 1; only 1 response is
-   * supported currently).
+   * (num_samples by num_features) \param[in] response Matrix of targets for
+   * surrogate construction - (num_samples by num_qoi).
    */
   void build(const MatrixXd& eval_points, const MatrixXd& response) override;
 
@@ -243,6 +249,13 @@ class GaussianProcess : public Surrogate {
    */
   int get_num_variables() const;
 
+  /**
+   *  \brief Get the QoI groups sharing hyperparameters.
+   *  \returns Group index of each QoI, or an empty vector when all QoIs
+   *  share one set of hyperparameters.
+   */
+  const VectorXi& get_qoi_groups() const { return qoiGroups; }
+
   /**
    *  \brief Get the history of objective function values from MLE with
    * restarts. \returns objectiveFunctionHistory Vector of final objective
@@ -281,28 +294,38 @@ class GaussianProcess : public Surrogate {
   /// Construct and populate the defaultConfigOptions.
   void default_options() override;
 
-  /// Compute squared distances between the scaled build points.
-  void compute_build_dists();
-
   /**
-   *  \brief Compute distances between build and prediction points. This
-   * includes build-prediction and prediction-prediction distance matrices.
-   *  \param[in] scaled_pred_pts Matrix of scaled prediction points.
+   *  \brief When "fixed hyperparameter cross validation" is enabled,
+   *  build once on all samples and compute each fold's predictions from
+   *  the inverse Gram matrix: the residual on a held-out fold F is
+   *  (K^{-1}_FF)^{-1} (K^{-1} r)_F. Hyperparameters, trend coefficients
+   *  and scaling are those of the full build rather than refit per fold.
    */
-  void compute_pred_dists(const MatrixXd& scaled_pred_pts);
+  bool cross_validation_predictions(const MatrixXd& samples,
+                                    const MatrixXd& response,
+                                    const std::vector<VectorXi>& cv_folds,
+                                    VectorXd& cv_predictions) override;
 
   /**
-   *  \brief Compute a Gram matrix given a vector of squared distances and
-   *  optionally compute its derivatives and/or adds nugget terms.
-   *  \param[in] dists2 Vector of squared distance matrices.
+   *  \brief Compute the Gram matrix for a set of scaled points and
+   *  optionally compute its derivative factors and/or adds nugget terms.
+   *  \param[in] scaled_pts Matrix of scaled points.
    *  \param[in] add_nugget Bool for whether or add nugget terms.
    *  \param[in] compute_derivs Bool for whether or not to compute the
-   *  derivatives of the Gram matrix.
+   *  derivative factors of the Gram matrix (GramDerivFactors).
    *  \param[out] gram Gram matrix.
    */
-  void compute_gram(const std::vector<MatrixXd>& dists2, bool add_nugget,
+  void compute_gram(const MatrixXd& scaled_pts, bool add_nugget,
                     bool compute_derivs, MatrixXd& gram);
 
+  /**
+   *  \brief Factor the Gram matrix of the build points for the current
+   *  hyperparameters and solve it for the residuals of all QoIs
+   *  (GramResidualSolution), unless already done since the last build
+   *  or load (hasBestCholFact).
+   */
+  void factor_gram();
+
   /**
    *  \brief Randomly generate initial guesses for the optimization routine.
    *  \param[in] sigma_bounds Bounds for the scaling hyperparameter (sigma).
@@ -318,6 +341,23 @@ class GaussianProcess : public Surrogate {
                                 const int num_restarts, const int seed,
                                 MatrixXd& initial_guesses);
 
+  /**
+   *  \brief Cluster the QoIs and build a GP for each group.
+   *  \param[in] samples Matrix of build samples - (num_samples by
+   *  num_features).
+   *  \param[in] response Matrix of build responses - (num_samples by
+   *  num_qoi).
+   *  \param[in] num_groups Number of groups (at most num_qoi).
+   */
+  void build_qoi_groups(const MatrixXd& samples, const MatrixXd& response,
+                        const int num_groups);
+
+  /**
+   *  \brief Check a QoI index against the number of QoIs.
+   *  \param[in] qoi Index of response/QoI.
+   */
+  void check_qoi(const int qoi) const;
+
   /**
    *  \brief Set the default optimization parameters for ROL for GP
    * hyperparameter estimation. \param[in] rol_params RCP to a
@@ -347,8 +387,8 @@ class GaussianProcess : public Surrogate {
   /// Vector of log-space hyperparameters.
   VectorXd thetaValues;
 
-  /// Vector of polynomial coefficients.
-  VectorXd betaValues;
+  /// Polynomial coefficients - (num_poly_terms by num_qoi).
+  MatrixXd betaValues;
 
   /// Estimated nugget term.
   double estimatedNuggetValue;
@@ -356,8 +396,8 @@ class GaussianProcess : public Surrogate {
   /// Vector of best hyperparameters from MLE with restarts.
   VectorXd bestThetaValues;
 
-  /// Vector of best polynomial coefficients from MLE with restarts.
-  VectorXd bestBetaValues;
+  /// Best polynomial coefficients from MLE with restarts.
+  MatrixXd bestBetaValues;
 
   /// Best estimated nugget value from MLE with restarts.
   double bestEstimatedNuggetValue;
@@ -375,25 +415,15 @@ class GaussianProcess : public Surrogate {
   MatrixXd GramMatrix;
 
   /// Difference between target values and trend predictions.
-  VectorXd trendTargetResidual;
+  MatrixXd trendTargetResidual;
 
-  /// Cholesky solve for Gram matrix with trendTargetResidual rhs.
-  VectorXd GramResidualSolution;
+  /// Cholesky solve for Gram matrix with trendTargetResidual rhs; after
+  /// factor_gram(), that of the best hyperparameters for all QoIs.
+  MatrixXd GramResidualSolution;
 
-  /// Derivatives of the Gram matrix w.r.t. the hyperparameters.
-  std::vector<MatrixXd> GramMatrixDerivs;
-
-  /// Squared component-wise distances between points in the surrogate dataset.
-  std::vector<MatrixXd> cwiseDists2;
-
-  /// Component-wise distances between prediction and build points.
-  std::vector<MatrixXd> cwiseMixedDists;
-
-  /// Squared component-wise distances between prediction and build points.
-  std::vector<MatrixXd> cwiseMixedDists2;
-
-  /// Component-wise distances between prediction points.
-  std::vector<MatrixXd> cwisePredDists2;
+  /// Factors common to the Gram matrix derivatives w.r.t. the
+  /// length-scale hyperparameters (see Kernel::compute_gram()).
+  MatrixXd GramDerivFactors;
 
   /// Pivoted Cholesky factorization.
   Eigen::LDLT<MatrixXd> CholFact;
@@ -416,6 +446,22 @@ class GaussianProcess : public Surrogate {
   /// PolynomialRegression for trend function.
   std::shared_ptr<PolynomialRegression> polyRegression;
 
+  /// Response offset of each QoI (responseOffset is that of QoI 0).
+  VectorXd responseOffsets;
+
+  /// Response scale factor of each QoI (responseScaleFactor is that of
+  /// QoI 0).
+  VectorXd responseScaleFactors;
+
+  /// Group of each QoI when built in groups, otherwise empty.
+  VectorXi qoiGroups;
+
+  /// Index of each QoI within its group's GP.
+  VectorXi qoiGroupIndices;
+
+  /// GPs of the QoI groups.
+  std::vector<std::shared_ptr<GaussianProcess>> groupModels;
+
   /// Kernel type
   std::string kernel_type;
 
@@ -449,6 +495,8 @@ class GaussianProcess : public Surrogate {
  private:
   /// Allow serializers access to private class data
   friend class boost::serialization::access;
+  /// Allow the fast predictor access to the factored GP data
+  friend class GPPredictor;
   /// Serializer for save/load
   template <class Archive>
   void serialize(Archive& archive, const unsigned int version);
@@ -457,12 +505,17 @@ class GaussianProcess : public Surrogate {
 
 template <class Archive>
 void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
-  silence_unused_args(version);
-
   archive& boost::serialization::base_object<Surrogate>(*this);
 
+  // Version 0 archives also hold the component-wise squared build point
+  // distances, which are no longer stored (they are recomputed from
+  // scaledBuildPoints as needed); read and discard them.
+  if (version == 0 && Archive::is_loading::value) {
+    std::vector<MatrixXd> cwise_dists2;
+    archive& cwise_dists2;
+  }
+
   // BMA: Initial cut is aggressive, serializing most members
-  archive& cwiseDists2;
   archive& thetaValues;
   archive& fixedNuggetValue;
   archive& estimateNugget;
@@ -492,6 +545,29 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
   // DTS: Set false so that the Cholesky factorization is recomputed after load
   hasBestCholFact = false;
   archive& hasBestCholFact;
+
+  if (version >= 2) {
+    archive& numQOI;
+    archive& responseOffsets;
+    archive& responseScaleFactors;
+    archive& qoiGroups;
+    archive& qoiGroupIndices;
+    int num_groups = groupModels.size();
+    archive& num_groups;
+    if (Archive::is_loading::value) {
+      groupModels.resize(num_groups);
+      for (auto& group_model : groupModels)
+        group_model = std::make_shared<GaussianProcess>();
+    }
+    for (auto& group_model : groupModels) archive&* group_model;
+  } else if (Archive::is_loading::value) {
+    numQOI = 1;
+    responseOffsets = VectorXd::Constant(1, responseOffset);
+    responseScaleFactors = VectorXd::Constant(1, responseScaleFactor);
+    qoiGroups.resize(0);
+    qoiGroupIndices.resize(0);
+    groupModels.clear();
+  }
   if (Archive::is_saving::value)
     writeParameterListToYamlFile(configOptions, "GaussianProcess.yaml");
 }
@@ -500,5 +576,8 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
 }  // namespace dakota
 
 BOOST_CLASS_EXPORT_KEY(dakota::surrogates::GaussianProcess)
+// Version 0: with cwiseDists2; version 1: without cwiseDists2; version 2:
+// multiple QoIs and QoI groups
+BOOST_CLASS_VERSION(dakota::surrogates::GaussianProcess, 2)
 
 #endif  // include guard
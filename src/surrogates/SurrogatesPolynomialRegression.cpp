@@ -59,16 +59,25 @@ PolynomialRegression::~PolynomialRegression() {}
 void PolynomialRegression::compute_basis_matrix(const MatrixXd& samples,
                                                 MatrixXd& basis_matrix) const {
   const int num_samples = samples.rows();
-  basis_matrix = MatrixXd::Zero(num_samples, numTerms);
-  double val;
+  basis_matrix.resize(num_samples, numTerms);
+
+  /* Tabulate the 1D monomials of each variable once, then form each term
+     as a column-wise product of the tables' columns */
+  std::vector<MatrixXd> powers(numVariables);
+  for (int d = 0; d < numVariables; ++d) {
+    const int max_power = basisIndices.row(d).maxCoeff();
+    powers[d].resize(num_samples, max_power + 1);
+    powers[d].col(0).setOnes();
+    for (int k = 1; k <= max_power; ++k)
+      powers[d].col(k) = powers[d].col(k - 1).cwiseProduct(samples.col(d));
+  }
 
   for (int j = 0; j < numTerms; ++j) {
-    for (int i = 0; i < num_samples; ++i) {
-      val = 1.0;
-      for (int d = 0; d < numVariables; ++d) {
-        val *= std::pow(samples(i, d), basisIndices(d, j));
-      }
-      basis_matrix(i, j) = val;
+    auto term = basis_matrix.col(j);
+    term.setOnes();
+    for (int d = 0; d < numVariables; ++d) {
+      const int power = basisIndices(d, j);
+      if (power > 0) term.array() *= powers[d].col(power).array();
     }
   }
 }
@@ -134,8 +143,41 @@ void PolynomialRegression::build(const MatrixXd& samples,
   linearSolver->solve(scaled_basis_matrix, scaled_response, polynomialCoeffs);
 
   /* Compute the intercept */
+  basisSums = scaled_basis_matrix.colwise().sum();
+  responseSum = scaled_response.sum();
+  polynomialIntercept =
+      (responseSum - basisSums.dot(polynomialCoeffs.col(0))) / numSamples;
+}
+
+void PolynomialRegression::append(const MatrixXd& samples,
+                                  const MatrixXd& response) {
+  if (!can_append())
+    throw(std::runtime_error(
+        "Polynomial append requires a surrogate built by the QR or "
+        "cholesky solver without basis or response scaling"));
+
+  if (verbosity > 0)
+    std::cout << "\nAppending " << samples.rows()
+              << " samples to Polynomial\n\n";
+
+  MatrixXd basis_matrix;
+  compute_basis_matrix(samples, basis_matrix);
+  linearSolver->append_rows(basis_matrix, response, polynomialCoeffs);
+
+  numSamples += samples.rows();
+  basisSums += basis_matrix.colwise().sum();
+  responseSum += response.sum();
   polynomialIntercept =
-      scaled_response.mean() - (scaled_basis_matrix * polynomialCoeffs).mean();
+      (responseSum - basisSums.dot(polynomialCoeffs.col(0))) / numSamples;
+}
+
+bool PolynomialRegression::can_append() const {
+  if (!linearSolver || !linearSolver->is_factorized()) return false;
+  const std::string& solver_name =
+      configOptions.get<std::string>("regression solver type");
+  return (solver_name == "QR lsq regression" || solver_name == "cholesky") &&
+         configOptions.get<std::string>("scaler type") == "none" &&
+         !configOptions.get<bool>("standardize response");
 }
 
 VectorXd PolynomialRegression::value(const MatrixXd& eval_points,
@@ -163,6 +205,65 @@ VectorXd PolynomialRegression::value(const MatrixXd& eval_points,
   return approx_values;
 }
 
+bool PolynomialRegression::cross_validation_predictions(
+    const MatrixXd& samples, const MatrixXd& response,
+    const std::vector<VectorXi>& cv_folds, VectorXd& cv_predictions) {
+  configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
+  /* Column scaling and the LU solver (square systems only) change the fit
+     in a fold-dependent way */
+  if (configOptions.get<std::string>("scaler type") != "none" ||
+      configOptions.get<std::string>("regression solver type") == "LU")
+    return false;
+
+  numSamples = samples.rows();
+  numVariables = samples.cols();
+  int max_degree = configOptions.get<int>("max degree");
+  double p_norm = configOptions.get<double>("p-norm");
+  if (configOptions.get<bool>("reduced basis"))
+    compute_reduced_indices(numVariables, max_degree, basisIndices);
+  else
+    compute_hyperbolic_indices(numVariables, max_degree, p_norm, basisIndices);
+  numTerms = basisIndices.cols();
+  if (numSamples <= numTerms) return false;
+
+  /* The intercept of each fold's fit vanishes, and response
+     standardization has no effect on predictions, only when the basis
+     spans the constants */
+  bool constant_term = false;
+  for (int j = 0; j < numTerms && !constant_term; ++j)
+    constant_term = (basisIndices.col(j).array() == 0).all();
+  if (!constant_term) return false;
+
+  MatrixXd basis_matrix;
+  compute_basis_matrix(samples, basis_matrix);
+  Eigen::ColPivHouseholderQR<MatrixXd> qr(basis_matrix);
+  if (qr.rank() < numTerms) return false;
+  const MatrixXd thin_q =
+      qr.householderQ() * MatrixXd::Identity(numSamples, numTerms);
+  const VectorXd& y = response.col(0);
+  const VectorXd residual = y - thin_q * (thin_q.transpose() * y);
+
+  cv_predictions.resize(numSamples);
+  for (const VectorXi& fold_indices : cv_folds) {
+    const int num_val_samples = fold_indices.size();
+    MatrixXd q_fold(num_val_samples, numTerms);
+    VectorXd r_fold(num_val_samples);
+    for (int j = 0; j < num_val_samples; ++j) {
+      q_fold.row(j) = thin_q.row(fold_indices(j));
+      r_fold(j) = residual(fold_indices(j));
+    }
+    /* Singular exactly when the fold's training basis is rank deficient */
+    Eigen::FullPivLU<MatrixXd> lu(MatrixXd::Identity(num_val_samples,
+                                                     num_val_samples) -
+                                  q_fold * q_fold.transpose());
+    if (!lu.isInvertible()) return false;
+    const VectorXd fold_residual = lu.solve(r_fold);
+    for (int j = 0; j < num_val_samples; ++j)
+      cv_predictions(fold_indices(j)) = y(fold_indices(j)) - fold_residual(j);
+  }
+  return true;
+}
+
 void PolynomialRegression::default_options() {
   defaultConfigOptions.set("reduced basis", false, "Use reduced basis");
   defaultConfigOptions.set("max degree", 1, "Maximum polynomial order");
@@ -185,6 +286,11 @@ MatrixXd PolynomialRegression::gradient(const MatrixXd& eval_points,
   silence_unused_args(qoi);
   assert(qoi == 0);
 
+  return gradient_with_coeffs(eval_points, polynomialCoeffs);
+}
+
+MatrixXd PolynomialRegression::gradient_with_coeffs(const MatrixXd& eval_points,
+                                                    const MatrixXd& coeffs) {
   MatrixXd basis_indices = basisIndices.cast<double>();
   basis_indices.transposeInPlace();
   MatrixXd deriv_coeffs = MatrixXd::Zero(numTerms, numVariables);
@@ -203,7 +309,7 @@ MatrixXd PolynomialRegression::gradient(const MatrixXd& eval_points,
             .rowwise()
             .squaredNorm()
             .minCoeff(&index);
-        deriv_coeffs(index, i) = basis_indices(k, i) * polynomialCoeffs(k);
+        deriv_coeffs(index, i) = basis_indices(k, i) * coeffs(k);
       }
     }
   }
@@ -226,6 +332,11 @@ MatrixXd PolynomialRegression::hessian(const MatrixXd& eval_point,
   silence_unused_args(qoi);
   assert(qoi == 0);
 
+  return hessian_with_coeffs(eval_point, polynomialCoeffs);
+}
+
+MatrixXd PolynomialRegression::hessian_with_coeffs(const MatrixXd& eval_point,
+                                                   const MatrixXd& coeffs) {
   if (eval_point.rows() != 1) {
     throw(std::runtime_error(
         "Polynomial Hessian evaluation is for a single point."
@@ -264,11 +375,10 @@ MatrixXd PolynomialRegression::hessian(const MatrixXd& eval_point,
               .minCoeff(&index);
           if (i == j) {
             deriv_coeffs(index) = basis_indices(k, i) *
-                                  (basis_indices(k, i) - 1.0) *
-                                  polynomialCoeffs(k);
+                                  (basis_indices(k, i) - 1.0) * coeffs(k);
           } else {
             deriv_coeffs(index) =
-                basis_indices(k, i) * basis_indices(k, j) * polynomialCoeffs(k);
+                basis_indices(k, i) * basis_indices(k, j) * coeffs(k);
           }
         }
       }
@@ -288,6 +398,9 @@ double PolynomialRegression::get_polynomial_intercept() const {
   return polynomialIntercept;
 }
 int PolynomialRegression::get_num_terms() const { return numTerms; }
+const MatrixXi& PolynomialRegression::get_basis_indices() const {
+  return basisIndices;
+}
 void PolynomialRegression::set_polynomial_coeffs(const MatrixXd& coeffs) {
   polynomialCoeffs = coeffs;
 }
@@ -31,6 +31,10 @@ namespace surrogates {
  *
  *  The DataScaler class provides the option of scaling the basis
  *  matrix.
+ *
+ *  Without scaling, samples may be appended to a built surrogate with
+ *  QR or Cholesky (normal equations) updates of the least-squares
+ *  factorization.
  */
 
 class PolynomialRegression : public Surrogate {
@@ -107,6 +111,24 @@ class PolynomialRegression : public Surrogate {
    */
   void build(const MatrixXd& samples, const MatrixXd& response) override;
 
+  /**
+   * \brief Add build data to a built polynomial surrogate, updating the
+   * regression solver's factorization instead of refactorizing the full
+   * basis matrix. Requires can_append().
+   *
+   * \param[in] samples Matrix of additional data - (num_new_samples by
+   * num_features) \param[in] response Vector of additional targets -
+   * (num_new_samples by num_qoi = 1).
+   */
+  void append(const MatrixXd& samples, const MatrixXd& response);
+
+  /**
+   * \brief Whether append() applies: the surrogate is built with the QR
+   * or Cholesky regression solver, and neither the basis matrix nor the
+   * response is scaled (the scaling would depend on all of the data).
+   */
+  bool can_append() const;
+
   /**
    *  \brief Evaluate the polynomial surrogate at a set of prediction points for
    * a single QoI. \param[in] eval_points Matrix of prediction points - (num_pts
@@ -165,6 +187,31 @@ class PolynomialRegression : public Surrogate {
     return Surrogate::hessian(eval_point);
   }
 
+  /**
+   *  \brief Evaluate the gradient of the polynomial with the given
+   *  coefficients in place of the surrogate's own, e.g., the trend of
+   *  another QoI over the same basis.
+   *  \param[in] eval_points Coordinates of the prediction points - (num_pts
+   *  by num_features).
+   *  \param[in] coeffs Polynomial coefficients - (num_terms by 1).
+   *  \returns Matrix of gradient vectors at the prediction points -
+   *  (num_pts by num_features).
+   */
+  MatrixXd gradient_with_coeffs(const MatrixXd& eval_points,
+                                const MatrixXd& coeffs);
+
+  /**
+   *  \brief Evaluate the Hessian of the polynomial with the given
+   *  coefficients in place of the surrogate's own at a single point.
+   *  \param[in] eval_point Coordinates of the prediction point - (1 by
+   *  num_features).
+   *  \param[in] coeffs Polynomial coefficients - (num_terms by 1).
+   *  \returns Hessian matrix at the prediction point - (num_features by
+   *  num_features).
+   */
+  MatrixXd hessian_with_coeffs(const MatrixXd& eval_point,
+                               const MatrixXd& coeffs);
+
   /* Getters */
 
   /// Get the polynomial surrogate's coefficients.
@@ -173,6 +220,9 @@ class PolynomialRegression : public Surrogate {
   double get_polynomial_intercept() const;
   /// Get the number of terms in the polynomial surrogate.
   int get_num_terms() const;
+  /// Get the powers of each variable in each term - (num_features by
+  /// num_terms).
+  const MatrixXi& get_basis_indices() const;
 
   /* Setters */
   /// Set the polynomial surrogate's coefficients.
@@ -186,6 +236,19 @@ class PolynomialRegression : public Surrogate {
   /// Construct and populate the defaultConfigOptions.
   void default_options() override;
 
+  /**
+   *  \brief Compute cross-validation predictions from a single
+   *  least-squares factorization of the full basis matrix: the residual
+   *  on a held-out fold F is (I - H_FF)^{-1} r_F, with H the hat matrix
+   *  and r the full-data residual. Applies when the basis includes the
+   *  constant term and is unscaled, and each fold's training basis
+   *  matrix has full column rank.
+   */
+  bool cross_validation_predictions(const MatrixXd& samples,
+                                    const MatrixXd& response,
+                                    const std::vector<VectorXi>& cv_folds,
+                                    VectorXd& cv_predictions) override;
+
   /// Matrix that specifies the powers of each variable for each term
   /// in the polynomial - (numVariables by numTerms).
   MatrixXi basisIndices;
@@ -198,6 +261,11 @@ class PolynomialRegression : public Surrogate {
   MatrixXd polynomialCoeffs;
   /// Offset/intercept term for the polynomial surrogate.
   double polynomialIntercept;
+  /// Column sums of the basis matrix over the build data, for updating
+  /// the intercept in append().
+  RowVectorXd basisSums;
+  /// Sum of the (scaled) build responses.
+  double responseSum;
   /// Verbosity level.
   int verbosity;
 
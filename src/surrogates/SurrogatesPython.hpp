@@ -135,6 +135,9 @@ class Python : public Surrogate {
     return std::make_shared<Python>(moduleAndClassName);
   }
 
+  /// Builds call into the interpreter and so are serialized by its lock
+  bool concurrent_builds() const override { return false; }
+
  private:
 
   // --------------- Python Setup --------------------
@@ -9,6 +9,9 @@
 
 #include "SurrogatesGaussianProcess.hpp"
 #include "SurrogatesPolynomialRegression.hpp"
+#include "util_common.hpp"
+#include "util_math_tools.hpp"
+#include "util_metrics.hpp"
 
 #define BOOST_TEST_MODULE surrogates_EvalMetricsCrossValTest
 #include <boost/test/included/unit_test.hpp>
@@ -155,4 +158,70 @@ BOOST_AUTO_TEST_CASE(test_surrogates_cross_validate) {
 
   cv_diff = (cross_val_metrics - gold_gp_cv_metrics).norm();
   BOOST_CHECK(cv_diff < cv_norm_difftol);
+
+  /* restricted to one thread, the folds (and the Gram matrix assembly
+     within them) run serially, with the same result */
+  {
+    ThreadBudget serial_budget(1);
+    BOOST_CHECK(available_threads() == 1);
+    VectorXd serial_metrics = gp_cv.cross_validate(
+        build_pts, target, metrics_names, num_folds, cv_seed);
+    BOOST_CHECK((serial_metrics - cross_val_metrics).norm() < 1.0e-12);
+  }
+  BOOST_CHECK(available_threads() >= 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_surrogates_cross_validate_closed_form) {
+  /* The polynomial's closed-form cross-validation matches per-fold refits */
+  const double cv_difftol = 1.0e-10;
+  const int cv_seed = 7;
+  const int num_folds = 4;
+  const int num_samples = 30;
+  const int num_vars = 2;
+
+  MatrixXd samples = MatrixXd::Random(num_samples, num_vars);
+  MatrixXd response(num_samples, 1);
+  for (int i = 0; i < num_samples; i++)
+    response(i, 0) =
+        std::sin(2.0 * samples(i, 0)) + samples(i, 1) * samples(i, 1);
+
+  ParameterList poly_pl("Quadratic Test Parameters");
+  poly_pl.set("max degree", 2);
+  poly_pl.set("verbosity", 0);
+  PolynomialRegression poly(poly_pl);
+
+  StringArray metrics_names = {"mean_squared", "max_abs"};
+  VectorXd cross_val_metrics = poly.cross_validate(
+      samples, response, metrics_names, num_folds, cv_seed);
+
+  std::vector<VectorXi> cv_folds;
+  create_cv_folds(num_folds, num_samples, cv_folds, cv_seed);
+  VectorXd refit_metrics = VectorXd::Zero(metrics_names.size());
+  for (int i = 0; i < num_folds; i++) {
+    const int num_val = cv_folds[i].size();
+    const int num_train = num_samples - num_val;
+    MatrixXd val_samples(num_val, num_vars), train_samples(num_train, num_vars);
+    VectorXd val_response(num_val);
+    MatrixXd train_response(num_train, 1);
+    for (int j = 0; j < num_val; j++) {
+      val_samples.row(j) = samples.row(cv_folds[i](j));
+      val_response(j) = response(cv_folds[i](j), 0);
+    }
+    int train_index = 0;
+    for (int k = 0; k < num_folds; k++) {
+      if (k == i) continue;
+      for (int j = 0; j < cv_folds[k].size(); j++, train_index++) {
+        train_samples.row(train_index) = samples.row(cv_folds[k](j));
+        train_response(train_index, 0) = response(cv_folds[k](j), 0);
+      }
+    }
+    PolynomialRegression fold_poly(train_samples, train_response, poly_pl);
+    VectorXd val_pred = fold_poly.value(val_samples);
+    for (int m = 0; m < metrics_names.size(); m++)
+      refit_metrics(m) +=
+          compute_metric(val_pred, val_response, metrics_names[m]);
+  }
+  refit_metrics /= double(num_folds);
+
+  BOOST_CHECK((cross_val_metrics - refit_metrics).norm() < cv_difftol);
 }
@@ -7,10 +7,12 @@
     For more information, see the README file in the top Dakota directory.
     _______________________________________________________________________ */
 
+#include "SurrogatesGPPredictor.hpp"
 #include "SurrogatesGaussianProcess.hpp"
 #include "surrogates_tools.hpp"
 #include "util_common.hpp"
 #include "util_data_types.hpp"
+#include "util_math_tools.hpp"
 
 #define BOOST_TEST_MODULE surrogates_GaussianProcessTest
 #include <boost/test/included/unit_test.hpp>
@@ -20,6 +22,7 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <sstream>
 
 // BMA TODO: Review with team for best practice
 using namespace dakota;
@@ -905,4 +908,340 @@ BOOST_AUTO_TEST_CASE(test_surrogates_gp_read_from_parameterlist) {
                 "SVD");
 }
 
+BOOST_AUTO_TEST_CASE(test_surrogates_gp_kernel_tiled_assembly) {
+  /* more points than fit in one tile, so that the tiled (and possibly
+   * threaded) assembly paths are exercised */
+  const int num_pts = 150;
+  const int num_vars = 3;
+  const MatrixXd pts =
+      create_uniform_random_double_matrix(num_pts, num_vars, 7, true, -1.0, 1.0);
+  MatrixXd weights =
+      create_uniform_random_double_matrix(num_pts, num_pts, 11, true, -1.0, 1.0);
+  weights = (weights + weights.transpose()).eval();
+  VectorXd theta_values(num_vars + 1);
+  theta_values << 0.3, -0.2, 0.1, 0.4;
+
+  const double fd_step = 1.0e-6;
+  const double rel_float_tol = 1.0e-6;
+
+  for (const std::string kernel_type :
+       {"squared exponential", "Matern 3/2", "Matern 5/2"}) {
+    auto kernel = kernel_factory(kernel_type);
+    MatrixXd gram, mixed_gram, deriv_factors;
+    kernel->compute_gram(pts, theta_values, gram, &deriv_factors);
+    kernel->compute_gram(pts, pts, theta_values, mixed_gram);
+    BOOST_CHECK(matrix_equals(gram, mixed_gram, 1.0e-14));
+    BOOST_CHECK(matrix_equals(gram, gram.transpose(), 0.0));
+
+    /* length-scale derivative contractions vs. central differences */
+    VectorXd contraction;
+    kernel->compute_gram_derivs_contraction(pts, deriv_factors, weights,
+                                            theta_values, contraction);
+    for (int k = 0; k < num_vars; k++) {
+      VectorXd theta_plus = theta_values, theta_minus = theta_values;
+      theta_plus(k + 1) += fd_step;
+      theta_minus(k + 1) -= fd_step;
+      MatrixXd gram_plus, gram_minus;
+      kernel->compute_gram(pts, theta_plus, gram_plus);
+      kernel->compute_gram(pts, theta_minus, gram_minus);
+      const double fd_contraction =
+          ((gram_plus - gram_minus).cwiseProduct(weights)).sum() /
+          (2.0 * fd_step);
+      BOOST_CHECK_CLOSE(contraction(k), fd_contraction, 100.0 * rel_float_tol);
+    }
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE(test_surrogates_gp_predictor) {
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  const double rel_float_tol = 1.0e-10;
+  const double abs_float_tol = 1.0e-12;
+
+  const std::vector<std::string> kernel_types = {
+      "squared exponential", "Matern 3/2", "Matern 5/2"};
+
+  for (const auto& kernel_type : kernel_types) {
+    for (const bool estimate_trend : {false, true}) {
+      ParameterList param_list =
+          get_gp_config_options(sigma_bounds, length_scale_bounds);
+      param_list.set("num restarts", 5);
+      param_list.set("kernel type", kernel_type);
+      param_list.sublist("Nugget").set("estimate nugget", estimate_trend);
+      param_list.sublist("Trend").set("estimate trend", estimate_trend);
+      param_list.sublist("Trend").sublist("Options").set("max degree", 2);
+
+      GaussianProcess gp(samples, response, param_list);
+      GPPredictor predictor(gp);
+      GPPredictor::Workspace ws(predictor);
+      BOOST_CHECK(predictor.num_variables() == 2);
+
+      const VectorXd gold_mean = gp.value(eval_pts);
+      const VectorXd gold_variance = gp.variance(eval_pts);
+      const MatrixXd gold_grad = gp.gradient(eval_pts);
+
+      VectorXd mean(eval_pts.rows()), variance(eval_pts.rows());
+      MatrixXd grad(eval_pts.rows(), 2);
+      for (int i = 0; i < eval_pts.rows(); ++i) {
+        double mean_i, variance_i;
+        predictor.value_and_variance(eval_pts.row(i), mean_i, variance_i, ws);
+        BOOST_CHECK_CLOSE(predictor.value(eval_pts.row(i), ws), mean_i,
+                          rel_float_tol);
+        BOOST_CHECK_SMALL(predictor.variance(eval_pts.row(i), ws) -
+                              variance_i, abs_float_tol);
+        mean(i) = predictor.value_and_gradient(eval_pts.row(i), grad.row(i),
+                                               ws);
+        variance(i) = variance_i;
+      }
+
+      BOOST_CHECK(relative_allclose(mean, gold_mean, rel_float_tol));
+      BOOST_CHECK(relative_allclose(grad, gold_grad, rel_float_tol));
+      BOOST_CHECK((variance - gold_variance).cwiseAbs().maxCoeff() <
+                  abs_float_tol);
+
+      VectorXd batch_mean, batch_variance;
+      predictor.value(eval_pts, batch_mean, ws);
+      predictor.variance(eval_pts, batch_variance, ws);
+      BOOST_CHECK(relative_allclose(batch_mean, gold_mean, rel_float_tol));
+      BOOST_CHECK((batch_variance - gold_variance).cwiseAbs().maxCoeff() <
+                  abs_float_tol);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_surrogates_gp_multiple_qoi) {
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  const double rel_float_tol = 1.0e-8;
+  const double abs_float_tol = 1.0e-10;
+
+  /* the second QoI is an affine map of the first, so after standardization
+     the QoIs have the same likelihood and the same predictions */
+  MatrixXd responses(samples.rows(), 3);
+  responses.col(0) = response;
+  responses.col(1) = 3.0 * response.array() + 2.0;
+  responses.col(2) =
+      (2.0 * samples.col(0).array()).sin() * samples.col(1).array().cos();
+
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.set("num restarts", 5);
+  param_list.set("standardize response", true);
+
+  GaussianProcess gp_single(samples, response, param_list);
+  GaussianProcess gp_multi(samples, responses.leftCols(2), param_list);
+  BOOST_CHECK(gp_multi.get_qoi_groups().size() == 0);
+
+  const VectorXd mean = gp_single.value(eval_pts);
+  const MatrixXd grad = gp_single.gradient(eval_pts);
+  const VectorXd variance = gp_single.variance(eval_pts);
+  BOOST_CHECK(relative_allclose(gp_multi.value(eval_pts, 0), mean,
+                                rel_float_tol));
+  BOOST_CHECK(relative_allclose(gp_multi.value(eval_pts, 1),
+                                (3.0 * mean.array() + 2.0).matrix(),
+                                rel_float_tol));
+  BOOST_CHECK(relative_allclose(gp_multi.gradient(eval_pts, 1), 3.0 * grad,
+                                rel_float_tol));
+  BOOST_CHECK((gp_multi.variance(eval_pts, 1) - 9.0 * variance)
+                  .cwiseAbs()
+                  .maxCoeff() < abs_float_tol);
+  BOOST_CHECK_THROW(gp_multi.value(eval_pts, 2), std::runtime_error);
+
+  /* with a trend each QoI has its own coefficients; the predictor solves
+     for the weights of both QoIs at once */
+  param_list.sublist("Trend").set("estimate trend", true);
+  param_list.sublist("Trend").sublist("Options").set("max degree", 1);
+  GaussianProcess gp_trend(samples, responses.leftCols(2), param_list);
+  GPPredictor predictor(gp_trend);
+  GPPredictor::Workspace ws(predictor);
+  BOOST_CHECK(predictor.num_qoi() == 2);
+  for (int qoi = 0; qoi < 2; ++qoi) {
+    const VectorXd gold_mean = gp_trend.value(eval_pts, qoi);
+    const MatrixXd gold_grad = gp_trend.gradient(eval_pts, qoi);
+    VectorXd pred_mean;
+    MatrixXd pred_grad(eval_pts.rows(), 2);
+    predictor.value(eval_pts, pred_mean, ws, qoi);
+    for (int i = 0; i < eval_pts.rows(); ++i)
+      predictor.value_and_gradient(eval_pts.row(i), pred_grad.row(i), ws,
+                                   qoi);
+    BOOST_CHECK(relative_allclose(pred_mean, gold_mean, rel_float_tol));
+    BOOST_CHECK(relative_allclose(pred_grad, gold_grad, rel_float_tol));
+  }
+
+  /* in two groups, the third QoI gets its own GP */
+  param_list.sublist("Trend").set("estimate trend", false);
+  GaussianProcess gp_third(samples, responses.col(2), param_list);
+  param_list.set("num QoI groups", 2);
+  GaussianProcess gp_groups(samples, responses, param_list);
+  const VectorXi& groups = gp_groups.get_qoi_groups();
+  BOOST_CHECK(groups.size() == 3);
+  BOOST_CHECK(groups(0) == 0 && groups(1) == 0 && groups(2) == 1);
+  BOOST_CHECK(relative_allclose(gp_groups.value(eval_pts, 0), mean,
+                                rel_float_tol));
+  BOOST_CHECK(relative_allclose(gp_groups.value(eval_pts, 2),
+                                gp_third.value(eval_pts), rel_float_tol));
+
+  GPPredictor group_predictor(gp_groups);
+  GPPredictor::Workspace group_ws(group_predictor);
+  VectorXd group_mean;
+  group_predictor.value(eval_pts, group_mean, group_ws, 2);
+  BOOST_CHECK(relative_allclose(group_mean, gp_third.value(eval_pts),
+                                rel_float_tol));
+
+  for (const bool binary : {false, true}) {
+    const std::string filename("gp_multiple_qoi_test.surr");
+    boost::filesystem::remove(filename);
+    Surrogate::save(gp_groups, filename, binary);
+    GaussianProcess gp_loaded;
+    Surrogate::load(filename, binary, gp_loaded);
+    BOOST_CHECK(gp_loaded.get_qoi_groups() == groups);
+    for (int qoi = 0; qoi < 3; ++qoi)
+      BOOST_CHECK(matrix_equals(gp_loaded.value(eval_pts, qoi),
+                                gp_groups.value(eval_pts, qoi), 1.0e-16));
+  }
+}
+
+/**
+ * \brief Writes GaussianProcess archives in the class version 0 layout
+ * (with the component-wise squared build point distances), using data
+ * read from a current archive.
+ */
+class BaselineLayoutGP : public Surrogate {
+ public:
+  void build(const MatrixXd&, const MatrixXd&) override {}
+  VectorXd value(const MatrixXd&, const int) override { return VectorXd(); }
+  void default_options() override {}
+  std::shared_ptr<Surrogate> clone() const override { return nullptr; }
+
+ private:
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& archive, const unsigned int version);
+
+  std::vector<MatrixXd> cwiseDists2;
+  VectorXd thetaValues;
+  double fixedNuggetValue;
+  bool estimateNugget;
+  double estimatedNuggetValue;
+  bool estimateTrend;
+  MatrixXd scaledBuildPoints;
+  MatrixXd targetValues;
+  MatrixXd basisMatrix;
+  VectorXd betaValues;
+  int verbosity;
+  VectorXd objectiveFunctionHistory;
+  MatrixXd objectiveGradientHistory;
+  MatrixXd thetaHistory;
+  std::string kernel_type;
+  PolynomialRegression polyRegression;
+  bool hasBestCholFact;
+};
+
+template <class Archive>
+void BaselineLayoutGP::serialize(Archive& archive,
+                                 const unsigned int version) {
+  archive& boost::serialization::base_object<Surrogate>(*this);
+  if (Archive::is_saving::value) archive& cwiseDists2;
+  archive& thetaValues;
+  archive& fixedNuggetValue;
+  archive& estimateNugget;
+  archive& estimatedNuggetValue;
+  archive& estimateTrend;
+  archive& scaledBuildPoints;
+  archive& targetValues;
+  archive& basisMatrix;
+  if (Archive::is_saving::value)
+    archive& betaValues;
+  else {
+    MatrixXd beta_values;
+    archive& beta_values;
+    betaValues = beta_values.col(0);
+  }
+  archive& verbosity;
+  archive& objectiveFunctionHistory;
+  archive& objectiveGradientHistory;
+  archive& thetaHistory;
+  archive& kernel_type;
+  if (estimateTrend) archive& polyRegression;
+  archive& hasBestCholFact;
+
+  if (Archive::is_loading::value) {
+    /* single-QoI data of the current layout */
+    BOOST_REQUIRE(version >= 2);
+    int num_qoi, num_groups;
+    VectorXd response_offsets, response_scale_factors;
+    VectorXi qoi_groups, qoi_group_indices;
+    archive& num_qoi;
+    archive& response_offsets;
+    archive& response_scale_factors;
+    archive& qoi_groups;
+    archive& qoi_group_indices;
+    archive& num_groups;
+    BOOST_REQUIRE(num_qoi == 1 && num_groups == 0);
+
+    /* the distances stored by version 0 */
+    const int num_pts = scaledBuildPoints.rows();
+    cwiseDists2.resize(scaledBuildPoints.cols());
+    for (int k = 0; k < scaledBuildPoints.cols(); ++k) {
+      cwiseDists2[k].resize(num_pts, num_pts);
+      for (int j = 0; j < num_pts; ++j)
+        for (int i = 0; i < num_pts; ++i)
+          cwiseDists2[k](i, j) = std::pow(
+              scaledBuildPoints(i, k) - scaledBuildPoints(j, k), 2);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_surrogates_gp_load_version_0_archive) {
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.set("num restarts", 5);
+  param_list.sublist("Trend").set("estimate trend", true);
+  param_list.sublist("Trend").sublist("Options").set("max degree", 1);
+  GaussianProcess gp(samples, response, param_list);
+
+  /* rewrite the model in the version 0 layout */
+  std::stringstream current_stream, baseline_stream;
+  {
+    boost::archive::text_oarchive output_archive(current_stream);
+    output_archive << gp;
+  }
+  BaselineLayoutGP baseline;
+  {
+    boost::archive::text_iarchive input_archive(current_stream);
+    input_archive >> baseline;
+  }
+  {
+    boost::archive::text_oarchive output_archive(baseline_stream);
+    output_archive << baseline;
+  }
+
+  GaussianProcess gp_loaded;
+  {
+    boost::archive::text_iarchive input_archive(baseline_stream);
+    input_archive >> gp_loaded;
+  }
+  BOOST_CHECK(matrix_equals(gp_loaded.value(eval_pts), gp.value(eval_pts),
+                            1.0e-16));
+  BOOST_CHECK(matrix_equals(gp_loaded.gradient(eval_pts),
+                            gp.gradient(eval_pts), 1.0e-16));
+  BOOST_CHECK(matrix_equals(gp_loaded.variance(eval_pts),
+                            gp.variance(eval_pts), 1.0e-16));
+}
+
 }  // namespace
@@ -414,6 +414,48 @@ void PolynomialRegression_SaveLoad() {
   }
 }
 
+/// Append build data in batches through QR and Cholesky updates; verify
+/// agreement with a polynomial built from all of the data
+void PolynomialRegressionSurrogate_append() {
+  int num_vars = 2, num_samples = 30, degree = 3;
+
+  MatrixXd samples, responses;
+  get_samples(num_vars, num_samples, samples);
+  cubic_bivariate_function(samples, responses);
+  responses.array() += samples.col(0).array().sin();
+
+  MatrixXd eval_points;
+  get_samples(num_vars, 7, eval_points);
+
+  for (std::string solver_name : {"QR lsq regression", "cholesky"}) {
+    Teuchos::ParameterList config_options("Polynomial Test Parameters");
+    config_options.set("max degree", degree);
+    config_options.set("regression solver type", solver_name);
+
+    PolynomialRegression pr_full(samples, responses, config_options);
+    PolynomialRegression pr_append(samples.topRows(12),
+                                   responses.topRows(12), config_options);
+    BOOST_CHECK(pr_append.can_append());
+    pr_append.append(samples.middleRows(12, 10), responses.middleRows(12, 10));
+    pr_append.append(samples.bottomRows(8), responses.bottomRows(8));
+
+    BOOST_CHECK(matrix_equals(pr_full.get_polynomial_coeffs(),
+                              pr_append.get_polynomial_coeffs(), 1.0e-10));
+    BOOST_CHECK(std::abs(pr_full.get_polynomial_intercept() -
+                         pr_append.get_polynomial_intercept()) < 1.0e-10);
+    BOOST_CHECK(matrix_equals(pr_full.value(eval_points),
+                              pr_append.value(eval_points), 1.0e-10));
+  }
+
+  /* Scaling depends on all of the data, so appending is not supported */
+  Teuchos::ParameterList scaled_options("Polynomial Test Parameters");
+  scaled_options.set("max degree", degree);
+  scaled_options.set("regression solver type", "QR lsq regression");
+  scaled_options.set("scaler type", "standardization");
+  PolynomialRegression pr_scaled(samples, responses, scaled_options);
+  BOOST_CHECK(!pr_scaled.can_append());
+}
+
 }  // namespace
 
 // --------------------------------------------------------------------------------
@@ -429,6 +471,9 @@ int test_main(int argc, char* argv[])  // note the name!
   PolynomialRegressionSurrogate_multivariate_regression_builder();
   PolynomialRegressionSurrogate_gradient_and_hessian();
 
+  // Incremental build test
+  PolynomialRegressionSurrogate_append();
+
   // ParameterList import test
   PolynomialRegressionSurrogate_parameter_list_import();
 
@@ -9,7 +9,12 @@
 
 #include "tolerance_intervals.hpp"
 #include "DakotaResponse.hpp"
+#include "util_common.hpp"
 #include <boost/math/distributions/chi_squared.hpp>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
 
 static const char rcsId[]="@(#) $Id: tolerance_intervals.cpp 9999 2010-10-22 23:20:24Z mseldre $";
 
@@ -72,45 +77,48 @@ Real computeDSTIEN_conversion_factor( const size_t number_of_samples
   return conversionFactor;
 }
 
-void computeDSTIEN( const IntResponseMap & resp_samples
-                  , const Real             coverage
-                  , const Real             alpha
-                  , size_t               & num_valid_samples
-                  , RealVector           & dstien_mus
-                  , Real                 & delta_mf
-                  , RealVector           & sample_sigmas
-                  , RealVector           & dstien_sigmas
-                  )
+void computeDSTIEN_factors( const size_t number_of_samples
+                          , const Real   coverage
+                          , const Real   alpha
+                          , Real       & conversion_factor
+                          , Real       & delta_mf
+                          )
 {
-  // Check input information
-  size_t num_samples = resp_samples.size();
-  if (num_samples < 2) {
-    Cerr << "Error in computeDSTIEN()"
-         << ": the number of response samples (" << num_samples
-         << ") must be at least 2"
-         << std::endl;
-    abort_handler(-1);
-  }
+  // Streamed studies revisit the same few sample counts; the cache is
+  // bounded for long-running processes that see many distinct counts
+  typedef std::tuple<size_t, Real, Real> FactorKey;
+  static const size_t max_cached_factors = 64;
+  static std::map<FactorKey, std::pair<Real, Real> > factorCache;
+  static std::mutex factorMutex;
 
-  size_t num_responses = resp_samples.begin()->second.num_functions();
-  if (num_responses == 0) {
-    Cerr << "Error in computeDSTIEN()"
-         << ": the number of responses of the first sample (" << num_responses
-         << ") must be nonzero"
-         << std::endl;
-    abort_handler(-1);
+  FactorKey key(number_of_samples, coverage, alpha);
+  {
+    std::lock_guard<std::mutex> lock(factorMutex);
+    std::map<FactorKey, std::pair<Real, Real> >::const_iterator it = factorCache.find(key);
+    if (it != factorCache.end()) {
+      conversion_factor = it->second.first;
+      delta_mf          = it->second.second;
+      return;
+    }
   }
 
-  for (IntRespMCIter it = resp_samples.begin(); it != resp_samples.end(); ++it) {
-    if (it->second.num_functions() != num_responses) {
-      Cerr << "Error in computeDSTIEN()"
-           << ": all response samples must have the same size (" << num_responses
-           << ") as the first sample"
-           << std::endl;
-      abort_handler(-1);
-    }
+  // Compute outside of the lock, since invalid input aborts/throws
+  conversion_factor = computeDSTIEN_conversion_factor( number_of_samples
+                                                     , alpha
+                                                     );
+  delta_mf = std_normal_coverage_inverse(coverage) * conversion_factor;
+
+  std::lock_guard<std::mutex> lock(factorMutex);
+  if (factorCache.size() >= max_cached_factors) {
+    factorCache.clear();
   }
+  factorCache[key] = std::make_pair(conversion_factor, delta_mf);
+}
 
+static void checkDSTIEN_levels( const Real coverage
+                              , const Real alpha
+                              )
+{
   if ((0. <= coverage) && (coverage <= 1.)) {
     // Ok
   }
@@ -132,7 +140,175 @@ void computeDSTIEN( const IntResponseMap & resp_samples
          << std::endl;
     abort_handler(-1);
   }
+}
+
+/** Copies the function values of each response sample into one row of a
+    matrix, so that the samples of each response are contiguous. */
+static void packDSTIEN_samples( const IntResponseMap & resp_samples
+                              , RealMatrix           & packed_samples
+                              )
+{
+  size_t num_samples   = resp_samples.size();
+  size_t num_responses = (num_samples) ? resp_samples.begin()->second.num_functions() : 0;
+  packed_samples.shapeUninitialized(num_samples, num_responses);
+  IntRespMCIter it = resp_samples.begin();
+  for (size_t j = 0; j < num_samples; ++j, ++it) {
+    const RealVector& fn_vals = it->second.function_values();
+    for (size_t k = 0; k < num_responses; ++k) {
+      packed_samples(j,k) = fn_vals[k];
+    } // for k
+  } // for j
+}
+
+void accumulateDSTIEN( const RealMatrix & resp_samples
+                     , size_t           & num_valid_samples
+                     , RealVector       & sample_mus
+                     , RealVector       & sum_sq_diffs
+                     )
+{
+  size_t num_samples   = resp_samples.numRows();
+  size_t num_responses = resp_samples.numCols();
+  if (num_valid_samples == 0) {
+    sample_mus.size(num_responses);
+    sum_sq_diffs.size(num_responses);
+  }
+  else if ((sample_mus.length()   != num_responses) ||
+           (sum_sq_diffs.length() != num_responses)) {
+    Cerr << "Error in accumulateDSTIEN()"
+         << ": the number of responses (" << num_responses
+         << ") must match that of previously accumulated samples ("
+         << sample_mus.length() << ")"
+         << std::endl;
+    abort_handler(-1);
+  }
+
+  // Determine the valid samples (rows); scanning by response keeps the
+  // reads contiguous, and the row list is only needed if some are invalid
+  std::vector<bool> sample_valid_status(num_samples,true);
+  for (size_t k = 0; k < num_responses; ++k) {
+    const Real* samples_k = resp_samples[k];
+    for (size_t j = 0; j < num_samples; ++j) {
+      if (!std::isfinite(samples_k[j])) {
+        sample_valid_status[j] = false;
+      }
+    } // for j
+  } // for k
+  SizetArray valid_rows;
+  for (size_t j = 0; j < num_samples; ++j) {
+    if (sample_valid_status[j]) {
+      valid_rows.push_back(j);
+    }
+  } // for j
+  size_t num_batch_valid = valid_rows.size();
+  if (num_batch_valid == 0) {
+    return;
+  }
+  bool all_valid = (num_batch_valid == num_samples);
+
+  // Batch mean and sum of squared deviations per response, merged into the
+  // running values; the first batch is copied so that a single batch
+  // reproduces the two-pass results exactly
+  Real n_a = static_cast<Real>(num_valid_samples);
+  Real n_b = static_cast<Real>(num_batch_valid);
+  Real n   = n_a + n_b;
+  auto merge_responses = [&](size_t k_start, size_t k_end) {
+    for (size_t k = k_start; k < k_end; ++k) {
+      const Real* samples_k = resp_samples[k];
+      Real mu_b = 0.;
+      if (all_valid) {
+        for (size_t j = 0; j < num_samples; ++j) {
+          mu_b += samples_k[j];
+        }
+      }
+      else {
+        for (size_t j = 0; j < num_batch_valid; ++j) {
+          mu_b += samples_k[valid_rows[j]];
+        }
+      }
+      mu_b *= 1./n_b;
+
+      Real sum_sq_b = 0.;
+      if (all_valid) {
+        for (size_t j = 0; j < num_samples; ++j) {
+          Real diff = samples_k[j] - mu_b;
+          sum_sq_b += diff * diff;
+        }
+      }
+      else {
+        for (size_t j = 0; j < num_batch_valid; ++j) {
+          Real diff = samples_k[valid_rows[j]] - mu_b;
+          sum_sq_b += diff * diff;
+        }
+      }
+
+      if (num_valid_samples == 0) {
+        sample_mus[k]   = mu_b;
+        sum_sq_diffs[k] = sum_sq_b;
+      }
+      else {
+        Real delta = mu_b - sample_mus[k];
+        sample_mus[k]   += delta * n_b / n;
+        sum_sq_diffs[k] += sum_sq_b + delta * delta * n_a * n_b / n;
+      }
+    } // for k
+  };
+
+  // Responses are independent: spread contiguous ranges of them over
+  // threads once the batch is large enough to amortize thread startup,
+  // within the threads available to this process and calling thread
+  size_t num_threads = 1;
+  if (num_responses * num_batch_valid >= 65536) {
+    num_threads = std::min<size_t>(num_responses,
+      dakota::util::available_threads());
+  }
+  if (num_threads > 1) {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    size_t chunk = (num_responses + num_threads - 1) / num_threads;
+    for (size_t k_start = 0; k_start < num_responses; k_start += chunk) {
+      threads.emplace_back(merge_responses, k_start,
+                           std::min(k_start + chunk, num_responses));
+    }
+    for (size_t t = 0; t < threads.size(); ++t) {
+      threads[t].join();
+    }
+  }
+  else {
+    merge_responses(0, num_responses);
+  }
+
+  num_valid_samples += num_batch_valid;
+}
+
+void accumulateDSTIEN( const IntResponseMap & resp_samples
+                     , size_t               & num_valid_samples
+                     , RealVector           & sample_mus
+                     , RealVector           & sum_sq_diffs
+                     )
+{
+  RealMatrix packed_samples;
+  packDSTIEN_samples(resp_samples, packed_samples);
+  accumulateDSTIEN( packed_samples
+                  , num_valid_samples
+                  , sample_mus
+                  , sum_sq_diffs
+                  );
+}
 
+void computeDSTIEN( const size_t       num_valid_samples
+                  , const RealVector & sample_mus
+                  , const RealVector & sum_sq_diffs
+                  , const Real         coverage
+                  , const Real         alpha
+                  , RealVector       & dstien_mus
+                  , Real             & delta_mf
+                  , RealVector       & sample_sigmas
+                  , RealVector       & dstien_sigmas
+                  )
+{
+  checkDSTIEN_levels(coverage, alpha);
+
+  size_t num_responses = sample_mus.length();
   if (dstien_mus.length() != num_responses) {
     dstien_mus.resize(num_responses);
   }
@@ -145,86 +321,144 @@ void computeDSTIEN( const IntResponseMap & resp_samples
     dstien_sigmas.resize(num_responses);
   }
 
-  // Initialize the output variables
-  num_valid_samples = 0;
-  dstien_mus        = 0.;
-  delta_mf          = 0.;
-  sample_sigmas     = 0.;
-  dstien_sigmas     = 0.;
-
-  // Determine the amount of valid samples
-  std::vector<bool> sample_valid_status(num_samples,false);
-  {
-    IntRespMCIter it = resp_samples.begin();
-    for (size_t j = 0; j < num_samples; ++j, ++it) {
-      bool sample_is_valid = true;
-      for (size_t k = 0; (k < num_responses) && sample_is_valid; ++k) {
-        sample_is_valid = std::isfinite(it->second.function_value(k));
-      } // for k
-      if (sample_is_valid) {
-        num_valid_samples += 1;
-        sample_valid_status[j] = true;
-      }
-    } // for j
-  }
-
   if (num_valid_samples == 0) {
     dstien_mus    = std::numeric_limits<Real>::quiet_NaN();
     delta_mf      = std::numeric_limits<Real>::quiet_NaN();
     sample_sigmas = std::numeric_limits<Real>::quiet_NaN();
     dstien_sigmas = std::numeric_limits<Real>::quiet_NaN();
   }
+  else if (num_valid_samples == 1) {
+    dstien_mus    = sample_mus;
+    delta_mf      = std::numeric_limits<Real>::quiet_NaN();
+    sample_sigmas = std::numeric_limits<Real>::quiet_NaN();
+    dstien_sigmas = std::numeric_limits<Real>::quiet_NaN();
+  }
   else {
     Real m = static_cast<Real>(num_valid_samples);
+    Real conversionFactor = 0.;
+    computeDSTIEN_factors( num_valid_samples
+                         , coverage
+                         , alpha
+                         , conversionFactor
+                         , delta_mf
+                         );
 
-    // Compute DSTIEN mus
-    {
-      IntRespMCIter it = resp_samples.begin();
-      for (size_t j = 0; j < num_samples; ++j, ++it) {
-        if (sample_valid_status[j]) {
-          for (size_t k = 0; k < num_responses; ++k) {
-            dstien_mus[k] += it->second.function_value(k);
-          } // for k
-        }
-      } // for j
-    }
+    dstien_mus = sample_mus;
 
-    dstien_mus *= 1./m;
+    Real inv_dof = 1./(m - 1.);
+    for (size_t k = 0; k < num_responses; ++k) {
+      sample_sigmas[k] = std::sqrt( sum_sq_diffs[k] * inv_dof );
+      dstien_sigmas[k] = sample_sigmas[k] * conversionFactor;
+    } // for k
+  }
+}
 
-    // Compute DSTIEN sigmas
-    if (num_valid_samples == 1) {
-      delta_mf      = std::numeric_limits<Real>::quiet_NaN();
-      sample_sigmas = std::numeric_limits<Real>::quiet_NaN();
-      dstien_sigmas = std::numeric_limits<Real>::quiet_NaN();
-    }
-    else {
-      {
-        IntRespMCIter it = resp_samples.begin();
-        for (size_t j = 0; j < num_samples; ++j, ++it) {
-          if (sample_valid_status[j]) {
-            for (size_t k = 0; k < num_responses; ++k) {
-              Real diff = it->second.function_value(k) - dstien_mus[k];
-              sample_sigmas[k] += diff * diff;
-            } // for k
-          }
-        } // for j
-      }
+void computeDSTIEN( const RealMatrix & resp_samples
+                  , const Real         coverage
+                  , const Real         alpha
+                  , size_t           & num_valid_samples
+                  , RealVector       & dstien_mus
+                  , Real             & delta_mf
+                  , RealVector       & sample_sigmas
+                  , RealVector       & dstien_sigmas
+                  )
+{
+  // Check input information
+  size_t num_samples = resp_samples.numRows();
+  if (num_samples < 2) {
+    Cerr << "Error in computeDSTIEN()"
+         << ": the number of response samples (" << num_samples
+         << ") must be at least 2"
+         << std::endl;
+    abort_handler(-1);
+  }
 
-      Real conversionFactor = computeDSTIEN_conversion_factor( num_valid_samples
-                                                             , alpha
-                                                             );
+  size_t num_responses = resp_samples.numCols();
+  if (num_responses == 0) {
+    Cerr << "Error in computeDSTIEN()"
+         << ": the number of responses (" << num_responses
+         << ") must be nonzero"
+         << std::endl;
+    abort_handler(-1);
+  }
+
+  checkDSTIEN_levels(coverage, alpha);
 
-      delta_mf = std_normal_coverage_inverse(coverage) * conversionFactor;
+  // One batch of running sums holds all of the samples
+  RealVector sample_mus, sum_sq_diffs;
+  num_valid_samples = 0;
+  accumulateDSTIEN( resp_samples
+                  , num_valid_samples
+                  , sample_mus
+                  , sum_sq_diffs
+                  );
+
+  computeDSTIEN( num_valid_samples
+               , sample_mus
+               , sum_sq_diffs
+               , coverage
+               , alpha
+               , dstien_mus
+               , delta_mf
+               , sample_sigmas
+               , dstien_sigmas
+               );
+}
+
+void computeDSTIEN( const IntResponseMap & resp_samples
+                  , const Real             coverage
+                  , const Real             alpha
+                  , size_t               & num_valid_samples
+                  , RealVector           & dstien_mus
+                  , Real                 & delta_mf
+                  , RealVector           & sample_sigmas
+                  , RealVector           & dstien_sigmas
+                  )
+{
+  // Check input information
+  size_t num_samples = resp_samples.size();
+  if (num_samples < 2) {
+    Cerr << "Error in computeDSTIEN()"
+         << ": the number of response samples (" << num_samples
+         << ") must be at least 2"
+         << std::endl;
+    abort_handler(-1);
+  }
+
+  size_t num_responses = resp_samples.begin()->second.num_functions();
+  if (num_responses == 0) {
+    Cerr << "Error in computeDSTIEN()"
+         << ": the number of responses of the first sample (" << num_responses
+         << ") must be nonzero"
+         << std::endl;
+    abort_handler(-1);
+  }
+
+  for (IntRespMCIter it = resp_samples.begin(); it != resp_samples.end(); ++it) {
+    if (it->second.num_functions() != num_responses) {
+      Cerr << "Error in computeDSTIEN()"
+           << ": all response samples must have the same size (" << num_responses
+           << ") as the first sample"
+           << std::endl;
+      abort_handler(-1);
+    }
+  }
 
-      sample_sigmas *= 1./(m - 1.);
-      for (size_t k = 0; k < num_responses; ++k) {
-        sample_sigmas[k] = std::sqrt( sample_sigmas[k] );
-      } // for k
+  checkDSTIEN_levels(coverage, alpha);
 
-      dstien_sigmas =  sample_sigmas;
-      dstien_sigmas *= conversionFactor;
-    } // if (num_valid_samples == 1) else
-  } // if (num_valid_samples == 0) else
+  // A single pass over the map gathers the samples of each response into
+  // a contiguous column; all moments are then computed from the matrix
+  RealMatrix packed_samples;
+  packDSTIEN_samples(resp_samples, packed_samples);
+  computeDSTIEN( packed_samples
+               , coverage
+               , alpha
+               , num_valid_samples
+               , dstien_mus
+               , delta_mf
+               , sample_sigmas
+               , dstien_sigmas
+               );
 } // void computeDSTIEN()
 
 } // namespace Dakota
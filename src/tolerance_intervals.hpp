@@ -70,6 +70,90 @@ Real computeDSTIEN_conversion_factor( const size_t number_of_samples
                                     , const Real   alpha
                                     );
 
+/**
+ *  \brief This routine returns both computeDSTIEN_conversion_factor(m, alpha) and
+ *         delta_mf = computeDSTIEN_conversion_factor(m, alpha) * std_normal_coverage_inverse(c).
+ *
+ *         Both factors depend only on (m, c, alpha), so they are cached by that triple and
+ *         the chi-square quantile and inverse error function are evaluated only once for
+ *         each combination, however many responses or sampling batches use them.
+ *         The input information is checked as in the two routines above.
+ *
+ *  \param[in] number_of_samples = the value 'm' on the text above
+ *  \param[in] coverage          = the required coverage level c above
+ *  \param[in] alpha             = the value such that (1-alpha) is the required confidence level
+ *
+ *  \param[out] conversion_factor = computeDSTIEN_conversion_factor(m, alpha)
+ *  \param[out] delta_mf          = the multiplicative factor explained above
+ */
+void computeDSTIEN_factors( const size_t number_of_samples
+                          , const Real   coverage
+                          , const Real   alpha
+                          , Real       & conversion_factor
+                          , Real       & delta_mf
+                          );
+
+/**
+ *  \brief This routine adds a batch of response samples to running DSTIEN sums, so that
+ *         tolerance intervals can be updated as samples stream in without retaining them.
+ *
+ *         The batch is given as a matrix with one row per sample and one column per
+ *         response, so that the samples of each response are contiguous. A sample (row) is
+ *         valid if all of its r responses are finite values; invalid samples are skipped, as
+ *         in computeDSTIEN(). For each response, the mean and the sum of squared deviations
+ *         of the valid samples of the batch are computed in two passes over its column and
+ *         then merged into the running values (Chan et al., 1979). Responses are processed
+ *         concurrently when the batch is large.
+ *
+ *         On the first call, num_valid_samples must be zero; sample_mus and sum_sq_diffs are
+ *         then resized to r. On later calls, the batch must have the same r columns.
+ *
+ *  \param[in]     resp_samples      = the batch of response samples, one per row
+ *  \param[in,out] num_valid_samples = running number of valid samples
+ *  \param[in,out] sample_mus        = running r averages of the valid samples
+ *  \param[in,out] sum_sq_diffs      = running r sums of squared deviations from sample_mus
+ */
+void accumulateDSTIEN( const RealMatrix & resp_samples
+                     , size_t           & num_valid_samples
+                     , RealVector       & sample_mus
+                     , RealVector       & sum_sq_diffs
+                     );
+
+/**
+ *  \brief Same as above, for a batch of response samples in an IntResponseMap.
+ */
+void accumulateDSTIEN( const IntResponseMap & resp_samples
+                     , size_t               & num_valid_samples
+                     , RealVector           & sample_mus
+                     , RealVector           & sum_sq_diffs
+                     );
+
+/**
+ *  \brief This routine converts running sums from accumulateDSTIEN() into the outputs of
+ *         computeDSTIEN(), with the same treatment of m == 0 and m == 1 valid samples.
+ *
+ *  \param[in] num_valid_samples = number of valid samples 'm' accumulated
+ *  \param[in] sample_mus        = the r averages of the valid samples
+ *  \param[in] sum_sq_diffs      = the r sums of squared deviations from sample_mus
+ *  \param[in] coverage          = the required coverage level c
+ *  \param[in] alpha             = the value such that (1-alpha) is the required confidence level
+ *
+ *  \param[out] dstien_mus    = the r averages
+ *  \param[out] delta_mf      = the multiplicative factor explained for computeDSTIEN()
+ *  \param[out] sample_sigmas = the r sample standard deviations
+ *  \param[out] dstien_sigmas = the r DSTIEN standard deviations
+ */
+void computeDSTIEN( const size_t       num_valid_samples
+                  , const RealVector & sample_mus
+                  , const RealVector & sum_sq_diffs
+                  , const Real         coverage
+                  , const Real         alpha
+                  , RealVector       & dstien_mus
+                  , Real             & delta_mf
+                  , RealVector       & sample_sigmas
+                  , RealVector       & dstien_sigmas
+                  );
+
 /**
  *  \brief This routine computes the r averages and r standard deviations corresponding to the
  *         'two sided tolerance interval equivalent normal' (DSTIEN).
@@ -134,6 +218,20 @@ void computeDSTIEN( const IntResponseMap & resp_samples
                   , RealVector           & dstien_sigmas
                   );
 
+/**
+ *  \brief Same as above, for n response samples given as a matrix with one row per sample
+ *         and one column per response.
+ */
+void computeDSTIEN( const RealMatrix & resp_samples
+                  , const Real         coverage
+                  , const Real         alpha
+                  , size_t           & num_valid_samples
+                  , RealVector       & dstien_mus
+                  , Real             & delta_mf
+                  , RealVector       & sample_sigmas
+                  , RealVector       & dstien_sigmas
+                  );
+
 } // namespace Dakota
 
 #endif
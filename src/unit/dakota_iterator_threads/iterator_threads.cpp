@@ -0,0 +1,95 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+
+#define BOOST_TEST_MODULE dakota_iterator_threads
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace TestIteratorThreads {
+
+/// multi_start input for the given sub-method and thread specification
+std::string multi_start_input(const std::string& sub_method,
+			      const std::string& threads)
+{
+  return
+    "environment \n"
+    "  top_method_pointer = 'MS' \n"
+    "method \n"
+    "  id_method = 'MS' \n"
+    "  multi_start \n"
+    "    method_pointer = 'NLP' \n"
+    "    starting_points = -.8 -.8  -.8 .8  .8 -.8  .8 .8  0. .5  .5 0. \n"
+    + threads +
+    "method \n"
+    "  id_method = 'NLP' \n"
+    + sub_method +
+    "variables \n"
+    "  continuous_design = 2 \n"
+    "    lower_bounds = -2. -2. \n"
+    "    upper_bounds =  2.  2. \n"
+    "interface \n"
+    "  direct \n"
+    "    analysis_driver = 'text_book' \n"
+    "responses \n"
+    "  objective_functions = 1 \n"
+    "  analytic_gradients \n"
+    "  no_hessians \n";
+}
+
+/// run multi_start with and without threads and compare the best results
+void check_threaded_results(const std::string& sub_method)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    serial_env(Dakota::Opt_TPL_Test::create_env(
+      multi_start_input(sub_method, "")));
+  serial_env->execute();
+
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    thread_env(Dakota::Opt_TPL_Test::create_env(
+      multi_start_input(sub_method, "    iterator_threads = 3 \n")));
+  thread_env->execute();
+
+  const Dakota::RealVector& serial_cv
+    = serial_env->variables_results().continuous_variables();
+  const Dakota::RealVector& thread_cv
+    = thread_env->variables_results().continuous_variables();
+  BOOST_REQUIRE_EQUAL(serial_cv.length(), thread_cv.length());
+  for (int i=0; i<serial_cv.length(); ++i)
+    BOOST_CHECK_CLOSE(serial_cv[i], thread_cv[i], 1.e-8);
+  BOOST_CHECK_CLOSE(serial_env->response_results().function_value(0),
+		    thread_env->response_results().function_value(0), 1.e-8);
+}
+
+// +-------------------------------------------------------------------------+
+// |       Concurrent jobs on thread replicas reproduce the serial results   |
+// +-------------------------------------------------------------------------+
+#ifdef HAVE_OPTPP
+BOOST_AUTO_TEST_CASE(threaded_multi_start_reentrant)
+{
+  check_threaded_results("  optpp_q_newton \n"
+			 "    convergence_tolerance = 1.e-10 \n");
+}
+#endif
+
+// +-------------------------------------------------------------------------+
+// |        Non-reentrant sub-methods fall back to serial scheduling         |
+// +-------------------------------------------------------------------------+
+#ifdef HAVE_NCSU
+BOOST_AUTO_TEST_CASE(threaded_multi_start_non_reentrant)
+{
+  check_threaded_results("  ncsu_direct \n"
+			 "    max_function_evaluations = 200 \n");
+}
+#endif
+
+}  // namespace TestIteratorThreads
+}  // namespace DakotaUnitTest
@@ -0,0 +1,139 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "ParamResponsePair.hpp"
+#include "RestartVersion.hpp"
+
+#define BOOST_TEST_MODULE dakota_library_rerun
+#include <boost/test/included/unit_test.hpp>
+
+#include <fstream>
+
+namespace DakotaUnitTest {
+
+namespace TestLibraryRerun {
+
+const char dakota_input[] =
+  "environment \n"
+  "method \n"
+  "  sampling \n"
+  "    sample_type lhs \n"
+  "    samples = 20 \n"
+  "    seed = 1234 \n"
+  "    fixed_seed \n"
+  "variables \n"
+  "  uniform_uncertain = 2 \n"
+  "    lower_bounds = -1. -1. \n"
+  "    upper_bounds =  1.  1. \n"
+  "interface \n"
+  "  direct \n"
+  "    analysis_driver = 'text_book' \n"
+  "responses \n"
+  "  response_functions = 1 \n"
+  "  no_gradients \n"
+  "  no_hessians \n";
+
+const char restart_file[] = "library_rerun.rst";
+
+/// construct the environment as in Opt_TPL_Test::create_env(), writing
+/// restart records to restart_file
+Dakota::LibraryEnvironment* create_rerun_env()
+{
+  Dakota::ProgramOptions opts;
+  opts.echo_input(false);
+  opts.input_string(dakota_input);
+  opts.write_restart_file(restart_file);
+  Dakota::LibraryEnvironment* p_env
+    = new Dakota::LibraryEnvironment(MPI_COMM_WORLD, opts, false);
+  p_env->exit_mode("throw");
+  p_env->done_modifying_db();
+  return p_env;
+}
+
+/// evaluation ids of the records in restart_file, in file order
+Dakota::IntArray restart_eval_ids()
+{
+  Dakota::IntArray eval_ids;
+  std::ifstream restart_input_fs(restart_file, std::ios::binary);
+  BOOST_REQUIRE(restart_input_fs.good());
+  boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
+  Dakota::RestartVersion rst_ver;
+  restart_input_archive & rst_ver;
+  restart_input_fs.peek();
+  while (restart_input_fs.good() && !restart_input_fs.eof()) {
+    Dakota::ParamResponsePair current_pair;
+    restart_input_archive & current_pair;
+    eval_ids.push_back(current_pair.eval_id());
+    restart_input_fs.peek();
+  }
+  return eval_ids;
+}
+
+/// check that restart_file holds evaluations 1, ..., num_evals
+void check_restart_eval_ids(int num_evals)
+{
+  Dakota::IntArray eval_ids = restart_eval_ids();
+  BOOST_REQUIRE_EQUAL(eval_ids.size(), (size_t)num_evals);
+  for (int i=0; i<num_evals; ++i)
+    BOOST_CHECK_EQUAL(eval_ids[i], i+1);
+}
+
+// +-------------------------------------------------------------------------+
+// |         Rerun reproduces the study and honors updated settings          |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(rerun_seed_and_samples)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment> p_env(create_rerun_env());
+  Dakota::LibraryEnvironment& env = *p_env;
+  Dakota::Interface& iface = env.top_level_model().derived_interface();
+
+  env.execute();
+  Dakota::RealMatrix first_samples(env.top_level_iterator().all_samples());
+  BOOST_CHECK_EQUAL(first_samples.numCols(), 20);
+  BOOST_CHECK_EQUAL(iface.evaluation_id(), 20);
+  check_restart_eval_ids(20);
+
+  // fixed seed with cache and counters reset: identical samples, all
+  // of which are evaluated anew; the restart file is truncated on
+  // request, so its ids do not repeat
+  const unsigned short reset_with_restart
+    = Dakota::LibraryEnvironment::RESET_EVALUATION_CACHE |
+      Dakota::LibraryEnvironment::RESET_EVALUATION_COUNTERS |
+      Dakota::LibraryEnvironment::RESET_RESTART;
+  env.rerun(reset_with_restart);
+  BOOST_CHECK(first_samples == env.top_level_iterator().all_samples());
+  BOOST_CHECK_EQUAL(iface.evaluation_id(), 20);
+  check_restart_eval_ids(20);
+
+  // counters retained: evaluation ids continue from the previous run,
+  // as do the restart records
+  env.rerun(Dakota::LibraryEnvironment::RESET_EVALUATION_CACHE);
+  BOOST_CHECK_EQUAL(iface.evaluation_id(), 40);
+  check_restart_eval_ids(40);
+
+  // new seed and sample count without reconstruction
+  env.random_seed(4321);
+  env.num_samples(30);
+  env.rerun(reset_with_restart);
+  const Dakota::RealMatrix& new_samples
+    = env.top_level_iterator().all_samples();
+  BOOST_CHECK_EQUAL(new_samples.numCols(), 30);
+  BOOST_CHECK_EQUAL(iface.evaluation_id(), 30);
+  BOOST_CHECK(new_samples(0,0) != first_samples(0,0));
+  check_restart_eval_ids(30);
+
+  // default rerun resets the counters but appends to the restart file
+  env.rerun();
+  BOOST_CHECK_EQUAL(iface.evaluation_id(), 30);
+  BOOST_CHECK_EQUAL(restart_eval_ids().size(), 60);
+}
+
+}  // namespace TestLibraryRerun
+}  // namespace DakotaUnitTest
@@ -0,0 +1,111 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+
+#define BOOST_TEST_MODULE dakota_mlblue_threads
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace MLBLUEThreads {
+
+/// variables block for one fidelity of the tunable model
+std::string tunable_variables(const std::string& id, const std::string& theta,
+			      const std::string& form)
+{
+  return
+    "variables \n"
+    "  id_variables = '" + id + "' \n"
+    "  uniform_uncertain = 2 \n"
+    "    lower_bounds = 2*-1. \n"
+    "    upper_bounds = 2* 1. \n"
+    "    descriptors = 'x' 'y' \n"
+    "  continuous_state = 1 \n"
+    "    initial_state = " + theta + " \n"
+    "    descriptors = 'theta' \n"
+    "  discrete_state_set integer = 1 \n"
+    "    initial_state = " + form + " \n"
+    "    set_values = " + form + " \n"
+    "    descriptors = 'ModelForm' \n";
+}
+
+/// model and interface blocks for one fidelity of the tunable model
+std::string tunable_model(const std::string& id, const std::string& cost)
+{
+  return
+    "model \n"
+    "  id_model = '" + id + "' \n"
+    "  variables_pointer = '" + id + "_VARS' \n"
+    "  interface_pointer = '" + id + "_INT' \n"
+    "  simulation \n"
+    "    solution_level_cost = " + cost + " \n"
+    "interface \n"
+    "  id_interface = '" + id + "_INT' \n"
+    "  direct \n"
+    "    analysis_driver = 'tunable_model' \n"
+    "  deactivate evaluation_cache restart_file \n";
+}
+
+/// ML BLUE over the three-model tunable problem, for which each update
+/// of the 7 group covariances requires 7 independent pseudo-inverses
+std::string mlblue_input(const std::string& threads)
+{
+  return
+    "method \n"
+    "  model_pointer = 'ENSEMBLE' \n"
+    "  multilevel_blue \n"
+    "    pilot_samples = 20 \n"
+    "    max_function_evaluations = 200 \n"
+    "    pseudo_inverse_threads = " + threads + " \n"
+    "    seed = 8674132 \n"
+    "    output silent \n"
+    "model \n"
+    "  id_model = 'ENSEMBLE' \n"
+    "  variables_pointer = 'HF_VARS' \n"
+    "  surrogate ensemble \n"
+    "    truth_model = 'HF' \n"
+    "    unordered_model_fidelities = 'LF' 'MF' \n"
+    + tunable_model("LF", "0.01") + tunable_model("MF", "0.1")
+    + tunable_model("HF", "1.")
+    + tunable_variables("LF_VARS", "0.5235987755983", "2")
+    + tunable_variables("MF_VARS", "1.0471975511966", "1")
+    + tunable_variables("HF_VARS", "1.5707963267949", "0") +
+    "responses \n"
+    "  response_functions = 1 \n"
+    "  no_gradients \n"
+    "  no_hessians \n";
+}
+
+// +-------------------------------------------------------------------------+
+// |   Threaded group covariance inverses reproduce the serial estimator     |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(threaded_pseudo_inverses_match_serial)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    serial_env(Dakota::Opt_TPL_Test::create_env(mlblue_input("1")));
+  serial_env->execute();
+  const Dakota::RealVector& serial_stats
+    = serial_env->top_level_iterator().response_results().function_values();
+
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    thread_env(Dakota::Opt_TPL_Test::create_env(mlblue_input("4")));
+  thread_env->execute();
+  const Dakota::RealVector& thread_stats
+    = thread_env->top_level_iterator().response_results().function_values();
+
+  BOOST_REQUIRE_EQUAL(thread_stats.length(), serial_stats.length());
+  BOOST_REQUIRE(serial_stats.length() > 0);
+  for (int i=0; i<serial_stats.length(); ++i)
+    BOOST_CHECK_CLOSE(thread_stats[i], serial_stats[i], 1.e-10);
+}
+
+}  // namespace MLBLUEThreads
+
+}  // namespace DakotaUnitTest
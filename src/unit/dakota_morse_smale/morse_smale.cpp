@@ -0,0 +1,122 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "MorseSmaleComplex.hpp"
+#include "util_common.hpp"
+
+#define BOOST_TEST_MODULE dakota_morse_smale
+#include <boost/test/included/unit_test.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace DakotaUnitTest {
+
+namespace MorseSmale {
+
+/// count points of dim-1 coordinates in [-1,1] followed by the value of
+/// a multimodal function of them, one row per point
+std::vector<double> sample_points(int dim, int count, unsigned seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  std::vector<double> points((size_t)dim*count);
+  for (int i=0; i<count; ++i) {
+    double* x = &points[(size_t)i*dim];
+    double value = 0.;
+    for (int j=0; j<dim-1; ++j) {
+      x[j] = unif(rng);
+      value += std::sin(3.*x[j]) * std::cos(2.*(j+1)*x[j]);
+    }
+    x[dim-1] = value;
+  }
+  return points;
+}
+
+/// check that two complexes have the same symmetric kNN graph and the
+/// same vertex classifications
+void check_same_complex(MS_Complex& C, MS_Complex& ref)
+{
+  BOOST_REQUIRE_EQUAL(C.numV, ref.numV);
+  BOOST_CHECK_EQUAL(C.numE, ref.numE);
+  for (int v=0; v<ref.numV; ++v) {
+    BOOST_REQUIRE_EQUAL(C.NumNeighbors(v), ref.NumNeighbors(v));
+    for (int i=0; i<ref.NumNeighbors(v); ++i)
+      BOOST_CHECK_EQUAL(C.GetIthNeighbor(v, i), ref.GetIthNeighbor(v, i));
+    BOOST_CHECK_EQUAL(C.V[v]->classification, ref.V[v]->classification);
+  }
+  BOOST_CHECK_EQUAL(C.CountMaxima(), ref.CountMaxima());
+  BOOST_CHECK_EQUAL(C.CountMinima(), ref.CountMinima());
+  BOOST_CHECK_EQUAL(C.CountSaddles(), ref.CountSaddles());
+}
+
+/// insert each of num_new points into a complex over the first count
+/// points and compare against a complex rebuilt from scratch
+void check_incremental_insertion(int dim, int count, int num_new, int k)
+{
+  std::vector<double> points = sample_points(dim, count + num_new, 1234);
+  MS_Complex base(points.data(), dim, count, k);
+
+  std::vector<double> base_points(points.begin(),
+				  points.begin() + (size_t)dim*count);
+  for (int n=0; n<num_new; ++n) {
+    double* new_point = &points[(size_t)dim*(count+n)];
+    MS_Complex inserted(base, new_point);
+
+    std::vector<double> scratch_points(base_points);
+    scratch_points.insert(scratch_points.end(), new_point, new_point + dim);
+    MS_Complex scratch(scratch_points.data(), dim, count + 1, k);
+
+    check_same_complex(inserted, scratch);
+  }
+}
+
+// +-------------------------------------------------------------------------+
+// |     Incremental insertion reproduces the graph of a full rebuild        |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(incremental_insertion_matches_rebuild)
+{
+  check_incremental_insertion(3, 300, 5, 8);
+}
+
+// +-------------------------------------------------------------------------+
+// |   Large complexes take the threaded paths (distance scan and gradient   |
+// |   flow) and still match the rebuild                                     |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(threaded_incremental_insertion_matches_rebuild)
+{
+  dakota::util::ThreadBudget thread_budget(4);
+  check_incremental_insertion(17, 4500, 2, 15);
+}
+
+// +-------------------------------------------------------------------------+
+// |          Thread count does not change the constructed complex           |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(threaded_build_matches_serial)
+{
+  std::vector<double> points = sample_points(3, 5000, 4321);
+
+  std::unique_ptr<MS_Complex> serial, threaded;
+  {
+    dakota::util::ThreadBudget thread_budget(1);
+    serial.reset(new MS_Complex(points.data(), 3, 5000, 10));
+  }
+  {
+    dakota::util::ThreadBudget thread_budget(4);
+    threaded.reset(new MS_Complex(points.data(), 3, 5000, 10));
+  }
+
+  check_same_complex(*threaded, *serial);
+}
+
+}  // namespace MorseSmale
+
+}  // namespace DakotaUnitTest
@@ -0,0 +1,109 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+
+#define BOOST_TEST_MODULE dakota_muq_chains
+#include <boost/test/included/unit_test.hpp>
+
+#include <fstream>
+
+namespace DakotaUnitTest {
+
+namespace MUQChains {
+
+const char data_file[] = "muq_chains.dat";
+
+/// Metropolis-Hastings calibration of text_book to a single datum,
+/// with three chains run in lockstep
+std::string muq_chains_input(bool batch)
+{
+  std::string input(
+    "method \n"
+    "  bayes_calibration muq \n"
+    "    metropolis_hastings \n"
+    "    chain_samples = 300 \n"
+    "    chains = 3 \n"
+    "    seed = 34784 \n"
+    "    output silent \n"
+    "variables \n"
+    "  uniform_uncertain = 2 \n"
+    "    lower_bounds = 0. 0. \n"
+    "    upper_bounds = 2. 2. \n"
+    "    initial_point = 1.2 0.8 \n"
+    "interface \n"
+    "  analysis_drivers = 'text_book' \n"
+    "    direct \n");
+  if (batch)
+    input += "  batch \n";
+  input += std::string(
+    "  deactivate evaluation_cache restart_file \n"
+    "responses \n"
+    "  calibration_terms = 1 \n"
+    "    calibration_data_file = '") + data_file + "' \n"
+    "      freeform \n"
+    "  no_gradients \n"
+    "  no_hessians \n";
+  return input;
+}
+
+/// run the lockstep chains and return the MAP point and its response
+void run_chains(bool batch, Dakota::RealVector& map_pt,
+		Dakota::RealVector& map_fns)
+{
+  std::ofstream data_out(data_file);
+  data_out << "0.1\n";
+  data_out.close();
+
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    env(Dakota::Opt_TPL_Test::create_env(muq_chains_input(batch)));
+  if (batch)
+    BOOST_REQUIRE(
+      env->top_level_iterator().iterated_model().asynch_flag());
+  env->execute();
+  map_pt = env->variables_results().continuous_variables();
+  map_fns = env->response_results().function_values();
+}
+
+// +-------------------------------------------------------------------------+
+// |    Lockstep chains evaluated as one batch per round reproduce the       |
+// |    chains evaluated one proposal at a time                              |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(lockstep_chains_batch_matches_synchronous)
+{
+  Dakota::RealVector sync_pt, sync_fns, batch_pt, batch_fns;
+  run_chains(false, sync_pt, sync_fns);
+  run_chains(true,  batch_pt, batch_fns);
+
+  BOOST_REQUIRE_EQUAL(batch_pt.length(), 2);
+  BOOST_REQUIRE_EQUAL(sync_pt.length(),  2);
+  for (int i=0; i<2; ++i)
+    BOOST_CHECK_CLOSE(batch_pt[i], sync_pt[i], 1.e-10);
+  BOOST_REQUIRE_EQUAL(batch_fns.length(), sync_fns.length());
+  for (int i=0; i<sync_fns.length(); ++i)
+    BOOST_CHECK_CLOSE(batch_fns[i], sync_fns[i], 1.e-10);
+}
+
+// +-------------------------------------------------------------------------+
+// |     The fixed turn order makes lockstep chains repeatable for a seed    |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(lockstep_chains_repeatable)
+{
+  Dakota::RealVector first_pt, first_fns, second_pt, second_fns;
+  run_chains(true, first_pt, first_fns);
+  run_chains(true, second_pt, second_fns);
+
+  BOOST_REQUIRE_EQUAL(second_pt.length(), first_pt.length());
+  for (int i=0; i<first_pt.length(); ++i)
+    BOOST_CHECK_EQUAL(second_pt[i], first_pt[i]);
+}
+
+}  // namespace MUQChains
+
+}  // namespace DakotaUnitTest
@@ -0,0 +1,133 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "ProbabilityTransformModel.hpp"
+
+#include <cmath>
+
+#define BOOST_TEST_MODULE dakota_prob_transform_batch
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace ProbTransformBatch {
+
+/// sampling study over correlated variables of several distribution types;
+/// only its x-space model is used
+const std::string x_space_input(
+  "method \n"
+  "  sampling \n"
+  "    samples = 5 \n"
+  "    seed = 1234 \n"
+  "variables \n"
+  "  normal_uncertain = 2 \n"
+  "    means = 1. 2. \n"
+  "    std_deviations = 0.5 1.5 \n"
+  "    descriptors = 'n1' 'n2' \n"
+  "  lognormal_uncertain = 1 \n"
+  "    means = 2. \n"
+  "    std_deviations = 0.4 \n"
+  "    descriptors = 'ln1' \n"
+  "  uniform_uncertain = 1 \n"
+  "    lower_bounds = -1. \n"
+  "    upper_bounds = 3. \n"
+  "    descriptors = 'u1' \n"
+  "  gumbel_uncertain = 1 \n"
+  "    alphas = 1.5 \n"
+  "    betas = 0.5 \n"
+  "    descriptors = 'g1' \n"
+  "  uncertain_correlation_matrix = 1.  0.3 0.  0.  0. \n"
+  "                                 0.3 1.  0.2 0.  0. \n"
+  "                                 0.  0.2 1.  0.  0. \n"
+  "                                 0.  0.  0.  1.  0. \n"
+  "                                 0.  0.  0.  0.  1. \n"
+  "interface \n"
+  "  analysis_drivers = 'text_book' \n"
+  "    direct \n"
+  "responses \n"
+  "  response_functions = 1 \n"
+  "  no_gradients \n"
+  "  no_hessians \n");
+
+/// check that a batch transformation matches the per-sample one
+void check_columns(const Dakota::RealMatrix& batch,
+		   const Dakota::RealMatrix& per_sample)
+{
+  BOOST_REQUIRE_EQUAL(batch.numRows(), per_sample.numRows());
+  BOOST_REQUIRE_EQUAL(batch.numCols(), per_sample.numCols());
+  for (int j=0; j<batch.numCols(); ++j)
+    for (int i=0; i<batch.numRows(); ++i)
+      BOOST_CHECK_CLOSE(batch(i,j), per_sample(i,j), 1.e-12);
+}
+
+// +-------------------------------------------------------------------------+
+// |   Batch transformations match the per-sample ones in both directions    |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(batch_matches_per_sample)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    env(Dakota::Opt_TPL_Test::create_env(x_space_input));
+  Dakota::Model& x_model = env->top_level_iterator().iterated_model();
+  Dakota::Model u_model;
+  u_model.assign_rep(std::make_shared<Dakota::ProbabilityTransformModel>
+		     (x_model, STD_NORMAL_U));
+
+  // x-space samples within the support of every variable
+  const int num_vars = 5, num_samples = 7;
+  Dakota::RealMatrix x_samples(num_vars, num_samples, false);
+  for (int j=0; j<num_samples; ++j) {
+    Dakota::Real t = -0.9 + 0.3 * j;
+    x_samples(0,j) = 1. + 0.5 * t;
+    x_samples(1,j) = 2. - 1.5 * t;
+    x_samples(2,j) = 2. * std::exp(0.2 * t);
+    x_samples(3,j) = 1. + 1.9 * t;
+    x_samples(4,j) = 1.5 + 0.5 * t;
+  }
+
+  // x to u: per sample, batch into a new matrix, and batch in place
+  Dakota::RealMatrix u_per_sample(num_vars, num_samples, false);
+  Dakota::RealVector u_samp;
+  for (int j=0; j<num_samples; ++j) {
+    Dakota::RealVector x_samp(Teuchos::View, x_samples[j], num_vars);
+    u_model.trans_X_to_U(x_samp, u_samp);
+    BOOST_REQUIRE_EQUAL(u_samp.length(), num_vars);
+    std::copy(u_samp.values(), u_samp.values() + num_vars, u_per_sample[j]);
+  }
+  Dakota::RealMatrix u_batch;
+  u_model.trans_X_to_U(x_samples, u_batch);
+  check_columns(u_batch, u_per_sample);
+  Dakota::RealMatrix in_place(x_samples);
+  u_model.trans_X_to_U(in_place, in_place);
+  check_columns(in_place, u_per_sample);
+
+  // u to x: per sample, batch into a new matrix, and batch in place
+  Dakota::RealMatrix x_per_sample(num_vars, num_samples, false);
+  Dakota::RealVector x_samp;
+  for (int j=0; j<num_samples; ++j) {
+    Dakota::RealVector u_samp_j(Teuchos::View, u_per_sample[j], num_vars);
+    u_model.trans_U_to_X(u_samp_j, x_samp);
+    BOOST_REQUIRE_EQUAL(x_samp.length(), num_vars);
+    std::copy(x_samp.values(), x_samp.values() + num_vars, x_per_sample[j]);
+  }
+  Dakota::RealMatrix x_batch;
+  u_model.trans_U_to_X(u_per_sample, x_batch);
+  check_columns(x_batch, x_per_sample);
+  u_model.trans_U_to_X(in_place, in_place);
+  check_columns(in_place, x_per_sample);
+
+  // the round trip recovers the original samples
+  for (int j=0; j<num_samples; ++j)
+    for (int i=0; i<num_vars; ++i)
+      BOOST_CHECK_CLOSE(x_batch(i,j), x_samples(i,j), 1.e-8);
+}
+
+}  // namespace ProbTransformBatch
+
+}  // namespace DakotaUnitTest
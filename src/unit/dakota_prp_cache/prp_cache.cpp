@@ -0,0 +1,147 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "PRPMultiIndex.hpp"
+#include "SimulationResponse.hpp"
+
+#define BOOST_TEST_MODULE dakota_prp_cache
+#include <boost/test/included/unit_test.hpp>
+
+using namespace Dakota;
+
+namespace {
+
+/// variables with one of each type, active view over all of them
+Variables make_variables(Real x0)
+{
+  SizetArray vc_totals(NUM_VC_TOTALS, 1);
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  Variables vars(svd);
+  for (size_t i=0; i<vars.acv(); ++i)
+    vars.all_continuous_variable(x0 + (Real)i, i);
+  for (size_t i=0; i<vars.adiv(); ++i)
+    vars.all_discrete_int_variable(i, i);
+  for (size_t i=0; i<vars.adsv(); ++i)
+    vars.all_discrete_string_variable(String("sv") + std::to_string(i), i);
+  for (size_t i=0; i<vars.adrv(); ++i)
+    vars.all_discrete_real_variable(100. + (Real)i, i);
+  return vars;
+}
+
+/// response with one function value
+Response make_response(Real fn_val)
+{
+  ActiveSet as(1, NUM_VC_TOTALS);
+  as.request_values(1);
+  Response resp(SIMULATION_RESPONSE, as);
+  resp.function_value(fn_val, 0);
+  return resp;
+}
+
+}
+
+// +-------------------------------------------------------------------------+
+// |   Exact duplicate detection by interface id, variables and active set   |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(test_prp_cache_duplicate_detection)
+{
+  PRPCache cache;
+  const String iface_id("PRP_IFACE");
+  Variables vars = make_variables(0.5);
+  Response resp = make_response(1.);
+  cache.insert(ParamResponsePair(vars, iface_id, resp, 1));
+
+  // a copy of the variables is a duplicate
+  Variables search_vars = vars.copy();
+  PRPCacheHIter h_it
+    = lookup_by_val(cache, iface_id, search_vars, resp.active_set());
+  BOOST_REQUIRE(h_it != cache.get<hashed>().end());
+  BOOST_CHECK_EQUAL(h_it->eval_id(), 1);
+  ParamResponsePair search_pr(search_vars, iface_id, resp);
+  BOOST_CHECK(lookup_by_val(cache, search_pr) != cache.get<hashed>().end());
+
+  // other interfaces and variables are not
+  BOOST_CHECK(lookup_by_val(cache, String("OTHER_IFACE"), search_vars,
+			    resp.active_set()) == cache.get<hashed>().end());
+  search_vars.continuous_variable(0.75, 0);
+  BOOST_CHECK(lookup_by_val(cache, iface_id, search_vars, resp.active_set())
+	      == cache.get<hashed>().end());
+}
+
+// +-------------------------------------------------------------------------+
+// |   Updates through the non-const variables() accessor are refingerprinted|
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(test_prp_fingerprint_variables_update)
+{
+  PRPCache cache;
+  const String iface_id("PRP_IFACE");
+  Response resp = make_response(1.);
+  cache.insert(ParamResponsePair(make_variables(0.5), iface_id, resp, 1));
+
+  // fingerprinted on construction, then updated in place to match
+  ParamResponsePair search_pr(make_variables(2.5), iface_id, resp, 0);
+  for (size_t i=0; i<search_pr.variables().acv(); ++i)
+    search_pr.variables().all_continuous_variable(0.5 + (Real)i, i);
+  search_pr.update_fingerprint();
+  BOOST_CHECK(search_pr.fingerprint() ==
+	      ParamResponsePair(make_variables(0.5), iface_id, resp).fingerprint());
+  BOOST_CHECK(lookup_by_val(cache, search_pr) != cache.get<hashed>().end());
+
+  // an updated pair is found once inserted
+  ParamResponsePair new_pr(make_variables(2.5), iface_id, resp, 2);
+  new_pr.variables().all_continuous_variable(4., 0);
+  new_pr.update_fingerprint();
+  cache.insert(new_pr);
+  Variables new_vars = make_variables(2.5);
+  new_vars.all_continuous_variable(4., 0);
+  PRPCacheHIter h_it
+    = lookup_by_val(cache, iface_id, new_vars, resp.active_set());
+  BOOST_REQUIRE(h_it != cache.get<hashed>().end());
+  BOOST_CHECK_EQUAL(h_it->eval_id(), 2);
+}
+
+// +-------------------------------------------------------------------------+
+// |   Copies carry the stored fingerprint; a cached interface index agrees  |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(test_prp_fingerprint_copy)
+{
+  PRPCache cache;
+  const String iface_id("PRP_IFACE");
+  Response resp = make_response(1.);
+  int iface_index = interface_id_index(iface_id);
+
+  Variables vars = make_variables(0.5);
+  ParamResponsePair pr(vars, iface_id, iface_index, resp, 1);
+  BOOST_CHECK(pr.fingerprint() ==
+	      ParamResponsePair(vars, iface_id, resp, 1).fingerprint());
+  ParamResponsePair pr_copy(pr), pr_assign;
+  pr_assign = pr;
+  BOOST_CHECK(pr_copy.fingerprint() == pr.fingerprint());
+  BOOST_CHECK(pr_assign.fingerprint() == pr.fingerprint());
+  BOOST_CHECK_EQUAL(pr_copy.interface_id_index(), iface_index);
+
+  // a cached index and search key find the inserted copy
+  cache.insert(pr_copy);
+  PRPSearchKey search_key(iface_id, iface_index, vars);
+  PRPCacheHIter h_it = lookup_by_val(cache, search_key, resp.active_set());
+  BOOST_REQUIRE(h_it != cache.get<hashed>().end());
+  BOOST_CHECK_EQUAL(h_it->eval_id(), 1);
+
+  // a shallow pair whose variables are updated by their owner is
+  // refingerprinted explicitly
+  ParamResponsePair shallow_pr(vars, iface_id, resp, 2, false);
+  vars.continuous_variable(3., 0);
+  shallow_pr.update_fingerprint();
+  cache.insert(shallow_pr);
+  h_it = lookup_by_val(cache, iface_id, vars, resp.active_set());
+  BOOST_REQUIRE(h_it != cache.get<hashed>().end());
+  BOOST_CHECK_EQUAL(h_it->eval_id(), 2);
+  BOOST_CHECK(shallow_pr == *h_it);
+}
@@ -0,0 +1,79 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+
+#define BOOST_TEST_MODULE dakota_sparse_grid_batch
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace SparseGridBatch {
+
+/// generalized sparse grid refinement over Clenshaw-Curtis rules with
+/// restricted growth, starting from level 3: levels 3 and 4 share the
+/// same 9-point rule, so candidates such as (4,0) add no new points
+std::string sparse_grid_input(bool batch)
+{
+  std::string input(
+    "method \n"
+    "  polynomial_chaos \n"
+    "    p_refinement dimension_adaptive generalized \n"
+    "    max_refinement_iterations = 3 \n"
+    "    convergence_tolerance = 1.e-12 \n"
+    "    sparse_grid_level = 3 \n"
+    "      restricted nested \n"
+    "    output silent \n"
+    "variables \n"
+    "  uniform_uncertain = 2 \n"
+    "    lower_bounds = -1.5 -1. \n"
+    "    upper_bounds =  1.5  2. \n"
+    "    descriptors = 'x1' 'x2' \n"
+    "interface \n"
+    "  analysis_drivers = 'text_book' \n"
+    "    direct \n");
+  if (batch)
+    input += "  batch \n";
+  input +=
+    "  deactivate evaluation_cache restart_file \n"
+    "responses \n"
+    "  response_functions = 1 \n"
+    "  no_gradients \n"
+    "  no_hessians \n";
+  return input;
+}
+
+// +-------------------------------------------------------------------------+
+// |  Concurrent candidate evaluation, including candidates that add only    |
+// |  existing points, reproduces the sequential refinement                  |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(batch_matches_sequential_with_empty_trial_sets)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    seq_env(Dakota::Opt_TPL_Test::create_env(sparse_grid_input(false)));
+  seq_env->execute();
+  const Dakota::RealVector& seq_stats
+    = seq_env->top_level_iterator().response_results().function_values();
+
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    batch_env(Dakota::Opt_TPL_Test::create_env(sparse_grid_input(true)));
+  BOOST_REQUIRE(batch_env->top_level_iterator().iterated_model().asynch_flag());
+  batch_env->execute();
+  const Dakota::RealVector& batch_stats
+    = batch_env->top_level_iterator().response_results().function_values();
+
+  BOOST_REQUIRE_EQUAL(batch_stats.length(), seq_stats.length());
+  BOOST_REQUIRE(seq_stats.length() > 0);
+  for (int i=0; i<seq_stats.length(); ++i)
+    BOOST_CHECK_CLOSE(batch_stats[i], seq_stats[i], 1.e-10);
+}
+
+}  // namespace SparseGridBatch
+
+}  // namespace DakotaUnitTest
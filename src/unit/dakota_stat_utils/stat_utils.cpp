@@ -173,3 +173,71 @@ BOOST_AUTO_TEST_CASE(test_stat_utils_batch_means_percentile)
 }
 
 //------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_stat_utils_chain_accumulator_batch_means)
+{
+  // Read in matrices 
+  std::ifstream infile1("stat_util_test_files/Matrix1.txt");
+  RealMatrix Xmatrix;
+  Xmatrix.shapeUninitialized(1,1000);
+  for (int i = 0; i < 1000; ++i){
+    infile1 >> Xmatrix[i][0];
+  }
+
+  // One pass over the chain, in two pieces as if streamed from a sampler
+  ChainAccumulator chain_stats(1, 1000);
+  chain_stats.accumulate(RealMatrix(Teuchos::View, Xmatrix, 1, 400, 0, 0));
+  chain_stats.accumulate(RealMatrix(Teuchos::View, Xmatrix, 1, 600, 0, 400));
+  BOOST_CHECK_EQUAL(chain_stats.count(), 1000);
+
+  RealMatrix interval_matrix, means_matrix;
+  chain_stats.batch_means_interval(interval_matrix, means_matrix, 1, 0.95);
+  BOOST_CHECK_CLOSE(interval_matrix[0][0], -6.3120595090e-02, 1.e-3);
+  BOOST_CHECK_CLOSE(interval_matrix[0][1],  8.1516649910e-02, 1.e-3);
+
+  chain_stats.batch_means_interval(interval_matrix, means_matrix, 2, 0.95);
+  BOOST_CHECK_CLOSE(interval_matrix[0][0], 9.1432956019e-01, 1.e-3);
+  BOOST_CHECK_CLOSE(interval_matrix[0][1], 1.0688302101e+00, 1.e-3);
+
+  // Batch variances match those of the stored-chain implementation
+  RealMatrix gold_interval_matrix, gold_means_matrix;
+  batch_means_interval(Xmatrix, gold_interval_matrix, gold_means_matrix,
+                       2, 0.95);
+  BOOST_CHECK_EQUAL(means_matrix.numRows(), gold_means_matrix.numRows());
+  for (int i = 0; i < means_matrix.numRows(); ++i)
+    BOOST_CHECK_CLOSE(means_matrix(i,0), gold_means_matrix(i,0), 1.e-8);
+
+  // Standard deviation is consistent with the center of the variance interval
+  RealMatrix moment_stats;
+  chain_stats.moments(moment_stats);
+  BOOST_CHECK_CLOSE(moment_stats(1,0)*moment_stats(1,0),
+                    (interval_matrix(0,0) + interval_matrix(1,0))/2., 1.e-8);
+}
+
+//------------------------------------
+
+BOOST_AUTO_TEST_CASE(test_stat_utils_chain_accumulator_ess)
+{
+  // Independent samples have an effective sample size near the chain
+  // length; an AR(1) chain with correlation rho has N (1-rho)/(1+rho)
+  int num_samples = 40000;
+  Real rho = 0.5;
+  std::mt19937 gen(41u);
+  std::normal_distribution<Real> normal(0., 1.);
+
+  ChainAccumulator chain_stats(2, num_samples);
+  Real sample[2] = { 0., 0. };
+  for (int i = 0; i < num_samples; ++i) {
+    sample[0] = normal(gen);
+    sample[1] = rho*sample[1] + normal(gen);
+    chain_stats.accumulate(sample);
+  }
+
+  RealVector ess;
+  chain_stats.effective_sample_size(ess);
+  BOOST_CHECK_CLOSE(ess[0], (Real)num_samples, 50.);
+  BOOST_CHECK_CLOSE(ess[1], num_samples*(1.-rho)/(1.+rho), 50.);
+  BOOST_CHECK(ess[1] < ess[0]);
+}
+
+//------------------------------------
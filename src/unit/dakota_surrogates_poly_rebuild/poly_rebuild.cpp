@@ -0,0 +1,148 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+#include "DataModel.hpp"
+
+#include <fstream>
+
+#define BOOST_TEST_MODULE dakota_surrogates_poly_rebuild
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace PolyRebuild {
+
+/// two-variable text_book objective
+double text_book(double x1, double x2)
+{ return std::pow(x1 - 1., 4) + std::pow(x2 - 1., 4); }
+
+/// write build points (x1 x2 f) and the polynomial options, which
+/// select the QR solver so that rebuilds may append to the factorization
+void write_build_data(const std::string& points_file,
+		      const std::vector<std::pair<double, double> >& points)
+{
+  std::ofstream points_out(points_file);
+  points_out.precision(17);
+  for (const auto& pt : points)
+    points_out << pt.first << ' ' << pt.second << ' '
+	       << text_book(pt.first, pt.second) << '\n';
+
+  std::ofstream options_out("poly_rebuild_options.yaml");
+  options_out << "%YAML 1.1\n---\nANONYMOUS:\n"
+	      << "  max degree: 2\n"
+	      << "  reduced basis: false\n"
+	      << "  p-norm: 1.0\n"
+	      << "  scaler type: none\n"
+	      << "  regression solver type: QR lsq regression\n"
+	      << "  standardize response: false\n"
+	      << "  verbosity: 0\n...\n";
+}
+
+/// list parameter study over a quadratic polynomial surrogate built from
+/// imported points
+std::string poly_input(const std::string& points_file)
+{
+  return std::string(
+    "method \n"
+    "  model_pointer 'SURR' \n"
+    "  list_parameter_study \n"
+    "    list_of_points = 0.5 0.5 \n"
+    "model \n"
+    "  id_model 'SURR' \n"
+    "  surrogate global experimental_polynomial \n"
+    "    basis_order = 2 \n"
+    "    options_file 'poly_rebuild_options.yaml' \n"
+    "    truth_model_pointer 'TRUTH' \n"
+    "    import_build_points_file '") + points_file + "' custom_annotated \n"
+    "model \n"
+    "  id_model 'TRUTH' \n"
+    "  single \n"
+    "variables \n"
+    "  continuous_design = 2 \n"
+    "    lower_bounds = -2. -2. \n"
+    "    upper_bounds =  2.  2. \n"
+    "    descriptors = 'x1' 'x2' \n"
+    "interface \n"
+    "  analysis_drivers = 'text_book' \n"
+    "    direct \n"
+    "  deactivate evaluation_cache restart_file \n"
+    "responses \n"
+    "  objective_functions = 1 \n"
+    "  no_gradients \n"
+    "  no_hessians \n";
+}
+
+/// append the point (x1, x2) to the surrogate data
+void append_point(Dakota::Model& surr_model, int eval_id, double x1,
+		  double x2, bool rebuild)
+{
+  Dakota::Variables vars = surr_model.current_variables().copy();
+  vars.continuous_variable(x1, 0);
+  vars.continuous_variable(x2, 1);
+  Dakota::Response resp = surr_model.current_response().copy();
+  resp.function_value(text_book(x1, x2), 0);
+  surr_model.append_approximation(vars, std::make_pair(eval_id, resp),
+				  rebuild);
+}
+
+/// evaluate the surrogate at (x1, x2)
+double predict(Dakota::Model& surr_model, double x1, double x2)
+{
+  surr_model.current_variables().continuous_variable(x1, 0);
+  surr_model.current_variables().continuous_variable(x2, 1);
+  surr_model.evaluate();
+  return surr_model.current_response().function_value(0);
+}
+
+// +-------------------------------------------------------------------------+
+// |  An incremental rebuild after a pop matches a build from the same data  |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(pop_then_append)
+{
+  std::vector<std::pair<double, double> > points = {
+    {-1.5, -1.5}, {-0.5, -1.8}, {0.7, -1.2}, {1.6, -0.6}, {-1.2, 0.1},
+    {0.2, 0.4}, {1.1, 0.9}, {-0.4, 1.3}, {0.9, 1.8}, {1.9, 1.5} };
+
+  // pop one appended point, then append two (the last with a rebuild):
+  // the first of those replaces the popped row, so the rebuild may not
+  // simply append the newest row
+  write_build_data("poly_rebuild_points.dat", points);
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    incr_env(Dakota::Opt_TPL_Test::create_env(
+      poly_input("poly_rebuild_points.dat")));
+  incr_env->execute();
+  Dakota::Model& incr_model = incr_env->top_level_iterator().iterated_model();
+  incr_model.surrogate_response_mode(Dakota::UNCORRECTED_SURROGATE);
+  append_point(incr_model, 1001, -1.9,  1.9, true);
+  incr_model.pop_approximation(false, false);
+  append_point(incr_model, 1002,  1.8, -1.9, false);
+  append_point(incr_model, 1003, -0.1, -0.3, true);
+
+  // build from the resulting data
+  points.push_back({ 1.8, -1.9});
+  points.push_back({-0.1, -0.3});
+  write_build_data("poly_rebuild_all_points.dat", points);
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    full_env(Dakota::Opt_TPL_Test::create_env(
+      poly_input("poly_rebuild_all_points.dat")));
+  full_env->execute();
+  Dakota::Model& full_model = full_env->top_level_iterator().iterated_model();
+  full_model.surrogate_response_mode(Dakota::UNCORRECTED_SURROGATE);
+
+  const double eval_pts[][2] = { {0., 0.}, {-1., 1.}, {1.5, -0.5}, {0.3, 1.7} };
+  for (const auto& pt : eval_pts) {
+    double full_val = predict(full_model, pt[0], pt[1]);
+    BOOST_CHECK_SMALL(predict(incr_model, pt[0], pt[1]) - full_val,
+		      1.e-10 * (1. + std::abs(full_val)));
+  }
+}
+
+}  // namespace PolyRebuild
+}  // namespace DakotaUnitTest
@@ -0,0 +1,118 @@
+/*  _______________________________________________________________________
+
+    Dakota: Explore and predict with confidence.
+    Copyright 2014-2024
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#include "opt_tpl_test.hpp"
+
+#define BOOST_TEST_MODULE dakota_test_driver_batch
+#include <boost/test/included/unit_test.hpp>
+
+namespace DakotaUnitTest {
+
+namespace TestDriverBatch {
+
+/// multidim parameter study input over two variables for the given
+/// direct driver and responses, evaluated in batch mode if requested
+std::string batch_input(const std::string& driver,
+			const std::string& responses, bool batch)
+{
+  return std::string(
+    "method \n"
+    "  multidim_parameter_study \n"
+    "    partitions = 4 5 \n"
+    "variables \n"
+    "  continuous_design = 2 \n"
+    "    lower_bounds = -1.5 -1. \n"
+    "    upper_bounds =  1.5  2. \n"
+    "    descriptors = 'x1' 'x2' \n"
+    "interface \n"
+    "  analysis_drivers = '") + driver + "' \n"
+    "    direct \n"
+    "  deactivate evaluation_cache restart_file \n"
+    + (batch ? "  batch \n" : "") +
+    "responses \n"
+    + responses +
+    "  analytic_gradients \n"
+    "  no_hessians \n";
+}
+
+/// evaluate the study point by point and as a single batch, comparing
+/// the response values and gradients of each evaluation
+void check_batch_matches_sequential(const std::string& driver,
+				    const std::string& responses)
+{
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    seq_env(Dakota::Opt_TPL_Test::create_env(
+      batch_input(driver, responses, false)));
+  seq_env->execute();
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    batch_env(Dakota::Opt_TPL_Test::create_env(
+      batch_input(driver, responses, true)));
+  batch_env->execute();
+
+  const Dakota::IntResponseMap& seq_resp
+    = seq_env->top_level_iterator().all_responses();
+  const Dakota::IntResponseMap& batch_resp
+    = batch_env->top_level_iterator().all_responses();
+  BOOST_REQUIRE_EQUAL(seq_resp.size(), 30);
+  BOOST_REQUIRE_EQUAL(batch_resp.size(), seq_resp.size());
+
+  const Dakota::Real tol = 1.e-12;
+  Dakota::IntRespMCIter s_it = seq_resp.begin(), b_it = batch_resp.begin();
+  for (; s_it != seq_resp.end(); ++s_it, ++b_it) {
+    BOOST_CHECK_EQUAL(s_it->first, b_it->first);
+    const Dakota::RealVector& s_fns = s_it->second.function_values();
+    const Dakota::RealVector& b_fns = b_it->second.function_values();
+    const Dakota::RealMatrix& s_grads = s_it->second.function_gradients();
+    const Dakota::RealMatrix& b_grads = b_it->second.function_gradients();
+    BOOST_REQUIRE_EQUAL(s_fns.length(), b_fns.length());
+    for (int f=0; f<s_fns.length(); ++f) {
+      BOOST_CHECK_SMALL(s_fns[f] - b_fns[f], tol*(1. + std::abs(s_fns[f])));
+      for (int v=0; v<s_grads.numRows(); ++v)
+	BOOST_CHECK_SMALL(s_grads(v,f) - b_grads(v,f),
+			  tol*(1. + std::abs(s_grads(v,f))));
+    }
+  }
+}
+
+// +-------------------------------------------------------------------------+
+// |      Vectorized batch kernels reproduce the per-point test drivers      |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(batch_text_book)
+{
+  check_batch_matches_sequential("text_book",
+    "  objective_functions = 1 \n"
+    "  nonlinear_inequality_constraints = 2 \n");
+}
+
+BOOST_AUTO_TEST_CASE(batch_rosenbrock)
+{
+  check_batch_matches_sequential("rosenbrock",
+				 "  objective_functions = 1 \n");
+  check_batch_matches_sequential("rosenbrock",
+				 "  calibration_terms = 2 \n");
+}
+
+BOOST_AUTO_TEST_CASE(batch_separable)
+{
+  check_batch_matches_sequential("herbie",        "  objective_functions = 1 \n");
+  check_batch_matches_sequential("smooth_herbie", "  objective_functions = 1 \n");
+  check_batch_matches_sequential("shubert",       "  objective_functions = 1 \n");
+}
+
+// +-------------------------------------------------------------------------+
+// |         Non-vectorized drivers fall back to per-point evaluation        |
+// +-------------------------------------------------------------------------+
+BOOST_AUTO_TEST_CASE(batch_sequential_fallback)
+{
+  check_batch_matches_sequential("generalized_rosenbrock",
+				 "  objective_functions = 1 \n");
+}
+
+}  // namespace TestDriverBatch
+}  // namespace DakotaUnitTest
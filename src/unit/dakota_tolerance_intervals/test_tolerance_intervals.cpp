@@ -1033,6 +1033,155 @@ void test_DSTIEN_invalid_input_06_alphaOutOfRange()
                    );
 }
 
+void test_DSTIEN_factors_valid_input_01_cached()
+{
+  Real conversion_factor = 0.;
+  Real delta_mf = 0.;
+  for (size_t i = 0; i < 2; ++i) { // second call is served from the cache
+    computeDSTIEN_factors( 17    // number_of_samples
+                         , 0.85  // coverage
+                         , 0.06  // alpha
+                         , conversion_factor
+                         , delta_mf
+                         );
+    Real mcf = computeDSTIEN_conversion_factor(17, 0.06);
+    BOOST_CHECK( conversion_factor == mcf );
+    BOOST_CHECK( delta_mf == std_normal_coverage_inverse(0.85) * mcf );
+  }
+
+  // the cache is keyed by coverage as well as by samples and alpha
+  computeDSTIEN_factors(17, 0.95, 0.06, conversion_factor, delta_mf);
+  BOOST_CHECK( delta_mf == std_normal_coverage_inverse(0.95) * computeDSTIEN_conversion_factor(17, 0.06) );
+}
+
+void test_DSTIEN_factors_invalid_input_01_justOneSample()
+{
+  Real conversion_factor = 0.;
+  Real delta_mf = 0.;
+  BOOST_CHECK_THROW( computeDSTIEN_factors(1, 0.85, 0.05, conversion_factor, delta_mf)
+                   , std::system_error
+                   );
+}
+
+void test_DSTIEN_valid_input_08_matrixSamples()
+{
+  // ************************************************************************
+  // Generate response samples, as in test_DSTIEN_valid_input_01_benchmark()
+  // ************************************************************************
+  size_t num_fns     = 3;
+  size_t num_samples = 4;
+  Real sample_vals[4][3] = { {13.2, -13.8, 0.104}
+                           , {13.4, -13.4, 0.114}
+                           , {13.6, -13.0, 0.124}
+                           , {13.8, -12.6, 0.134} };
+
+  Dakota::ActiveSet as(num_fns, 0);
+  IntResponseMap resp_samples;
+  RealMatrix resp_matrix(num_samples, num_fns);
+  for (size_t j = 0; j < num_samples; ++j) {
+    Dakota::SharedResponseData srd(as);
+    Response resp(srd);
+    for (size_t k = 0; k < num_fns; ++k) {
+      resp.function_value_view(k) = sample_vals[j][k];
+      resp_matrix(j,k) = sample_vals[j][k];
+    }
+    resp_samples.insert(std::pair<int,Response>(j,resp));
+  }
+
+  // ************************************************************************
+  // Compute DSTIEN mus and DSTIEN sigmas both ways
+  // ************************************************************************
+  size_t map_num_valid = 0, matrix_num_valid = 0;
+  RealVector map_mus, map_sample_sigmas, map_dstien_sigmas;
+  RealVector matrix_mus, matrix_sample_sigmas, matrix_dstien_sigmas;
+  Real map_delta_mf = 0., matrix_delta_mf = 0.;
+
+  computeDSTIEN( resp_samples, 0.85, 0.05, map_num_valid, map_mus
+               , map_delta_mf, map_sample_sigmas, map_dstien_sigmas
+               );
+  computeDSTIEN( resp_matrix, 0.85, 0.05, matrix_num_valid, matrix_mus
+               , matrix_delta_mf, matrix_sample_sigmas, matrix_dstien_sigmas
+               );
+
+  // ************************************************************************
+  // Check the results
+  // ************************************************************************
+  BOOST_CHECK( matrix_num_valid == 4 );
+  BOOST_CHECK( matrix_num_valid == map_num_valid );
+  BOOST_CHECK( matrix_delta_mf == map_delta_mf );
+  for (size_t k = 0; k < num_fns; ++k) {
+    BOOST_CHECK( matrix_mus[k]           == map_mus[k]           );
+    BOOST_CHECK( matrix_sample_sigmas[k] == map_sample_sigmas[k] );
+    BOOST_CHECK( matrix_dstien_sigmas[k] == map_dstien_sigmas[k] );
+  }
+}
+
+void test_DSTIEN_valid_input_09_incrementalSamples()
+{
+  // ************************************************************************
+  // Generate response samples, one of them invalid
+  // ************************************************************************
+  size_t num_fns     = 2;
+  size_t num_samples = 7;
+  Real sample_vals[7][2] = { { 1.5,  210.}
+                           , { 2.25, 190.}
+                           , { 0.75, std::numeric_limits<Real>::quiet_NaN()}
+                           , {-0.5,  205.}
+                           , { 3.0,  215.}
+                           , { 1.0,  180.}
+                           , { 2.0,  200.} };
+  RealMatrix resp_matrix(num_samples, num_fns);
+  for (size_t j = 0; j < num_samples; ++j) {
+    for (size_t k = 0; k < num_fns; ++k) {
+      resp_matrix(j,k) = sample_vals[j][k];
+    }
+  }
+
+  // ************************************************************************
+  // Accumulate batches of 3 and 4 samples, as if streamed
+  // ************************************************************************
+  size_t num_valid_samples = 0;
+  RealVector sample_mus, sum_sq_diffs;
+  RealMatrix batch_a(Teuchos::View, resp_matrix, 3, num_fns, 0, 0);
+  RealMatrix batch_b(Teuchos::View, resp_matrix, 4, num_fns, 3, 0);
+  accumulateDSTIEN(batch_a, num_valid_samples, sample_mus, sum_sq_diffs);
+  BOOST_CHECK( num_valid_samples == 2 );
+  accumulateDSTIEN(batch_b, num_valid_samples, sample_mus, sum_sq_diffs);
+  BOOST_CHECK( num_valid_samples == 6 );
+
+  RealVector incr_mus, incr_sample_sigmas, incr_dstien_sigmas;
+  Real incr_delta_mf = 0.;
+  computeDSTIEN( num_valid_samples, sample_mus, sum_sq_diffs, 0.9, 0.05
+               , incr_mus, incr_delta_mf, incr_sample_sigmas, incr_dstien_sigmas
+               );
+
+  // ************************************************************************
+  // Check the results against all samples at once
+  // ************************************************************************
+  size_t full_num_valid = 0;
+  RealVector full_mus, full_sample_sigmas, full_dstien_sigmas;
+  Real full_delta_mf = 0.;
+  computeDSTIEN( resp_matrix, 0.9, 0.05, full_num_valid, full_mus
+               , full_delta_mf, full_sample_sigmas, full_dstien_sigmas
+               );
+
+  BOOST_CHECK( full_num_valid == 6 );
+  BOOST_CHECK( incr_delta_mf == full_delta_mf );
+  for (size_t k = 0; k < num_fns; ++k) {
+    Real tol = 100. * std::numeric_limits<Real>::epsilon();
+    BOOST_CHECK( std::abs(incr_mus[k]           - full_mus[k]          ) < tol * std::abs(full_mus[k])           );
+    BOOST_CHECK( std::abs(incr_sample_sigmas[k] - full_sample_sigmas[k]) < tol * std::abs(full_sample_sigmas[k]) );
+    BOOST_CHECK( std::abs(incr_dstien_sigmas[k] - full_dstien_sigmas[k]) < tol * std::abs(full_dstien_sigmas[k]) );
+  }
+
+  // the batch with the invalid sample alone averages its two valid samples
+  size_t batch_num_valid = 0;
+  RealVector batch_mus, batch_sum_sq_diffs;
+  accumulateDSTIEN(batch_a, batch_num_valid, batch_mus, batch_sum_sq_diffs);
+  BOOST_CHECK( std::abs(batch_mus[0] - 1.875) < 10.*std::numeric_limits<Real>::epsilon() );
+  BOOST_CHECK( std::abs(batch_mus[1] - 200.0) < 1000.*std::numeric_limits<Real>::epsilon() );
+}
+
 } // end namespace TestToleranceIntervals
 } // end namespace Dakota
 
@@ -1114,6 +1263,18 @@ BOOST_AUTO_TEST_CASE( test_main )
   Dakota::TestToleranceIntervals::test_DSTIEN_invalid_input_06_alphaOutOfRange();
   std::cout << "test_DSTIEN_invalid_input_06_alphaOutOfRange() passed" << std::endl;
 
+  Dakota::TestToleranceIntervals::test_DSTIEN_factors_valid_input_01_cached();
+  std::cout << "test_DSTIEN_factors_valid_input_01_cached() passed" << std::endl;
+
+  Dakota::TestToleranceIntervals::test_DSTIEN_factors_invalid_input_01_justOneSample();
+  std::cout << "test_DSTIEN_factors_invalid_input_01_justOneSample() passed" << std::endl;
+
+  Dakota::TestToleranceIntervals::test_DSTIEN_valid_input_08_matrixSamples();
+  std::cout << "test_DSTIEN_valid_input_08_matrixSamples() passed" << std::endl;
+
+  Dakota::TestToleranceIntervals::test_DSTIEN_valid_input_09_incrementalSamples();
+  std::cout << "test_DSTIEN_valid_input_09_incrementalSamples() passed" << std::endl;
+
   int run_result = 0;
   BOOST_CHECK( run_result == 0 || run_result == boost::exit_success );
 
@@ -8,6 +8,7 @@
     _______________________________________________________________________ */
 
 #include "WorkdirHelper.hpp"
+#include "WorkdirPool.hpp"
 #include "CommandShell.hpp"
 #include "dakota_global_defs.hpp"
 
@@ -17,7 +18,10 @@
 #include <boost/foreach.hpp>
 
 #include <cassert>
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <thread>
 
 
 namespace Dakota {
@@ -275,6 +279,68 @@ void test_create_and_remove_wd_in_rundir(const std::string& dir_name,
 }
 
 
+/// claim a directory from the pool, allowing time for the background
+/// thread to populate it
+bool claim_when_ready(WorkdirPool& pool, const bfs::path& dest_dir)
+{
+  for (size_t i=0; i<500; ++i) {
+    if (pool.claim(dest_dir))
+      return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+
+void test_workdir_pool()
+{
+  bfs::path tmp_dir( WorkdirHelper::system_tmp_path() );
+  bfs::path root( tmp_dir/bfs::unique_path("daktst_%%%%%%%%") );
+  bfs::path src_dir(root/"src"), pool_root(root/"pool");
+  WorkdirHelper::create_directory(src_dir, DIR_CLEAN);
+  WorkdirHelper::create_directory(pool_root, DIR_CLEAN);
+  { std::ofstream f((src_dir/"params.in").string());  f << "1.0\n"; }
+  { std::ofstream f((src_dir/"mesh.dat").string());   f << "mesh\n"; }
+  { std::ofstream f((src_dir/"shared.dat").string()); f << "shared\n"; }
+  bfs::permissions(src_dir/"mesh.dat", bfs::owner_read);
+
+  {
+    WorkdirPool pool(StringArray(1, (src_dir/"*.in").string()),
+		     StringArray(1, (src_dir/"shared.dat").string()),
+		     pool_root, 2);
+
+    // the staged template is private to the pool
+    bfs::path staged = pool.staged_template();
+    BOOST_CHECK( bfs::is_directory(staged) );
+    BOOST_CHECK( staged.parent_path() == pool_root );
+
+    // a claimed directory holds the copied and linked items
+    bfs::path wd1(root/"workdir.1");
+    BOOST_CHECK( claim_when_ready(pool, wd1) );
+    BOOST_CHECK( bfs::is_regular_file(wd1/"params.in") );
+    BOOST_CHECK( !bfs::exists(wd1/"mesh.dat") );
+    BOOST_CHECK( bfs::is_symlink(wd1/"shared.dat") );
+
+    // an existing destination is left to the caller
+    BOOST_CHECK( !pool.claim(wd1) );
+
+    // retired directories are renamed out of the way immediately
+    pool.retire(wd1);
+    BOOST_CHECK( !bfs::exists(wd1) );
+    BOOST_CHECK( claim_when_ready(pool, wd1) );
+    BOOST_CHECK( bfs::is_regular_file(wd1/"params.in") );
+    pool.retire(wd1);
+  }
+
+  // the template, unclaimed, and retired directories are removed with
+  // the pool, such that no hidden directories persist between runs
+  BOOST_CHECK( bfs::is_empty(pool_root) );
+
+  bfs::permissions(src_dir/"mesh.dat", bfs::owner_read | bfs::owner_write);
+  test_rmdir(root);
+}
+
+
 void test_driver_relative_path(const bfs::path& rel_driver_path)
 {
   std::string rundir_str = Dakota::WorkdirHelper::startup_pwd();
@@ -321,6 +387,8 @@ int test_main( int argc, char* argv[] )      // note the name!
   test_create_and_remove_tmpdir(do_copy);
   test_create_and_remove_wd_in_rundir("workdir", do_copy);
 
+  test_workdir_pool();
+
   /* WJB: consider refactor count_driver_scripts test -- bfs::path fq_search(argv[1]);
   std::string fq_search(rundir_str);
   fq_search += "/../test/d*.sh";
@@ -10,8 +10,10 @@
 
 #include "opt_tpl_test.hpp"
 
+#include <fstream>
 #include <string>
 #include <map>
+#include <memory>
 
 #include <Teuchos_UnitTestHarness.hpp> 
 
@@ -1768,3 +1770,129 @@ TEUCHOS_UNIT_TEST(opt_moga,text_book_multi_disc_set_1)
   rel_err = fabs((resp.function_value(1) - target)/1.0);
   TEST_COMPARE(rel_err,<, max_tol);
 }
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(opt_soga,cyl_head_asynch)
+{
+  /// Dakota input string, completed below with a synchronous or an
+  /// asynchronous (batch) interface
+  static const char cyl_head_input[] = 
+    " method,"
+    "   output silent"
+    "   max_function_evaluations 500"
+    "   soga"
+    "     convergence_type best_fitness_tracker"
+    "     percent_change = 1.0e-10 num_generations = 1000"
+    "     seed = 10983"
+    " variables,"
+    "   continuous_design = 2"
+    "     initial_point    1.51         0.01"
+    "     upper_bounds     2.164        4.0"
+    "     lower_bounds     1.5          0.0"
+    "     descriptors      'intake_dia' 'flatness'"
+    " responses,"
+    "   num_objective_functions = 1"
+    "   nonlinear_inequality_constraints = 3"
+    "   no_gradients"
+    "   no_hessians"
+    " interface,"
+    "   direct"
+    "     analysis_driver = 'cyl_head'";
+
+  std::string synch_input(cyl_head_input), asynch_input(cyl_head_input);
+  asynch_input += " batch";
+
+  // asynchronous responses are matched to Designs by evaluation id, so
+  // the search must be unchanged from the synchronous case
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    synch_env(Opt_TPL_Test::create_env(synch_input)),
+    asynch_env(Opt_TPL_Test::create_env(asynch_input));
+
+  if (synch_env->parallel_library().mpirun_flag())
+    TEST_ASSERT( false ); // This test only works for serial builds
+
+  synch_env->execute();
+  asynch_env->execute();
+
+  const Variables& synch_vars  =  synch_env->variables_results();
+  const Variables& asynch_vars = asynch_env->variables_results();
+  TEST_FLOATING_EQUALITY(asynch_vars.continuous_variable(0),
+			 synch_vars.continuous_variable(0), 1.e-12);
+  TEST_FLOATING_EQUALITY(asynch_vars.continuous_variable(1),
+			 synch_vars.continuous_variable(1), 1.e-12);
+  TEST_FLOATING_EQUALITY(asynch_env->response_results().function_value(0),
+			 synch_env->response_results().function_value(0),
+			 1.e-12);
+}
+
+//----------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(opt_soga,textbook_lsq_nested_recast_asynch)
+{
+  /// Dakota input string, completed below with a synchronous or an
+  /// asynchronous (batch) interface.  Calibration data, variable scaling
+  /// and the least squares recast stack three RecastModels,
+  /// reduce(scale(data(text_book))), in which the scaling layer maps
+  /// variables over a data transformation that maps responses.
+  static const char lsq_input[] = 
+    " method,"
+    "   output silent"
+    "   max_function_evaluations 300"
+    "   scaling"
+    "   soga"
+    "     population_size = 20"
+    "     seed = 10983"
+    " variables,"
+    "   continuous_design = 2"
+    "     initial_point    0.9    1.1"
+    "     upper_bounds     5.8    2.9"
+    "     lower_bounds     0.5   -2.9"
+    "     scale_types      'value'"
+    "     scales           2.     0.5"
+    "     descriptors      'x1'   'x2'"
+    " responses,"
+    "   calibration_terms = 3"
+    "     calibration_data_file = 'soga_nested_recast.dat'"
+    "       freeform"
+    "   no_gradients"
+    "   no_hessians"
+    " interface,"
+    "   direct"
+    "     analysis_driver = 'text_book'"
+    "   deactivate evaluation_cache restart_file";
+
+  {
+    std::ofstream data_stream("soga_nested_recast.dat");
+    data_stream << "82\n15.5\n2\n";
+  }
+
+  std::string synch_input(lsq_input), asynch_input(lsq_input);
+  asynch_input += " batch";
+
+  // each layer rekeys and transforms the asynchronous responses, and the
+  // scaling layer shares the variables bookkept by the data layer, so the
+  // search must be unchanged from the synchronous case
+  std::shared_ptr<Dakota::LibraryEnvironment>
+    synch_env(Opt_TPL_Test::create_env(synch_input)),
+    asynch_env(Opt_TPL_Test::create_env(asynch_input));
+
+  if (synch_env->parallel_library().mpirun_flag())
+    TEST_ASSERT( false ); // This test only works for serial builds
+
+  synch_env->execute();
+  asynch_env->execute();
+
+  const Variables& synch_vars  =  synch_env->variables_results();
+  const Variables& asynch_vars = asynch_env->variables_results();
+  TEST_FLOATING_EQUALITY(asynch_vars.continuous_variable(0),
+			 synch_vars.continuous_variable(0), 1.e-12);
+  TEST_FLOATING_EQUALITY(asynch_vars.continuous_variable(1),
+			 synch_vars.continuous_variable(1), 1.e-12);
+  const Response&  synch_resp =  synch_env->response_results();
+  const Response& asynch_resp = asynch_env->response_results();
+  TEST_EQUALITY(asynch_resp.num_functions(), synch_resp.num_functions());
+  for (size_t i=0; i<synch_resp.num_functions(); ++i)
+    TEST_FLOATING_EQUALITY(asynch_resp.function_value(i),
+			   synch_resp.function_value(i), 1.e-12);
+}
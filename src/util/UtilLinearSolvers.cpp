@@ -108,6 +108,13 @@ void LinearSolverBase::solve(const MatrixXd& rhs, MatrixXd& x) {
   throw(std::runtime_error(msg));
 }
 
+void LinearSolverBase::append_rows(const MatrixXd& A_rows,
+                                   const MatrixXd& b_rows, MatrixXd& x) {
+  silence_unused_args(A_rows, b_rows, x);
+  std::string msg = "append_rows() Has not been implemented for this class.";
+  throw(std::runtime_error(msg));
+}
+
 // ------------------------------------------------------------
 
 LUSolver::LUSolver() : LinearSolverBase() {}
@@ -184,10 +191,12 @@ void QRSolver::factorize(const MatrixXd& A) {
   Eigen::ColPivHouseholderQR<MatrixXd> qr;
   QR_Ptr =
       std::make_shared<Eigen::ColPivHouseholderQR<MatrixXd>>(qr.compute(A));
+  reducedMatrix.resize(0, 0);
 }
 
 void QRSolver::solve(const MatrixXd& A, const MatrixXd& b, MatrixXd& x) {
   factorize(A);
+  reduce_problem(b);
   solve(b, x);
 }
 
@@ -200,6 +209,30 @@ void QRSolver::solve(const MatrixXd& b, MatrixXd& x) {
   }
 }
 
+void QRSolver::append_rows(const MatrixXd& A_rows, const MatrixXd& b_rows,
+                           MatrixXd& x) {
+  if (reducedMatrix.size() == 0) {
+    std::string msg =
+        "QR least-squares problem has not been previously solved.";
+    throw(std::runtime_error(msg));
+  }
+  const int num_reduced = reducedMatrix.rows();
+  const int num_rows = A_rows.rows();
+  MatrixXd stacked_A(num_reduced + num_rows, reducedMatrix.cols());
+  MatrixXd stacked_b(num_reduced + num_rows, reducedRHS.cols());
+  stacked_A << reducedMatrix, A_rows;
+  stacked_b << reducedRHS, b_rows;
+  solve(stacked_A, stacked_b, x);
+}
+
+void QRSolver::reduce_problem(const MatrixXd& b) {
+  const int num_reduced = std::min(QR_Ptr->rows(), QR_Ptr->cols());
+  reducedMatrix =
+      QR_Ptr->matrixR().topRows(num_reduced).triangularView<Eigen::Upper>();
+  reducedMatrix = reducedMatrix * QR_Ptr->colsPermutation().transpose();
+  reducedRHS = (QR_Ptr->householderQ().transpose() * b).topRows(num_reduced);
+}
+
 // ------------------------------------------------------------
 
 CholeskySolver::CholeskySolver() : LinearSolverBase() {}
@@ -214,11 +247,18 @@ bool CholeskySolver::is_factorized() const {
 void CholeskySolver::factorize(const MatrixXd& A) {
   Eigen::LDLT<MatrixXd> ldlt;
   LDLT_Ptr = std::make_shared<Eigen::LDLT<MatrixXd>>(ldlt.compute(A));
+  normalRHS.resize(0, 0);
 }
 
 void CholeskySolver::solve(const MatrixXd& A, const MatrixXd& b, MatrixXd& x) {
-  factorize(A);
-  solve(b, x);
+  if (A.rows() == A.cols()) {
+    factorize(A);
+    solve(b, x);
+  } else {
+    factorize(A.transpose() * A);
+    normalRHS = A.transpose() * b;
+    solve(normalRHS, x);
+  }
 }
 
 void CholeskySolver::solve(const MatrixXd& b, MatrixXd& x) {
@@ -231,6 +271,19 @@ void CholeskySolver::solve(const MatrixXd& b, MatrixXd& x) {
   }
 }
 
+void CholeskySolver::append_rows(const MatrixXd& A_rows,
+                                 const MatrixXd& b_rows, MatrixXd& x) {
+  if (normalRHS.size() == 0) {
+    std::string msg =
+        "Cholesky least-squares problem has not been previously solved.";
+    throw(std::runtime_error(msg));
+  }
+  for (int i = 0; i < A_rows.rows(); ++i)
+    LDLT_Ptr->rankUpdate(A_rows.row(i).transpose());
+  normalRHS += A_rows.transpose() * b_rows;
+  solve(normalRHS, x);
+}
+
 // ------------------------------------------------------------
 
 }  // namespace util
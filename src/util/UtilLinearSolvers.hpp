@@ -78,6 +78,18 @@ class LinearSolverBase {
    * \param[in] x   The linear system solution (multi-)vector.
    */
   virtual void solve(const MatrixXd& b, MatrixXd& x);
+
+  /**
+   * \brief Append rows to the least-squares problem most recently solved
+   * with solve(A, b, x), updating the factorization rather than
+   * recomputing it for the augmented matrix, and find the updated solution.
+   *
+   * \param[in] A_rows The left-hand-side rows to append.
+   * \param[in] b_rows The corresponding right-hand-side rows.
+   * \param[in] x The updated least-squares solution (multi-)vector.
+   */
+  virtual void append_rows(const MatrixXd& A_rows, const MatrixXd& b_rows,
+                           MatrixXd& x);
 };
 
 /**
@@ -226,8 +238,27 @@ class QRSolver : public LinearSolverBase {
    */
   void solve(const MatrixXd& b, MatrixXd& x) override;
 
+  /**
+   * \brief Append rows to the least-squares problem, re-triangularizing
+   * the stacked [R; A_rows] instead of the full augmented matrix.
+   *
+   * \param[in] A_rows The left-hand-side rows to append.
+   * \param[in] b_rows The corresponding right-hand-side rows.
+   * \param[in] x The updated least-squares solution (multi-)vector.
+   */
+  void append_rows(const MatrixXd& A_rows, const MatrixXd& b_rows,
+                   MatrixXd& x) override;
+
  private:
+  /// Retain the triangular factor and projected right-hand side, which
+  /// together are equivalent to the least-squares problem (A, b)
+  void reduce_problem(const MatrixXd& b);
+
   std::shared_ptr<Eigen::ColPivHouseholderQR<MatrixXd>> QR_Ptr;
+  /// Unpermuted triangular factor R P^T of the least-squares matrix
+  MatrixXd reducedMatrix;
+  /// Leading rows of Q^T b for the least-squares right-hand side
+  MatrixXd reducedRHS;
 };
 
 // --------------------------------------------------------------------------------
@@ -257,7 +288,8 @@ class CholeskySolver : public LinearSolverBase {
   void factorize(const MatrixXd& A) override;
 
   /**
-   * \brief Find a solution to Ax = b.
+   * \brief Find a solution to Ax = b, or to the normal equations
+   * (A^T*A)x = A^T*b when A is not square.
    *
    * \param[in] A The linear system left-hand-side matrix.
    * \param[in] b The linear system right-hand-side (multi-)vector.
@@ -273,9 +305,23 @@ class CholeskySolver : public LinearSolverBase {
    */
   void solve(const MatrixXd& b, MatrixXd& x) override;
 
+  /**
+   * \brief Append rows to the normal equations of a least-squares
+   * problem with rank-one updates of the LDL^T factorization.
+   *
+   * \param[in] A_rows The left-hand-side rows to append.
+   * \param[in] b_rows The corresponding right-hand-side rows.
+   * \param[in] x The updated least-squares solution (multi-)vector.
+   */
+  void append_rows(const MatrixXd& A_rows, const MatrixXd& b_rows,
+                   MatrixXd& x) override;
+
  private:
   /// Cached LDL^T factorization
   std::shared_ptr<Eigen::LDLT<MatrixXd>> LDLT_Ptr;
+  /// Right-hand side A^T*b of the normal equations; empty unless the
+  /// last solve(A, b, x) was a least-squares problem
+  MatrixXd normalRHS;
 };
 
 }  // namespace util
@@ -135,3 +135,36 @@ BOOST_AUTO_TEST_CASE(util_solver_cholesky) {
 }
 
 // --------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(util_solver_append_rows) {
+  /* Least-squares solutions after appending rows match a full solve */
+  MatrixXd A = create_uniform_random_double_matrix(20, 4, 26);
+  MatrixXd b = create_uniform_random_double_matrix(20, 2, 27);
+  MatrixXd x_full, x_append;
+
+  SVDSolver svd_solver;
+  svd_solver.solve(A, b, x_full);
+
+  QRSolver qr_solver;
+  qr_solver.solve(A.topRows(8), b.topRows(8), x_append);
+  qr_solver.append_rows(A.middleRows(8, 5), b.middleRows(8, 5), x_append);
+  qr_solver.append_rows(A.bottomRows(7), b.bottomRows(7), x_append);
+  BOOST_CHECK(matrix_equals(x_append, x_full, 1.0e-10));
+
+  CholeskySolver cholesky_solver;
+  cholesky_solver.solve(A.topRows(8), b.topRows(8), x_append);
+  cholesky_solver.append_rows(A.bottomRows(12), b.bottomRows(12), x_append);
+  BOOST_CHECK(matrix_equals(x_append, x_full, 1.0e-10));
+
+  /* Square systems are not least-squares problems for Cholesky */
+  CholeskySolver square_solver;
+  test_solver_symmetric(square_solver);
+  BOOST_CHECK_THROW(square_solver.append_rows(A.topRows(1).leftCols(3),
+                                              b.topRows(1), x_append),
+                    std::runtime_error);
+
+  LUSolver lu_solver;
+  BOOST_CHECK_THROW(lu_solver.append_rows(A, b, x_append), std::runtime_error);
+}
+
+// --------------------------------------------------------------------------------
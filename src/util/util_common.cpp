@@ -11,7 +11,10 @@
 
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics.hpp>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <thread>
 
 namespace dakota {
 namespace util {
@@ -124,5 +127,32 @@ void populateMatricesFromFile(const std::string& filename,
 
 // ------------------------------------------------------------
 
+namespace {
+/// Threads available to this process (0 if unrestricted)
+std::atomic<int> processThreads(0);
+/// Threads available on this thread (0 if unrestricted)
+thread_local int threadBudget = 0;
+}  // namespace
+
+int available_threads() {
+  int num_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+  const int process_threads = processThreads.load();
+  if (process_threads > 0) num_threads = std::min(process_threads, num_threads);
+  return (threadBudget > 0) ? std::min(threadBudget, num_threads)
+                            : num_threads;
+}
+
+void set_process_threads(int num_threads) {
+  processThreads.store(std::max(num_threads, 0));
+}
+
+ThreadBudget::ThreadBudget(int num_threads) : prevThreads(threadBudget) {
+  threadBudget = std::max(num_threads, 1);
+}
+
+ThreadBudget::~ThreadBudget() { threadBudget = prevThreads; }
+
+// ------------------------------------------------------------
+
 }  // namespace util
 }  // namespace dakota
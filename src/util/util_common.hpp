@@ -86,6 +86,37 @@ void populateMatricesFromFile(const std::string& filename,
  */
 double variance(const VectorXd& vec);
 
+/**
+ * \brief Number of threads available to parallel work started on the
+ * calling thread: the hardware concurrency, unless restricted for the
+ * process by set_process_threads() or by a ThreadBudget in scope on
+ * this thread.
+ */
+int available_threads();
+
+/**
+ * \brief Restricts available_threads() for every thread of this process,
+ * e.g., to its share of a node running several processes
+ * \param[in] num_threads Thread limit (unrestricted if less than one)
+ */
+void set_process_threads(int num_threads);
+
+/**
+ * \brief Restricts available_threads() on the calling thread while in
+ * scope, e.g., for work nested within one of several concurrent threads.
+ */
+class ThreadBudget {
+ public:
+  /// Restrict the calling thread to num_threads (at least one)
+  explicit ThreadBudget(int num_threads);
+  /// Restore the previous restriction
+  ~ThreadBudget();
+
+ private:
+  /// Budget in effect on construction (0 if unrestricted)
+  int prevThreads;
+};
+
 }  // namespace util
 }  // namespace dakota
 
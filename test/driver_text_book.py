@@ -209,3 +209,34 @@ def text_book_batch(list_of_params):
         else:
             retvals.append(text_book_numpy(param_dict))
     return retvals
+
+
+def text_book_batch_arrays(params):
+    """Vectorized text_book, filling Dakota's result arrays in place."""
+    x = params["cv"]
+    asv = params["asv"]
+    results = params["results"]
+    num_vars = x.shape[1]
+
+    results["metadata"][:] = [5., 10.]
+
+    results["fns"][:, 0] = np.sum((x - 1.)**4, axis=1)
+    results["fns"][:, 1] = x[:, 0] * x[:, 0] - x[:, 1] / 2.0
+    results["fns"][:, 2] = x[:, 1] * x[:, 1] - x[:, 0] / 2.0
+
+    if np.any(asv & 2):
+        grads = results["fnGrads"]
+        grads[:, 0, :num_vars] = 4. * (x - 1.)**3
+        grads[:, 1, 0] = 2.0 * x[:, 0]
+        grads[:, 1, 1] = -0.5
+        grads[:, 2, 0] = -0.5
+        grads[:, 2, 1] = 2.0 * x[:, 1]
+
+    if np.any(asv & 4):
+        hessians = results["fnHessians"]
+        for i in range(num_vars):
+            hessians[:, 0, i, i] = 12. * (x[:, i] - 1.)**2
+        hessians[:, 1, 0, 0] = 2.0
+        hessians[:, 2, 1, 1] = 2.0
+
+    return None